@@ -609,6 +609,11 @@ void acb_dot(acb_t res, const acb_t initial, int subtract,
 void acb_approx_dot(acb_t res, const acb_t initial, int subtract,
     acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len, slong prec);
 
+void acb_dot_threaded(acb_t res, const acb_t initial, int subtract,
+    acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len, slong prec);
+void acb_approx_dot_threaded(acb_t res, const acb_t initial, int subtract,
+    acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len, slong prec);
+
 void acb_dot_ui(acb_t res, const acb_t initial, int subtract,
     acb_srcptr x, slong xstep, const ulong * y, slong ystep, slong len, slong prec);
 void acb_dot_si(acb_t res, const acb_t initial, int subtract,
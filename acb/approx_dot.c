@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb.h"
 #include "flint/longlong.h"
 
@@ -256,222 +257,44 @@ acb_approx_dot_simple(acb_t res, const acb_t initial, int subtract,
     }
 }
 
-void
-acb_approx_dot(acb_t res, const acb_t initial, int subtract, acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len, slong prec)
+/* Alignment of the real and imaginary fixed-point sums, which is
+   determined by all the terms. */
+typedef struct
 {
-    slong i, j, padding, extend;
-    slong xexp, yexp, exp;
-    slong re_nonzero, im_nonzero;
-    slong re_max_exp, re_min_exp, re_sum_exp;
-    slong im_max_exp, im_min_exp, im_sum_exp;
+    mp_size_t re_sn, im_sn;
+    slong re_sum_exp, im_sum_exp;
     slong re_prec, im_prec;
+    int re_zero, im_zero;
+}
+acb_dot_align_struct;
+
+/* Adds the midpoint products x[i] y[i], 0 <= i < len, to the real and
+   imaginary fixed-point sums as in _acb_dot_sum_terms (see acb/dot.c). */
+static void
+_acb_approx_dot_sum_terms(mp_ptr re_sum, mp_ptr im_sum, mp_ptr tmp,
+    const acb_dot_align_struct * A,
+    acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len)
+{
+    slong i, xexp, yexp, exp;
+    slong re_sum_exp, im_sum_exp, re_prec, im_prec;
     int xnegative, ynegative;
-    mp_size_t xn, yn, re_sn, im_sn, alloc;
+    mp_size_t xn, yn, re_sn, im_sn;
     flint_bitcnt_t shift;
     arb_srcptr xi, yi;
     arf_srcptr xm, ym;
-    mp_limb_t re_serr, im_serr;   /* Sum over arithmetic errors */
-    mp_ptr tmp, re_sum, im_sum;   /* Workspace */
+    mp_limb_t re_serr, im_serr;   /* Not used, but need dummies for calls */
     slong xoff, yoff;
     char * use_gauss;
-    ARF_ADD_TMP_DECL;
-
-    /* todo: fast fma and fmma (len=2) code */
-    if (len <= 1)
-    {
-        acb_approx_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
-        return;
-    }
-
-    /* Number of nonzero midpoint terms in sum. */
-    re_nonzero = 0;
-    im_nonzero = 0;
-
-    /* Terms are bounded by 2^max_exp (with WORD_MIN = -infty) */
-    re_max_exp = WORD_MIN;
-    im_max_exp = WORD_MIN;
-
-    /* Used to reduce the precision. */
-    re_min_exp = WORD_MAX;
-    im_min_exp = WORD_MAX;
 
-    /* Account for the initial term. */
-    if (initial != NULL)
-    {
-        if (!ARF_IS_LAGOM(arb_midref(acb_realref(initial))) || !ARF_IS_LAGOM(arb_midref(acb_imagref(initial))))
-        {
-            acb_approx_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
-            return;
-        }
-
-        xm = arb_midref(acb_realref(initial));
-
-        if (!arf_is_special(xm))
-        {
-            re_max_exp = ARF_EXP(xm);
-            re_nonzero++;
-
-            if (prec > 2 * FLINT_BITS)
-                re_min_exp = ARF_EXP(xm) - ARF_SIZE(xm) * FLINT_BITS;
-        }
-
-        xm = arb_midref(acb_imagref(initial));
-
-        if (!arf_is_special(xm))
-        {
-            im_max_exp = ARF_EXP(xm);
-            im_nonzero++;
+    re_sn = A->re_sn;
+    im_sn = A->im_sn;
+    re_sum_exp = A->re_sum_exp;
+    im_sum_exp = A->im_sum_exp;
+    re_prec = A->re_prec;
+    im_prec = A->im_prec;
 
-            if (prec > 2 * FLINT_BITS)
-                im_min_exp = ARF_EXP(xm) - ARF_SIZE(xm) * FLINT_BITS;
-        }
-    }
-
-    for (xoff = 0; xoff < 2; xoff++)
-    {
-        for (yoff = 0; yoff < 2; yoff++)
-        {
-            slong nonzero, max_exp, min_exp;
-
-            if (xoff == yoff)
-            {
-                nonzero = re_nonzero;
-                max_exp = re_max_exp;
-                min_exp = re_min_exp;
-            }
-            else
-            {
-                nonzero = im_nonzero;
-                max_exp = im_max_exp;
-                min_exp = im_min_exp;
-            }
-
-            /* Determine maximum exponents for the main sum and the radius sum. */
-            for (i = 0; i < len; i++)
-            {
-                xi = ((arb_srcptr) x) + 2 * i * xstep + xoff;
-                yi = ((arb_srcptr) y) + 2 * i * ystep + yoff;
-
-                /* Fallback for huge exponents or non-finite values. */
-                if (!ARF_IS_LAGOM(arb_midref(xi)) || !ARF_IS_LAGOM(arb_midref(yi)))
-                {
-                    acb_approx_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
-                    return;
-                }
-
-                xm = arb_midref(xi);
-                ym = arb_midref(yi);
-
-                /* (xm+xr)(ym+yr) = xm ym + [xr ym + xm yr + xr yr] */
-                if (!arf_is_special(xm))
-                {
-                    xexp = ARF_EXP(xm);
-
-                    if (!arf_is_special(ym))
-                    {
-                        yexp = ARF_EXP(ym);
-
-                        max_exp = FLINT_MAX(max_exp, xexp + yexp);
-                        nonzero++;
-
-                        if (prec > 2 * FLINT_BITS)
-                        {
-                            slong bot;
-                            bot = (xexp + yexp) - (ARF_SIZE(xm) + ARF_SIZE(ym)) * FLINT_BITS;
-                            min_exp = FLINT_MIN(min_exp, bot);
-                        }
-                    }
-                }
-            }
-
-            if (xoff == yoff)
-            {
-                re_nonzero = nonzero;
-                re_max_exp = max_exp;
-                re_min_exp = min_exp;
-            }
-            else
-            {
-                im_nonzero = nonzero;
-                im_max_exp = max_exp;
-                im_min_exp = min_exp;
-            }
-        }
-    }
-
-    re_prec = prec;
-    im_prec = prec;
-
-    if (re_max_exp == WORD_MIN && im_max_exp == WORD_MIN)
-    {
-        arf_zero(arb_midref(acb_realref(res)));
-        arf_zero(arb_midref(acb_imagref(res)));
-        return;
-    }
-
-    /* The midpoint sum is zero. */
-    if (re_max_exp == WORD_MIN)
-    {
-        re_prec = 2;
-    }
-    else
-    {
-        if (re_min_exp != WORD_MAX)
-            re_prec = FLINT_MIN(re_prec, re_max_exp - re_min_exp + MAG_BITS);
-        re_prec = FLINT_MAX(re_prec, 2);
-    }
-
-    if (im_max_exp == WORD_MIN)
-    {
-        im_prec = 2;
-    }
-    else
-    {
-        if (re_min_exp != WORD_MAX)
-            im_prec = FLINT_MIN(im_prec, im_max_exp - im_min_exp + MAG_BITS);
-        im_prec = FLINT_MAX(im_prec, 2);
-    }
-
-    extend = FLINT_BIT_COUNT(re_nonzero) + 1;
-    padding = 4 + FLINT_BIT_COUNT(len);
-    re_sn = (re_prec + extend + padding + FLINT_BITS - 1) / FLINT_BITS;
-    re_sn = FLINT_MAX(re_sn, 2);
-    re_sum_exp = re_max_exp + extend;
-
-    extend = FLINT_BIT_COUNT(im_nonzero) + 1;
-    padding = 4 + FLINT_BIT_COUNT(len);
-    im_sn = (im_prec + extend + padding + FLINT_BITS - 1) / FLINT_BITS;
-    im_sn = FLINT_MAX(im_sn, 2);
-    im_sum_exp = im_max_exp + extend;
-
-    /* We need sn + 1 limb for the sum (sn limbs + 1 dummy limb
-       for carry or borrow that avoids an extra branch). We need
-       2 * (sn + 2) limbs to store the product of two numbers
-       with up to (sn + 2) limbs, plus 1 extra limb for shifting
-       the product. */
-    alloc = (re_sn + 1) + (im_sn + 1) + 2 * (FLINT_MAX(re_sn, im_sn) + 2) + 1;
-    ARF_ADD_TMP_ALLOC(re_sum, alloc)
-    im_sum = re_sum + (re_sn + 1);
-    tmp = im_sum + (im_sn + 1);
-
-    /* Set sum to 0 */
     re_serr = 0;
-    for (j = 0; j < re_sn + 1; j++)
-        re_sum[j] = 0;
     im_serr = 0;
-    for (j = 0; j < im_sn + 1; j++)
-        im_sum[j] = 0;
-
-    if (initial != NULL)
-    {
-        xm = arb_midref(acb_realref(initial));
-
-        ARB_DOT_ADD(re_sum, re_serr, re_sn, re_sum_exp, subtract, xm);
-
-        xm = arb_midref(acb_imagref(initial));
-
-        ARB_DOT_ADD(im_sum, im_serr, im_sn, im_sum_exp, subtract, xm);
-    }
 
     use_gauss = NULL;
 
@@ -547,7 +370,7 @@ acb_approx_dot(acb_t res, const acb_t initial, int subtract, acb_srcptr x, slong
                 sum_exp = re_sum_exp;
                 sum = re_sum;
                 sn = re_sn;
-                if (re_max_exp == WORD_MIN)
+                if (A->re_zero)
                     continue;
             }
             else
@@ -555,7 +378,7 @@ acb_approx_dot(acb_t res, const acb_t initial, int subtract, acb_srcptr x, slong
                 sum_exp = im_sum_exp;
                 sum = im_sum;
                 sn = im_sn;
-                if (im_max_exp == WORD_MIN)
+                if (A->im_zero)
                     continue;
             }
 
@@ -701,10 +524,321 @@ acb_approx_dot(acb_t res, const acb_t initial, int subtract, acb_srcptr x, slong
         }
     }
 
+    if (use_gauss != NULL)
+        flint_free(use_gauss);
+}
+
+typedef struct
+{
+    const acb_dot_align_struct * align;
+    mp_ptr re_sums;
+    mp_ptr im_sums;
+    acb_srcptr x;
+    slong xstep;
+    acb_srcptr y;
+    slong ystep;
+    slong len;
+}
+dot_work_t;
+
+static void
+dot_worker(slong i, dot_work_t * work)
+{
+    const acb_dot_align_struct * A = work->align;
+    slong start, n;
+    mp_ptr tmp;
+
+    start = i * ARB_DOT_THREAD_CHUNK;
+    n = FLINT_MIN(ARB_DOT_THREAD_CHUNK, work->len - start);
+
+    tmp = flint_malloc(sizeof(mp_limb_t) * (2 * (FLINT_MAX(A->re_sn, A->im_sn) + 2) + 1));
+
+    _acb_approx_dot_sum_terms(work->re_sums + i * (A->re_sn + 1),
+        work->im_sums + i * (A->im_sn + 1), tmp, A,
+        work->x + start * work->xstep, work->xstep,
+        work->y + start * work->ystep, work->ystep, n);
+
+    flint_free(tmp);
+}
+
+static void
+_acb_approx_dot_sum_terms_threaded(mp_ptr re_sum, mp_ptr im_sum, mp_ptr tmp,
+    const acb_dot_align_struct * A,
+    acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len)
+{
+    dot_work_t work;
+    slong i, num;
+
+    num = (len + ARB_DOT_THREAD_CHUNK - 1) / ARB_DOT_THREAD_CHUNK;
+
+    if (num <= 1 || arb_flint_get_num_available_threads() <= 1)
+    {
+        _acb_approx_dot_sum_terms(re_sum, im_sum, tmp, A, x, xstep, y, ystep, len);
+        return;
+    }
+
+    work.align = A;
+    work.re_sums = flint_calloc(num * (A->re_sn + 1), sizeof(mp_limb_t));
+    work.im_sums = flint_calloc(num * (A->im_sn + 1), sizeof(mp_limb_t));
+    work.x = x;
+    work.xstep = xstep;
+    work.y = y;
+    work.ystep = ystep;
+    work.len = len;
+
+    flint_parallel_do((do_func_t) dot_worker, &work, num, -1, FLINT_PARALLEL_UNIFORM);
+
+    for (i = 0; i < num; i++)
+    {
+        mpn_add_n(re_sum, re_sum, work.re_sums + i * (A->re_sn + 1), A->re_sn);
+        mpn_add_n(im_sum, im_sum, work.im_sums + i * (A->im_sn + 1), A->im_sn);
+    }
+
+    flint_free(work.re_sums);
+    flint_free(work.im_sums);
+}
+
+/* If threaded is set, the terms may be summed in parallel; this does
+   not change the result. */
+void
+_acb_approx_dot(acb_t res, const acb_t initial, int subtract, acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len, slong prec, int threaded)
+{
+    slong i, j, padding, extend;
+    slong xexp, yexp;
+    slong re_nonzero, im_nonzero;
+    slong re_max_exp, re_min_exp, re_sum_exp;
+    slong im_max_exp, im_min_exp, im_sum_exp;
+    slong re_prec, im_prec;
+    int xnegative;
+    mp_size_t xn, re_sn, im_sn, alloc;
+    flint_bitcnt_t shift;
+    arb_srcptr xi, yi;
+    arf_srcptr xm, ym;
+    mp_limb_t re_serr, im_serr;   /* Sum over arithmetic errors */
+    mp_ptr tmp, re_sum, im_sum;   /* Workspace */
+    slong xoff, yoff;
+    acb_dot_align_struct align;
+    ARF_ADD_TMP_DECL;
+
+    /* todo: fast fma and fmma (len=2) code */
+    if (len <= 1)
+    {
+        acb_approx_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
+        return;
+    }
+
+    /* Number of nonzero midpoint terms in sum. */
+    re_nonzero = 0;
+    im_nonzero = 0;
+
+    /* Terms are bounded by 2^max_exp (with WORD_MIN = -infty) */
+    re_max_exp = WORD_MIN;
+    im_max_exp = WORD_MIN;
+
+    /* Used to reduce the precision. */
+    re_min_exp = WORD_MAX;
+    im_min_exp = WORD_MAX;
+
+    /* Account for the initial term. */
+    if (initial != NULL)
+    {
+        if (!ARF_IS_LAGOM(arb_midref(acb_realref(initial))) || !ARF_IS_LAGOM(arb_midref(acb_imagref(initial))))
+        {
+            acb_approx_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
+            return;
+        }
+
+        xm = arb_midref(acb_realref(initial));
+
+        if (!arf_is_special(xm))
+        {
+            re_max_exp = ARF_EXP(xm);
+            re_nonzero++;
+
+            if (prec > 2 * FLINT_BITS)
+                re_min_exp = ARF_EXP(xm) - ARF_SIZE(xm) * FLINT_BITS;
+        }
+
+        xm = arb_midref(acb_imagref(initial));
+
+        if (!arf_is_special(xm))
+        {
+            im_max_exp = ARF_EXP(xm);
+            im_nonzero++;
+
+            if (prec > 2 * FLINT_BITS)
+                im_min_exp = ARF_EXP(xm) - ARF_SIZE(xm) * FLINT_BITS;
+        }
+    }
+
+    for (xoff = 0; xoff < 2; xoff++)
+    {
+        for (yoff = 0; yoff < 2; yoff++)
+        {
+            slong nonzero, max_exp, min_exp;
+
+            if (xoff == yoff)
+            {
+                nonzero = re_nonzero;
+                max_exp = re_max_exp;
+                min_exp = re_min_exp;
+            }
+            else
+            {
+                nonzero = im_nonzero;
+                max_exp = im_max_exp;
+                min_exp = im_min_exp;
+            }
+
+            /* Determine maximum exponents for the main sum and the radius sum. */
+            for (i = 0; i < len; i++)
+            {
+                xi = ((arb_srcptr) x) + 2 * i * xstep + xoff;
+                yi = ((arb_srcptr) y) + 2 * i * ystep + yoff;
+
+                /* Fallback for huge exponents or non-finite values. */
+                if (!ARF_IS_LAGOM(arb_midref(xi)) || !ARF_IS_LAGOM(arb_midref(yi)))
+                {
+                    acb_approx_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
+                    return;
+                }
+
+                xm = arb_midref(xi);
+                ym = arb_midref(yi);
+
+                /* (xm+xr)(ym+yr) = xm ym + [xr ym + xm yr + xr yr] */
+                if (!arf_is_special(xm))
+                {
+                    xexp = ARF_EXP(xm);
+
+                    if (!arf_is_special(ym))
+                    {
+                        yexp = ARF_EXP(ym);
+
+                        max_exp = FLINT_MAX(max_exp, xexp + yexp);
+                        nonzero++;
+
+                        if (prec > 2 * FLINT_BITS)
+                        {
+                            slong bot;
+                            bot = (xexp + yexp) - (ARF_SIZE(xm) + ARF_SIZE(ym)) * FLINT_BITS;
+                            min_exp = FLINT_MIN(min_exp, bot);
+                        }
+                    }
+                }
+            }
+
+            if (xoff == yoff)
+            {
+                re_nonzero = nonzero;
+                re_max_exp = max_exp;
+                re_min_exp = min_exp;
+            }
+            else
+            {
+                im_nonzero = nonzero;
+                im_max_exp = max_exp;
+                im_min_exp = min_exp;
+            }
+        }
+    }
+
+    re_prec = prec;
+    im_prec = prec;
+
+    if (re_max_exp == WORD_MIN && im_max_exp == WORD_MIN)
+    {
+        arf_zero(arb_midref(acb_realref(res)));
+        arf_zero(arb_midref(acb_imagref(res)));
+        return;
+    }
+
+    /* The midpoint sum is zero. */
+    if (re_max_exp == WORD_MIN)
+    {
+        re_prec = 2;
+    }
+    else
+    {
+        if (re_min_exp != WORD_MAX)
+            re_prec = FLINT_MIN(re_prec, re_max_exp - re_min_exp + MAG_BITS);
+        re_prec = FLINT_MAX(re_prec, 2);
+    }
+
+    if (im_max_exp == WORD_MIN)
+    {
+        im_prec = 2;
+    }
+    else
+    {
+        if (re_min_exp != WORD_MAX)
+            im_prec = FLINT_MIN(im_prec, im_max_exp - im_min_exp + MAG_BITS);
+        im_prec = FLINT_MAX(im_prec, 2);
+    }
+
+    extend = FLINT_BIT_COUNT(re_nonzero) + 1;
+    padding = 4 + FLINT_BIT_COUNT(len);
+    re_sn = (re_prec + extend + padding + FLINT_BITS - 1) / FLINT_BITS;
+    re_sn = FLINT_MAX(re_sn, 2);
+    re_sum_exp = re_max_exp + extend;
+
+    extend = FLINT_BIT_COUNT(im_nonzero) + 1;
+    padding = 4 + FLINT_BIT_COUNT(len);
+    im_sn = (im_prec + extend + padding + FLINT_BITS - 1) / FLINT_BITS;
+    im_sn = FLINT_MAX(im_sn, 2);
+    im_sum_exp = im_max_exp + extend;
+
+    /* We need sn + 1 limb for the sum (sn limbs + 1 dummy limb
+       for carry or borrow that avoids an extra branch). We need
+       2 * (sn + 2) limbs to store the product of two numbers
+       with up to (sn + 2) limbs, plus 1 extra limb for shifting
+       the product. */
+    alloc = (re_sn + 1) + (im_sn + 1) + 2 * (FLINT_MAX(re_sn, im_sn) + 2) + 1;
+    ARF_ADD_TMP_ALLOC(re_sum, alloc)
+    im_sum = re_sum + (re_sn + 1);
+    tmp = im_sum + (im_sn + 1);
+
+    /* Set sum to 0 */
+    re_serr = 0;
+    for (j = 0; j < re_sn + 1; j++)
+        re_sum[j] = 0;
+    im_serr = 0;
+    for (j = 0; j < im_sn + 1; j++)
+        im_sum[j] = 0;
+
+    if (initial != NULL)
+    {
+        xm = arb_midref(acb_realref(initial));
+
+        ARB_DOT_ADD(re_sum, re_serr, re_sn, re_sum_exp, subtract, xm);
+
+        xm = arb_midref(acb_imagref(initial));
+
+        ARB_DOT_ADD(im_sum, im_serr, im_sn, im_sum_exp, subtract, xm);
+    }
+
+    align.re_sn = re_sn;
+    align.im_sn = im_sn;
+    align.re_sum_exp = re_sum_exp;
+    align.im_sum_exp = im_sum_exp;
+    align.re_prec = re_prec;
+    align.im_prec = im_prec;
+    align.re_zero = (re_max_exp == WORD_MIN);
+    align.im_zero = (im_max_exp == WORD_MIN);
+
+    if (threaded)
+        _acb_approx_dot_sum_terms_threaded(re_sum, im_sum, tmp, &align, x, xstep, y, ystep, len);
+    else
+        _acb_approx_dot_sum_terms(re_sum, im_sum, tmp, &align, x, xstep, y, ystep, len);
+
     _arb_dot_output(acb_realref(res), re_sum, re_sn, subtract, re_sum_exp, re_prec);
     _arb_dot_output(acb_imagref(res), im_sum, im_sn, subtract, im_sum_exp, im_prec);
 
     ARF_ADD_TMP_FREE(re_sum, alloc);
-    if (use_gauss != NULL)
-        flint_free(use_gauss);
+}
+
+void
+acb_approx_dot(acb_t res, const acb_t initial, int subtract, acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len, slong prec)
+{
+    _acb_approx_dot(res, initial, subtract, x, xstep, y, ystep, len, prec, 0);
 }
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb.h"
 #include "flint/longlong.h"
 
@@ -281,666 +282,841 @@ _arf_complex_mul_gauss(arf_t e, arf_t f, const arf_t a, const arf_t b,
 ARB_DLL slong acb_dot_gauss_dot_cutoff = 128;
 #define GAUSS_CUTOFF acb_dot_gauss_dot_cutoff
 
-void
-acb_dot(acb_t res, const acb_t initial, int subtract, acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len, slong prec)
+/* Alignment of the real and imaginary fixed-point sums, which is
+   determined by all the terms. */
+typedef struct
 {
-    slong i, j, padding, extend;
-    slong xexp, yexp, exp;
-    slong re_nonzero, im_nonzero;
-    slong re_max_exp, re_min_exp, re_sum_exp;
-    slong im_max_exp, im_min_exp, im_sum_exp;
-    slong re_srad_exp, re_max_rad_exp;
-    slong im_srad_exp, im_max_rad_exp;
+    mp_size_t re_sn, im_sn;
+    slong re_sum_exp, im_sum_exp;
+    slong re_srad_exp, im_srad_exp;
     slong re_prec, im_prec;
-    slong xrexp, yrexp;
+    int re_zero, im_zero;
+}
+acb_dot_align_struct;
+
+/* Adds the terms x[i] y[i], 0 <= i < len, to the real and imaginary
+   fixed-point sums. As in arb/dot.c, the sums are exact modulo
+   2^(sn * FLINT_BITS) and the error counters are plain sums, so the
+   terms can be split into ranges that are summed separately and the
+   partial sums added without changing the result. */
+static void
+_acb_dot_sum_terms(mp_ptr re_sum, mp_limb_t * re_serr_ptr, uint64_t * re_srad_ptr,
+    mp_ptr im_sum, mp_limb_t * im_serr_ptr, uint64_t * im_srad_ptr,
+    mp_ptr tmp, const acb_dot_align_struct * A,
+    acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len)
+{
+    slong i, xexp, yexp, exp, xrexp, yrexp;
+    slong re_sum_exp, im_sum_exp, re_srad_exp, im_srad_exp, re_prec, im_prec;
     int xnegative, ynegative;
-    mp_size_t xn, yn, re_sn, im_sn, alloc;
+    mp_size_t xn, yn, re_sn, im_sn;
     flint_bitcnt_t shift;
     arb_srcptr xi, yi;
     arf_srcptr xm, ym;
     mag_srcptr xr, yr;
     mp_limb_t xtop, ytop;
     mp_limb_t xrad, yrad;
-    mp_limb_t re_serr, im_serr;   /* Sum over arithmetic errors */
-    uint64_t re_srad, im_srad;    /* Sum over propagated errors */
-    mp_ptr tmp, re_sum, im_sum;   /* Workspace */
+    mp_limb_t re_serr, im_serr;
+    uint64_t re_srad, im_srad;
     slong xoff, yoff;
     char * use_gauss;
-    ARF_ADD_TMP_DECL;
-
-    /* todo: fast fma and fmma (len=2) code */
-    if (len <= 1)
-    {
-        if (initial == NULL)
-        {
-            if (len <= 0)
-                acb_zero(res);
-            else
-            {
-                acb_mul(res, x, y, prec);
-                if (subtract)
-                    acb_neg(res, res);
-            }
-            return;
-        }
-        else if (len <= 0)
-        {
-            acb_set_round(res, initial, prec);
-            return;
-        }
-    }
 
-    /* Number of nonzero midpoint terms in sum. */
-    re_nonzero = 0;
-    im_nonzero = 0;
+    re_sn = A->re_sn;
+    im_sn = A->im_sn;
+    re_sum_exp = A->re_sum_exp;
+    im_sum_exp = A->im_sum_exp;
+    re_srad_exp = A->re_srad_exp;
+    im_srad_exp = A->im_srad_exp;
+    re_prec = A->re_prec;
+    im_prec = A->im_prec;
 
-    /* Terms are bounded by 2^max_exp (with WORD_MIN = -infty) */
-    re_max_exp = WORD_MIN;
-    im_max_exp = WORD_MIN;
+    re_serr = *re_serr_ptr;
+    im_serr = *im_serr_ptr;
+    re_srad = *re_srad_ptr;
+    im_srad = *im_srad_ptr;
 
-    /* Propagated error terms are bounded by 2^max_rad_exp */
-    re_max_rad_exp = WORD_MIN;
-    im_max_rad_exp = WORD_MIN;
+    /*
+    Look for terms to process using the Gauss multiplication formula.
+    If any such terms are found, we mask the ith entry in use_gauss
+    so that they will be skipped in the main loop.
+    Important: the cutoffs must be such that the fast case
+    (xn <= 2, yn <= 2, sn <= 3) is not hit below and the mask
+    check is done.
 
-    /* Used to reduce the precision. */
-    re_min_exp = WORD_MAX;
-    im_min_exp = WORD_MAX;
+    The cutoffs below are not optimal in the generic case; also, it
+    would be nicer to have both mulhigh and Gauss here. A more elegant
+    solution would be to write a fallback version of acb_dot_simple
+    where acb_addmul does the right thing.
+    */
+    use_gauss = NULL;
 
-    /* Account for the initial term. */
-    if (initial != NULL)
+    if (re_prec >= GAUSS_CUTOFF * FLINT_BITS &&
+        im_prec >= GAUSS_CUTOFF * FLINT_BITS)
     {
-        if (!ARB_IS_LAGOM(acb_realref(initial)) || !ARB_IS_LAGOM(acb_imagref(initial)))
-        {
-            acb_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
-            return;
-        }
-
-        xm = arb_midref(acb_realref(initial));
-        xr = arb_radref(acb_realref(initial));
+        arf_t e, f;
 
-        if (!arf_is_special(xm))
+        for (i = 0; i < len; i++)
         {
-            re_max_exp = ARF_EXP(xm);
-            re_nonzero++;
+            arb_srcptr ai, bi, ci, di;
+            mp_size_t an, bn, cn, dn;
+            slong aexp, bexp, cexp, dexp;
 
-            if (prec > 2 * FLINT_BITS)
-                re_min_exp = ARF_EXP(xm) - ARF_SIZE(xm) * FLINT_BITS;
-        }
+            ai = ((arb_srcptr) x) + 2 * i * xstep;
+            bi = ((arb_srcptr) x) + 2 * i * xstep + 1;
+            ci = ((arb_srcptr) y) + 2 * i * ystep;
+            di = ((arb_srcptr) y) + 2 * i * ystep + 1;
 
-        if (!mag_is_special(xr))
-            re_max_rad_exp = MAG_EXP(xr);
+            an = ARF_SIZE(arb_midref(ai));
+            bn = ARF_SIZE(arb_midref(bi));
+            cn = ARF_SIZE(arb_midref(ci));
+            dn = ARF_SIZE(arb_midref(di));
 
-        xm = arb_midref(acb_imagref(initial));
-        xr = arb_radref(acb_imagref(initial));
+            aexp = ARF_EXP(arb_midref(ai));
+            bexp = ARF_EXP(arb_midref(bi));
+            cexp = ARF_EXP(arb_midref(ci));
+            dexp = ARF_EXP(arb_midref(di));
 
-        if (!arf_is_special(xm))
-        {
-            im_max_exp = ARF_EXP(xm);
-            im_nonzero++;
+            if (an >= GAUSS_CUTOFF && bn >= GAUSS_CUTOFF &&
+                bn >= GAUSS_CUTOFF && cn >= GAUSS_CUTOFF &&
+                FLINT_ABS(an - bn) <= 2 &&
+                FLINT_ABS(cn - dn) <= 2 &&
+                FLINT_ABS(aexp - bexp) <= 64 &&
+                FLINT_ABS(cexp - dexp) <= 64 &&
+                re_sum_exp - (aexp + cexp) < 0.1 * re_prec &&
+                im_sum_exp - (aexp + dexp) < 0.1 * im_prec &&
+                an + cn < 2.2 * re_sn && an + dn < 2.2 * im_sn)
+            {
+                if (use_gauss == NULL)
+                {
+                    use_gauss = flint_calloc(len, sizeof(char));
+                    arf_init(e);
+                    arf_init(f);
+                }
 
-            if (prec > 2 * FLINT_BITS)
-                im_min_exp = ARF_EXP(xm) - ARF_SIZE(xm) * FLINT_BITS;
+                use_gauss[i] = 1;
+                _arf_complex_mul_gauss(e, f, arb_midref(ai), arb_midref(bi), arb_midref(ci), arb_midref(di));
+                ARB_DOT_ADD(re_sum, re_serr, re_sn, re_sum_exp, 0, e);
+                ARB_DOT_ADD(im_sum, im_serr, im_sn, im_sum_exp, 0, f);
+            }
         }
 
-        if (!mag_is_special(xr))
-            im_max_rad_exp = MAG_EXP(xr);
+        if (use_gauss != NULL)
+        {
+            arf_clear(e);
+            arf_clear(f);
+        }
     }
 
     for (xoff = 0; xoff < 2; xoff++)
     {
         for (yoff = 0; yoff < 2; yoff++)
         {
-            slong nonzero, max_exp, min_exp, max_rad_exp;
+            slong sum_exp, srad_exp;
+            mp_ptr sum;
+            mp_size_t sn;
+            mp_limb_t serr;
+            uint64_t srad;
+            int flipsign;
 
             if (xoff == yoff)
             {
-                nonzero = re_nonzero;
-                max_exp = re_max_exp;
-                min_exp = re_min_exp;
-                max_rad_exp = re_max_rad_exp;
+                sum_exp = re_sum_exp;
+                srad_exp = re_srad_exp;
+                sum = re_sum;
+                sn = re_sn;
+                if (A->re_zero)
+                    continue;
             }
             else
             {
-                nonzero = im_nonzero;
-                max_exp = im_max_exp;
-                min_exp = im_min_exp;
-                max_rad_exp = im_max_rad_exp;
+                sum_exp = im_sum_exp;
+                srad_exp = im_srad_exp;
+                sum = im_sum;
+                sn = im_sn;
+                if (A->im_zero)
+                    continue;
             }
 
-            /* Determine maximum exponents for the main sum and the radius sum. */
+            serr = 0;
+            srad = 0;
+            flipsign = (xoff + yoff == 2);
+
             for (i = 0; i < len; i++)
             {
                 xi = ((arb_srcptr) x) + 2 * i * xstep + xoff;
                 yi = ((arb_srcptr) y) + 2 * i * ystep + yoff;
 
-                /* Fallback for huge exponents or non-finite values. */
-                if (!ARB_IS_LAGOM(xi) || !ARB_IS_LAGOM(yi))
-                {
-                    acb_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
-                    return;
-                }
-
                 xm = arb_midref(xi);
                 ym = arb_midref(yi);
                 xr = arb_radref(xi);
                 yr = arb_radref(yi);
 
-                /* (xm+xr)(ym+yr) = xm ym + [xr ym + xm yr + xr yr] */
-                if (!arf_is_special(xm))
+                /* The midpoints of x[i] and y[i] are both nonzero. */
+                if (!arf_is_special(xm) && !arf_is_special(ym))
                 {
                     xexp = ARF_EXP(xm);
+                    xn = ARF_SIZE(xm);
+                    xnegative = ARF_SGNBIT(xm);
 
-                    if (!arf_is_special(ym))
-                    {
-                        yexp = ARF_EXP(ym);
-
-                        max_exp = FLINT_MAX(max_exp, xexp + yexp);
-                        nonzero++;
-
-                        if (prec > 2 * FLINT_BITS)
-                        {
-                            slong bot;
-                            bot = (xexp + yexp) - (ARF_SIZE(xm) + ARF_SIZE(ym)) * FLINT_BITS;
-                            min_exp = FLINT_MIN(min_exp, bot);
-                        }
+                    yexp = ARF_EXP(ym);
+                    yn = ARF_SIZE(ym);
+                    ynegative = ARF_SGNBIT(ym);
 
-                        if (!mag_is_special(xr))
-                        {
-                            xrexp = MAG_EXP(xr);
-                            max_rad_exp = FLINT_MAX(max_rad_exp, yexp + xrexp);
+                    exp = xexp + yexp;
+                    shift = sum_exp - exp;
 
-                            if (!mag_is_special(yr))
-                            {
-                                yrexp = MAG_EXP(yr);
-                                max_rad_exp = FLINT_MAX(max_rad_exp, xexp + yrexp);
-                                max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yrexp);
-                            }
-                        }
-                        else
-                        {
-                            if (!mag_is_special(yr))
-                            {
-                                yrexp = MAG_EXP(yr);
-                                max_rad_exp = FLINT_MAX(max_rad_exp, xexp + yrexp);
-                            }
-                        }
-                    }
-                    else  /* if y = 0, something can happen only if yr != 0 */
+                    if (shift >= sn * FLINT_BITS)
                     {
-                        if (!mag_is_special(yr))
-                        {
-                            yrexp = MAG_EXP(yr);
-                            max_rad_exp = FLINT_MAX(max_rad_exp, xexp + yrexp);
-
-                            if (!mag_is_special(xr))
-                            {
-                                xrexp = MAG_EXP(xr);
-                                max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yrexp);
-                            }
-                        }
+                        /* We may yet need the top limbs for bounds. */
+                        ARF_GET_TOP_LIMB(xtop, xm);
+                        ARF_GET_TOP_LIMB(ytop, ym);
+                        serr++;
                     }
-                }
-                else  /* if x = 0, something can happen only if xr != 0 */
-                {
-                    if (!mag_is_special(xr))
+                    else if (xn <= 2 && yn <= 2 && sn <= 3)
                     {
-                        xrexp = MAG_EXP(xr);
+                        mp_limb_t x1, x0, y1, y0;
+                        mp_limb_t u3, u2, u1, u0;
 
-                        if (!arf_is_special(ym))
+                        if (xn == 1 && yn == 1)
                         {
-                            yexp = ARF_EXP(ym);
-                            max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yexp);
+                            xtop = ARF_NOPTR_D(xm)[0];
+                            ytop = ARF_NOPTR_D(ym)[0];
+                            umul_ppmm(u3, u2, xtop, ytop);
+                            u1 = u0 = 0;
                         }
-
-                        if (!mag_is_special(yr))
+                        else if (xn == 2 && yn == 2)
                         {
-                            yrexp = MAG_EXP(yr);
-                            max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yrexp);
+                            x0 = ARF_NOPTR_D(xm)[0];
+                            x1 = ARF_NOPTR_D(xm)[1];
+                            y0 = ARF_NOPTR_D(ym)[0];
+                            y1 = ARF_NOPTR_D(ym)[1];
+                            xtop = x1;
+                            ytop = y1;
+                            nn_mul_2x2(u3, u2, u1, u0, x1, x0, y1, y0);
+                        }
+                        else if (xn == 1)
+                        {
+                            x0 = ARF_NOPTR_D(xm)[0];
+                            y0 = ARF_NOPTR_D(ym)[0];
+                            y1 = ARF_NOPTR_D(ym)[1];
+                            xtop = x0;
+                            ytop = y1;
+                            nn_mul_2x1(u3, u2, u1, y1, y0, x0);
+                            u0 = 0;
+                        }
+                        else
+                        {
+                            x0 = ARF_NOPTR_D(xm)[0];
+                            x1 = ARF_NOPTR_D(xm)[1];
+                            y0 = ARF_NOPTR_D(ym)[0];
+                            xtop = x1;
+                            ytop = y0;
+                            nn_mul_2x1(u3, u2, u1, x1, x0, y0);
+                            u0 = 0;
+                        }
+
+                        if (sn == 2)
+                        {
+                            if (shift < FLINT_BITS)
+                            {
+                                serr += ((u2 << (FLINT_BITS - shift)) != 0) || (u1 != 0) || (u0 != 0);
+                                u2 = (u2 >> shift) | (u3 << (FLINT_BITS - shift));
+                                u3 = (u3 >> shift);
+                            }
+                            else if (shift == FLINT_BITS)
+                            {
+                                serr += (u2 != 0) || (u1 != 0) || (u0 != 0);
+                                u2 = u3;
+                                u3 = 0;
+                            }
+                            else /* FLINT_BITS < shift < 2 * FLINT_BITS */
+                            {
+                                serr += ((u3 << (2 * FLINT_BITS - shift)) != 0) || (u2 != 0) || (u1 != 0) || (u0 != 0);
+                                u2 = (u3 >> (shift - FLINT_BITS));
+                                u3 = 0;
+                            }
+
+                            if (xnegative ^ ynegative ^ flipsign)
+                                sub_ddmmss(sum[1], sum[0], sum[1], sum[0], u3, u2);
+                            else
+                                add_ssaaaa(sum[1], sum[0], sum[1], sum[0], u3, u2);
+                        }
+                        else if (sn == 3)
+                        {
+                            if (shift < FLINT_BITS)
+                            {
+                                serr += ((u1 << (FLINT_BITS - shift)) != 0) || (u0 != 0);
+                                u1 = (u1 >> shift) | (u2 << (FLINT_BITS - shift));
+                                u2 = (u2 >> shift) | (u3 << (FLINT_BITS - shift));
+                                u3 = (u3 >> shift);
+                            }
+                            else if (shift == FLINT_BITS)
+                            {
+                                serr += (u1 != 0) || (u0 != 0);
+                                u1 = u2;
+                                u2 = u3;
+                                u3 = 0;
+                            }
+                            else if (shift < 2 * FLINT_BITS)
+                            {
+                                serr += ((u2 << (2 * FLINT_BITS - shift)) != 0) || (u1 != 0) || (u0 != 0);
+                                u1 = (u3 << (2 * FLINT_BITS - shift)) | (u2 >> (shift - FLINT_BITS));
+                                u2 = (u3 >> (shift - FLINT_BITS));
+                                u3 = 0;
+                            }
+                            else if (shift == 2 * FLINT_BITS)
+                            {
+                                serr += (u2 != 0) || (u1 != 0) || (u0 != 0);
+                                u1 = u3;
+                                u2 = 0;
+                                u3 = 0;
+                            }
+                            else  /* 2 * FLINT_BITS < shift < 3 * FLINT_BITS */
+                            {
+                                serr += ((u3 << (3 * FLINT_BITS - shift)) != 0) || (u2 != 0) || (u1 != 0) || (u0 != 0);
+                                u1 = (u3 >> (shift - 2 * FLINT_BITS));
+                                u2 = 0;
+                                u3 = 0;
+                            }
+
+                            if (xnegative ^ ynegative ^ flipsign)
+                                sub_dddmmmsss(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
+                            else
+                                add_sssaaaaaa(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
                         }
                     }
+                    else
+                    {
+                        mp_srcptr xptr, yptr;
+
+                        xptr = (xn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(xm) : ARF_PTR_D(xm);
+                        yptr = (yn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(ym) : ARF_PTR_D(ym);
+
+                        xtop = xptr[xn - 1];
+                        ytop = yptr[yn - 1];
+
+                        if (use_gauss == NULL || use_gauss[i] == 0)
+                            _arb_dot_addmul_generic(sum, &serr, tmp, sn, xptr, xn, yptr, yn, xnegative ^ ynegative ^ flipsign, shift);
+                    }
+
+                    xrad = MAG_MAN(xr);
+                    yrad = MAG_MAN(yr);
+
+                    if (xrad != 0 && yrad != 0)
+                    {
+                        xrexp = MAG_EXP(xr);
+                        yrexp = MAG_EXP(yr);
+
+                        RAD_ADDMUL(srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
+                        RAD_ADDMUL(srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
+                        RAD_ADDMUL(srad, srad_exp, xrad, yrad, xrexp + yrexp);
+                    }
+                    else if (xrad != 0)
+                    {
+                        xrexp = MAG_EXP(xr);
+                        RAD_ADDMUL(srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
+                    }
+                    else if (yrad != 0)
+                    {
+                        yrexp = MAG_EXP(yr);
+                        RAD_ADDMUL(srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
+                    }
+                }
+                else
+                {
+                    xrad = MAG_MAN(xr);
+                    yrad = MAG_MAN(yr);
+
+                    xexp = ARF_EXP(xm);
+                    yexp = ARF_EXP(ym);
+
+                    xrexp = MAG_EXP(xr);
+                    yrexp = MAG_EXP(yr);
+
+                    /* (xm+xr)(ym+yr) = xm ym + [xm yr + ym xr + xr yr] */
+                    if (yrad && !arf_is_special(xm))
+                    {
+                        ARF_GET_TOP_LIMB(xtop, xm);
+                        RAD_ADDMUL(srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
+                    }
+
+                    if (xrad && !arf_is_special(ym))
+                    {
+                        ARF_GET_TOP_LIMB(ytop, ym);
+                        RAD_ADDMUL(srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
+                    }
+
+                    if (xrad && yrad)
+                    {
+                        RAD_ADDMUL(srad, srad_exp, xrad, yrad, xrexp + yrexp);
+                    }
                 }
             }
 
             if (xoff == yoff)
             {
-                re_nonzero = nonzero;
-                re_max_exp = max_exp;
-                re_min_exp = min_exp;
-                re_max_rad_exp = max_rad_exp;
+                re_serr += serr;
+                re_srad += srad;
             }
             else
             {
-                im_nonzero = nonzero;
-                im_max_exp = max_exp;
-                im_min_exp = min_exp;
-                im_max_rad_exp = max_rad_exp;
+                im_serr += serr;
+                im_srad += srad;
             }
         }
     }
 
-    re_prec = prec;
-    im_prec = prec;
+    *re_serr_ptr = re_serr;
+    *im_serr_ptr = im_serr;
+    *re_srad_ptr = re_srad;
+    *im_srad_ptr = im_srad;
 
-    if (re_max_exp == WORD_MIN && re_max_rad_exp == WORD_MIN &&
-        im_max_exp == WORD_MIN && im_max_rad_exp == WORD_MIN)
+    if (use_gauss != NULL)
+        flint_free(use_gauss);
+}
+
+typedef struct
+{
+    const acb_dot_align_struct * align;
+    mp_ptr re_sums;
+    mp_ptr im_sums;
+    mp_limb_t * re_serr;
+    mp_limb_t * im_serr;
+    uint64_t * re_srad;
+    uint64_t * im_srad;
+    acb_srcptr x;
+    slong xstep;
+    acb_srcptr y;
+    slong ystep;
+    slong len;
+}
+dot_work_t;
+
+static void
+dot_worker(slong i, dot_work_t * work)
+{
+    const acb_dot_align_struct * A = work->align;
+    slong start, n;
+    mp_ptr tmp;
+
+    start = i * ARB_DOT_THREAD_CHUNK;
+    n = FLINT_MIN(ARB_DOT_THREAD_CHUNK, work->len - start);
+
+    tmp = flint_malloc(sizeof(mp_limb_t) * (2 * (FLINT_MAX(A->re_sn, A->im_sn) + 2) + 1));
+
+    _acb_dot_sum_terms(work->re_sums + i * (A->re_sn + 1), work->re_serr + i, work->re_srad + i,
+        work->im_sums + i * (A->im_sn + 1), work->im_serr + i, work->im_srad + i,
+        tmp, A, work->x + start * work->xstep, work->xstep,
+        work->y + start * work->ystep, work->ystep, n);
+
+    flint_free(tmp);
+}
+
+/* Sums chunks of ARB_DOT_THREAD_CHUNK terms in parallel and adds the
+   chunk sums exactly. The result is identical to that of
+   _acb_dot_sum_terms. */
+static void
+_acb_dot_sum_terms_threaded(mp_ptr re_sum, mp_limb_t * re_serr, uint64_t * re_srad,
+    mp_ptr im_sum, mp_limb_t * im_serr, uint64_t * im_srad,
+    mp_ptr tmp, const acb_dot_align_struct * A,
+    acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len)
+{
+    dot_work_t work;
+    slong i, num;
+
+    num = (len + ARB_DOT_THREAD_CHUNK - 1) / ARB_DOT_THREAD_CHUNK;
+
+    if (num <= 1 || arb_flint_get_num_available_threads() <= 1)
     {
-        acb_zero(res);
+        _acb_dot_sum_terms(re_sum, re_serr, re_srad, im_sum, im_serr, im_srad,
+            tmp, A, x, xstep, y, ystep, len);
         return;
     }
 
-    /* The midpoint sum is zero. */
-    if (re_max_exp == WORD_MIN)
+    work.align = A;
+    work.re_sums = flint_calloc(num * (A->re_sn + 1), sizeof(mp_limb_t));
+    work.im_sums = flint_calloc(num * (A->im_sn + 1), sizeof(mp_limb_t));
+    work.re_serr = flint_calloc(num, sizeof(mp_limb_t));
+    work.im_serr = flint_calloc(num, sizeof(mp_limb_t));
+    work.re_srad = flint_calloc(num, sizeof(uint64_t));
+    work.im_srad = flint_calloc(num, sizeof(uint64_t));
+    work.x = x;
+    work.xstep = xstep;
+    work.y = y;
+    work.ystep = ystep;
+    work.len = len;
+
+    flint_parallel_do((do_func_t) dot_worker, &work, num, -1, FLINT_PARALLEL_UNIFORM);
+
+    for (i = 0; i < num; i++)
     {
-        re_prec = 2;
-    }
-    else
-    {
-        if (re_max_rad_exp != WORD_MIN)
-            re_prec = FLINT_MIN(re_prec, re_max_exp - re_max_rad_exp + MAG_BITS);
-        if (re_min_exp != WORD_MAX)
-            re_prec = FLINT_MIN(re_prec, re_max_exp - re_min_exp + MAG_BITS);
-        re_prec = FLINT_MAX(re_prec, 2);
+        mpn_add_n(re_sum, re_sum, work.re_sums + i * (A->re_sn + 1), A->re_sn);
+        mpn_add_n(im_sum, im_sum, work.im_sums + i * (A->im_sn + 1), A->im_sn);
+        *re_serr += work.re_serr[i];
+        *im_serr += work.im_serr[i];
+        *re_srad += work.re_srad[i];
+        *im_srad += work.im_srad[i];
     }
 
-    if (im_max_exp == WORD_MIN)
-    {
-        im_prec = 2;
-    }
-    else
-    {
-        if (im_max_rad_exp != WORD_MIN)
-            im_prec = FLINT_MIN(im_prec, im_max_exp - im_max_rad_exp + MAG_BITS);
-        if (re_min_exp != WORD_MAX)
-            im_prec = FLINT_MIN(im_prec, im_max_exp - im_min_exp + MAG_BITS);
-        im_prec = FLINT_MAX(im_prec, 2);
-    }
+    flint_free(work.re_sums);
+    flint_free(work.im_sums);
+    flint_free(work.re_serr);
+    flint_free(work.im_serr);
+    flint_free(work.re_srad);
+    flint_free(work.im_srad);
+}
 
-    extend = FLINT_BIT_COUNT(re_nonzero) + 1;
-    padding = 4 + FLINT_BIT_COUNT(len);
-    re_sn = (re_prec + extend + padding + FLINT_BITS - 1) / FLINT_BITS;
-    re_sn = FLINT_MAX(re_sn, 2);
-    re_sum_exp = re_max_exp + extend;
+/* If threaded is set, the terms may be summed in parallel; this does
+   not change the result. */
+void
+_acb_dot(acb_t res, const acb_t initial, int subtract, acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len, slong prec, int threaded)
+{
+    slong i, j, padding, extend;
+    slong xexp, yexp;
+    slong re_nonzero, im_nonzero;
+    slong re_max_exp, re_min_exp, re_sum_exp;
+    slong im_max_exp, im_min_exp, im_sum_exp;
+    slong re_srad_exp, re_max_rad_exp;
+    slong im_srad_exp, im_max_rad_exp;
+    slong re_prec, im_prec;
+    slong xrexp, yrexp;
+    int xnegative;
+    mp_size_t xn, re_sn, im_sn, alloc;
+    flint_bitcnt_t shift;
+    arb_srcptr xi, yi;
+    arf_srcptr xm, ym;
+    mag_srcptr xr, yr;
+    mp_limb_t xrad;
+    mp_limb_t re_serr, im_serr;   /* Sum over arithmetic errors */
+    uint64_t re_srad, im_srad;    /* Sum over propagated errors */
+    mp_ptr tmp, re_sum, im_sum;   /* Workspace */
+    slong xoff, yoff;
+    acb_dot_align_struct align;
+    ARF_ADD_TMP_DECL;
+
+    /* todo: fast fma and fmma (len=2) code */
+    if (len <= 1)
+    {
+        if (initial == NULL)
+        {
+            if (len <= 0)
+                acb_zero(res);
+            else
+            {
+                acb_mul(res, x, y, prec);
+                if (subtract)
+                    acb_neg(res, res);
+            }
+            return;
+        }
+        else if (len <= 0)
+        {
+            acb_set_round(res, initial, prec);
+            return;
+        }
+    }
 
-    extend = FLINT_BIT_COUNT(im_nonzero) + 1;
-    padding = 4 + FLINT_BIT_COUNT(len);
-    im_sn = (im_prec + extend + padding + FLINT_BITS - 1) / FLINT_BITS;
-    im_sn = FLINT_MAX(im_sn, 2);
-    im_sum_exp = im_max_exp + extend;
+    /* Number of nonzero midpoint terms in sum. */
+    re_nonzero = 0;
+    im_nonzero = 0;
 
-    /* We need sn + 1 limb for the sum (sn limbs + 1 dummy limb
-       for carry or borrow that avoids an extra branch). We need
-       2 * (sn + 2) limbs to store the product of two numbers
-       with up to (sn + 2) limbs, plus 1 extra limb for shifting
-       the product. */
-    alloc = (re_sn + 1) + (im_sn + 1) + 2 * (FLINT_MAX(re_sn, im_sn) + 2) + 1;
-    ARF_ADD_TMP_ALLOC(re_sum, alloc)
-    im_sum = re_sum + (re_sn + 1);
-    tmp = im_sum + (im_sn + 1);
+    /* Terms are bounded by 2^max_exp (with WORD_MIN = -infty) */
+    re_max_exp = WORD_MIN;
+    im_max_exp = WORD_MIN;
 
-    /* Sum of propagated errors. */
-    re_srad_exp = re_max_rad_exp;
-    re_srad = 0;
-    im_srad_exp = im_max_rad_exp;
-    im_srad = 0;
+    /* Propagated error terms are bounded by 2^max_rad_exp */
+    re_max_rad_exp = WORD_MIN;
+    im_max_rad_exp = WORD_MIN;
 
-    /* Set sum to 0 */
-    re_serr = 0;
-    for (j = 0; j < re_sn + 1; j++)
-        re_sum[j] = 0;
-    im_serr = 0;
-    for (j = 0; j < im_sn + 1; j++)
-        im_sum[j] = 0;
+    /* Used to reduce the precision. */
+    re_min_exp = WORD_MAX;
+    im_min_exp = WORD_MAX;
 
+    /* Account for the initial term. */
     if (initial != NULL)
     {
+        if (!ARB_IS_LAGOM(acb_realref(initial)) || !ARB_IS_LAGOM(acb_imagref(initial)))
+        {
+            acb_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
+            return;
+        }
+
         xm = arb_midref(acb_realref(initial));
         xr = arb_radref(acb_realref(initial));
 
-        ARB_DOT_ADD(re_sum, re_serr, re_sn, re_sum_exp, subtract, xm);
-        ARB_DOT_ADD_RAD(re_srad, re_srad_exp, xr);
-
-        xm = arb_midref(acb_imagref(initial));
-        xr = arb_radref(acb_imagref(initial));
-
-        ARB_DOT_ADD(im_sum, im_serr, im_sn, im_sum_exp, subtract, xm);
-        ARB_DOT_ADD_RAD(im_srad, im_srad_exp, xr);
-    }
-
-    /*
-    Look for terms to process using the Gauss multiplication formula.
-    If any such terms are found, we mask the ith entry in use_gauss
-    so that they will be skipped in the main loop.
-    Important: the cutoffs must be such that the fast case
-    (xn <= 2, yn <= 2, sn <= 3) is not hit below and the mask
-    check is done.
-
-    The cutoffs below are not optimal in the generic case; also, it
-    would be nicer to have both mulhigh and Gauss here. A more elegant
-    solution would be to write a fallback version of acb_dot_simple
-    where acb_addmul does the right thing.
-    */
-    use_gauss = NULL;
-
-    if (re_prec >= GAUSS_CUTOFF * FLINT_BITS &&
-        im_prec >= GAUSS_CUTOFF * FLINT_BITS)
-    {
-        arf_t e, f;
-
-        for (i = 0; i < len; i++)
+        if (!arf_is_special(xm))
         {
-            arb_srcptr ai, bi, ci, di;
-            mp_size_t an, bn, cn, dn;
-            slong aexp, bexp, cexp, dexp;
+            re_max_exp = ARF_EXP(xm);
+            re_nonzero++;
 
-            ai = ((arb_srcptr) x) + 2 * i * xstep;
-            bi = ((arb_srcptr) x) + 2 * i * xstep + 1;
-            ci = ((arb_srcptr) y) + 2 * i * ystep;
-            di = ((arb_srcptr) y) + 2 * i * ystep + 1;
+            if (prec > 2 * FLINT_BITS)
+                re_min_exp = ARF_EXP(xm) - ARF_SIZE(xm) * FLINT_BITS;
+        }
 
-            an = ARF_SIZE(arb_midref(ai));
-            bn = ARF_SIZE(arb_midref(bi));
-            cn = ARF_SIZE(arb_midref(ci));
-            dn = ARF_SIZE(arb_midref(di));
+        if (!mag_is_special(xr))
+            re_max_rad_exp = MAG_EXP(xr);
 
-            aexp = ARF_EXP(arb_midref(ai));
-            bexp = ARF_EXP(arb_midref(bi));
-            cexp = ARF_EXP(arb_midref(ci));
-            dexp = ARF_EXP(arb_midref(di));
+        xm = arb_midref(acb_imagref(initial));
+        xr = arb_radref(acb_imagref(initial));
 
-            if (an >= GAUSS_CUTOFF && bn >= GAUSS_CUTOFF &&
-                bn >= GAUSS_CUTOFF && cn >= GAUSS_CUTOFF &&
-                FLINT_ABS(an - bn) <= 2 &&
-                FLINT_ABS(cn - dn) <= 2 &&
-                FLINT_ABS(aexp - bexp) <= 64 &&
-                FLINT_ABS(cexp - dexp) <= 64 &&
-                re_sum_exp - (aexp + cexp) < 0.1 * re_prec &&
-                im_sum_exp - (aexp + dexp) < 0.1 * im_prec &&
-                an + cn < 2.2 * re_sn && an + dn < 2.2 * im_sn)
-            {
-                if (use_gauss == NULL)
-                {
-                    use_gauss = flint_calloc(len, sizeof(char));
-                    arf_init(e);
-                    arf_init(f);
-                }
+        if (!arf_is_special(xm))
+        {
+            im_max_exp = ARF_EXP(xm);
+            im_nonzero++;
 
-                use_gauss[i] = 1;
-                _arf_complex_mul_gauss(e, f, arb_midref(ai), arb_midref(bi), arb_midref(ci), arb_midref(di));
-                ARB_DOT_ADD(re_sum, re_serr, re_sn, re_sum_exp, 0, e);
-                ARB_DOT_ADD(im_sum, im_serr, im_sn, im_sum_exp, 0, f);
-            }
+            if (prec > 2 * FLINT_BITS)
+                im_min_exp = ARF_EXP(xm) - ARF_SIZE(xm) * FLINT_BITS;
         }
 
-        if (use_gauss != NULL)
-        {
-            arf_clear(e);
-            arf_clear(f);
-        }
+        if (!mag_is_special(xr))
+            im_max_rad_exp = MAG_EXP(xr);
     }
 
     for (xoff = 0; xoff < 2; xoff++)
     {
         for (yoff = 0; yoff < 2; yoff++)
         {
-            slong sum_exp, srad_exp;
-            mp_ptr sum;
-            mp_size_t sn;
-            mp_limb_t serr;
-            uint64_t srad;
-            int flipsign;
+            slong nonzero, max_exp, min_exp, max_rad_exp;
 
             if (xoff == yoff)
             {
-                sum_exp = re_sum_exp;
-                srad_exp = re_srad_exp;
-                sum = re_sum;
-                sn = re_sn;
-                if (re_max_exp == WORD_MIN && re_max_rad_exp == WORD_MIN)
-                    continue;
+                nonzero = re_nonzero;
+                max_exp = re_max_exp;
+                min_exp = re_min_exp;
+                max_rad_exp = re_max_rad_exp;
             }
             else
             {
-                sum_exp = im_sum_exp;
-                srad_exp = im_srad_exp;
-                sum = im_sum;
-                sn = im_sn;
-                if (im_max_exp == WORD_MIN && im_max_rad_exp == WORD_MIN)
-                    continue;
+                nonzero = im_nonzero;
+                max_exp = im_max_exp;
+                min_exp = im_min_exp;
+                max_rad_exp = im_max_rad_exp;
             }
 
-            serr = 0;
-            srad = 0;
-            flipsign = (xoff + yoff == 2);
-
+            /* Determine maximum exponents for the main sum and the radius sum. */
             for (i = 0; i < len; i++)
             {
                 xi = ((arb_srcptr) x) + 2 * i * xstep + xoff;
                 yi = ((arb_srcptr) y) + 2 * i * ystep + yoff;
 
+                /* Fallback for huge exponents or non-finite values. */
+                if (!ARB_IS_LAGOM(xi) || !ARB_IS_LAGOM(yi))
+                {
+                    acb_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
+                    return;
+                }
+
                 xm = arb_midref(xi);
                 ym = arb_midref(yi);
                 xr = arb_radref(xi);
                 yr = arb_radref(yi);
 
-                /* The midpoints of x[i] and y[i] are both nonzero. */
-                if (!arf_is_special(xm) && !arf_is_special(ym))
+                /* (xm+xr)(ym+yr) = xm ym + [xr ym + xm yr + xr yr] */
+                if (!arf_is_special(xm))
                 {
                     xexp = ARF_EXP(xm);
-                    xn = ARF_SIZE(xm);
-                    xnegative = ARF_SGNBIT(xm);
-
-                    yexp = ARF_EXP(ym);
-                    yn = ARF_SIZE(ym);
-                    ynegative = ARF_SGNBIT(ym);
-
-                    exp = xexp + yexp;
-                    shift = sum_exp - exp;
-
-                    if (shift >= sn * FLINT_BITS)
-                    {
-                        /* We may yet need the top limbs for bounds. */
-                        ARF_GET_TOP_LIMB(xtop, xm);
-                        ARF_GET_TOP_LIMB(ytop, ym);
-                        serr++;
-                    }
-                    else if (xn <= 2 && yn <= 2 && sn <= 3)
-                    {
-                        mp_limb_t x1, x0, y1, y0;
-                        mp_limb_t u3, u2, u1, u0;
-
-                        if (xn == 1 && yn == 1)
-                        {
-                            xtop = ARF_NOPTR_D(xm)[0];
-                            ytop = ARF_NOPTR_D(ym)[0];
-                            umul_ppmm(u3, u2, xtop, ytop);
-                            u1 = u0 = 0;
-                        }
-                        else if (xn == 2 && yn == 2)
-                        {
-                            x0 = ARF_NOPTR_D(xm)[0];
-                            x1 = ARF_NOPTR_D(xm)[1];
-                            y0 = ARF_NOPTR_D(ym)[0];
-                            y1 = ARF_NOPTR_D(ym)[1];
-                            xtop = x1;
-                            ytop = y1;
-                            nn_mul_2x2(u3, u2, u1, u0, x1, x0, y1, y0);
-                        }
-                        else if (xn == 1)
-                        {
-                            x0 = ARF_NOPTR_D(xm)[0];
-                            y0 = ARF_NOPTR_D(ym)[0];
-                            y1 = ARF_NOPTR_D(ym)[1];
-                            xtop = x0;
-                            ytop = y1;
-                            nn_mul_2x1(u3, u2, u1, y1, y0, x0);
-                            u0 = 0;
-                        }
-                        else
-                        {
-                            x0 = ARF_NOPTR_D(xm)[0];
-                            x1 = ARF_NOPTR_D(xm)[1];
-                            y0 = ARF_NOPTR_D(ym)[0];
-                            xtop = x1;
-                            ytop = y0;
-                            nn_mul_2x1(u3, u2, u1, x1, x0, y0);
-                            u0 = 0;
-                        }
 
-                        if (sn == 2)
-                        {
-                            if (shift < FLINT_BITS)
-                            {
-                                serr += ((u2 << (FLINT_BITS - shift)) != 0) || (u1 != 0) || (u0 != 0);
-                                u2 = (u2 >> shift) | (u3 << (FLINT_BITS - shift));
-                                u3 = (u3 >> shift);
-                            }
-                            else if (shift == FLINT_BITS)
-                            {
-                                serr += (u2 != 0) || (u1 != 0) || (u0 != 0);
-                                u2 = u3;
-                                u3 = 0;
-                            }
-                            else /* FLINT_BITS < shift < 2 * FLINT_BITS */
-                            {
-                                serr += ((u3 << (2 * FLINT_BITS - shift)) != 0) || (u2 != 0) || (u1 != 0) || (u0 != 0);
-                                u2 = (u3 >> (shift - FLINT_BITS));
-                                u3 = 0;
-                            }
+                    if (!arf_is_special(ym))
+                    {
+                        yexp = ARF_EXP(ym);
 
-                            if (xnegative ^ ynegative ^ flipsign)
-                                sub_ddmmss(sum[1], sum[0], sum[1], sum[0], u3, u2);
-                            else
-                                add_ssaaaa(sum[1], sum[0], sum[1], sum[0], u3, u2);
+                        max_exp = FLINT_MAX(max_exp, xexp + yexp);
+                        nonzero++;
+
+                        if (prec > 2 * FLINT_BITS)
+                        {
+                            slong bot;
+                            bot = (xexp + yexp) - (ARF_SIZE(xm) + ARF_SIZE(ym)) * FLINT_BITS;
+                            min_exp = FLINT_MIN(min_exp, bot);
                         }
-                        else if (sn == 3)
+
+                        if (!mag_is_special(xr))
                         {
-                            if (shift < FLINT_BITS)
-                            {
-                                serr += ((u1 << (FLINT_BITS - shift)) != 0) || (u0 != 0);
-                                u1 = (u1 >> shift) | (u2 << (FLINT_BITS - shift));
-                                u2 = (u2 >> shift) | (u3 << (FLINT_BITS - shift));
-                                u3 = (u3 >> shift);
-                            }
-                            else if (shift == FLINT_BITS)
-                            {
-                                serr += (u1 != 0) || (u0 != 0);
-                                u1 = u2;
-                                u2 = u3;
-                                u3 = 0;
-                            }
-                            else if (shift < 2 * FLINT_BITS)
-                            {
-                                serr += ((u2 << (2 * FLINT_BITS - shift)) != 0) || (u1 != 0) || (u0 != 0);
-                                u1 = (u3 << (2 * FLINT_BITS - shift)) | (u2 >> (shift - FLINT_BITS));
-                                u2 = (u3 >> (shift - FLINT_BITS));
-                                u3 = 0;
-                            }
-                            else if (shift == 2 * FLINT_BITS)
+                            xrexp = MAG_EXP(xr);
+                            max_rad_exp = FLINT_MAX(max_rad_exp, yexp + xrexp);
+
+                            if (!mag_is_special(yr))
                             {
-                                serr += (u2 != 0) || (u1 != 0) || (u0 != 0);
-                                u1 = u3;
-                                u2 = 0;
-                                u3 = 0;
+                                yrexp = MAG_EXP(yr);
+                                max_rad_exp = FLINT_MAX(max_rad_exp, xexp + yrexp);
+                                max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yrexp);
                             }
-                            else  /* 2 * FLINT_BITS < shift < 3 * FLINT_BITS */
+                        }
+                        else
+                        {
+                            if (!mag_is_special(yr))
                             {
-                                serr += ((u3 << (3 * FLINT_BITS - shift)) != 0) || (u2 != 0) || (u1 != 0) || (u0 != 0);
-                                u1 = (u3 >> (shift - 2 * FLINT_BITS));
-                                u2 = 0;
-                                u3 = 0;
+                                yrexp = MAG_EXP(yr);
+                                max_rad_exp = FLINT_MAX(max_rad_exp, xexp + yrexp);
                             }
-
-                            if (xnegative ^ ynegative ^ flipsign)
-                                sub_dddmmmsss(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
-                            else
-                                add_sssaaaaaa(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
                         }
                     }
-                    else
-                    {
-                        mp_srcptr xptr, yptr;
-
-                        xptr = (xn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(xm) : ARF_PTR_D(xm);
-                        yptr = (yn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(ym) : ARF_PTR_D(ym);
-
-                        xtop = xptr[xn - 1];
-                        ytop = yptr[yn - 1];
-
-                        if (use_gauss == NULL || use_gauss[i] == 0)
-                            _arb_dot_addmul_generic(sum, &serr, tmp, sn, xptr, xn, yptr, yn, xnegative ^ ynegative ^ flipsign, shift);
-                    }
-
-                    xrad = MAG_MAN(xr);
-                    yrad = MAG_MAN(yr);
-
-                    if (xrad != 0 && yrad != 0)
+                    else  /* if y = 0, something can happen only if yr != 0 */
                     {
-                        xrexp = MAG_EXP(xr);
-                        yrexp = MAG_EXP(yr);
+                        if (!mag_is_special(yr))
+                        {
+                            yrexp = MAG_EXP(yr);
+                            max_rad_exp = FLINT_MAX(max_rad_exp, xexp + yrexp);
 
-                        RAD_ADDMUL(srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
-                        RAD_ADDMUL(srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
-                        RAD_ADDMUL(srad, srad_exp, xrad, yrad, xrexp + yrexp);
-                    }
-                    else if (xrad != 0)
-                    {
-                        xrexp = MAG_EXP(xr);
-                        RAD_ADDMUL(srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
-                    }
-                    else if (yrad != 0)
-                    {
-                        yrexp = MAG_EXP(yr);
-                        RAD_ADDMUL(srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
+                            if (!mag_is_special(xr))
+                            {
+                                xrexp = MAG_EXP(xr);
+                                max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yrexp);
+                            }
+                        }
                     }
                 }
-                else
+                else  /* if x = 0, something can happen only if xr != 0 */
                 {
-                    xrad = MAG_MAN(xr);
-                    yrad = MAG_MAN(yr);
-
-                    xexp = ARF_EXP(xm);
-                    yexp = ARF_EXP(ym);
-
-                    xrexp = MAG_EXP(xr);
-                    yrexp = MAG_EXP(yr);
-
-                    /* (xm+xr)(ym+yr) = xm ym + [xm yr + ym xr + xr yr] */
-                    if (yrad && !arf_is_special(xm))
+                    if (!mag_is_special(xr))
                     {
-                        ARF_GET_TOP_LIMB(xtop, xm);
-                        RAD_ADDMUL(srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
-                    }
+                        xrexp = MAG_EXP(xr);
 
-                    if (xrad && !arf_is_special(ym))
-                    {
-                        ARF_GET_TOP_LIMB(ytop, ym);
-                        RAD_ADDMUL(srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
-                    }
+                        if (!arf_is_special(ym))
+                        {
+                            yexp = ARF_EXP(ym);
+                            max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yexp);
+                        }
 
-                    if (xrad && yrad)
-                    {
-                        RAD_ADDMUL(srad, srad_exp, xrad, yrad, xrexp + yrexp);
+                        if (!mag_is_special(yr))
+                        {
+                            yrexp = MAG_EXP(yr);
+                            max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yrexp);
+                        }
                     }
                 }
             }
 
             if (xoff == yoff)
             {
-                re_serr += serr;
-                re_srad += srad;
+                re_nonzero = nonzero;
+                re_max_exp = max_exp;
+                re_min_exp = min_exp;
+                re_max_rad_exp = max_rad_exp;
             }
             else
             {
-                im_serr += serr;
-                im_srad += srad;
+                im_nonzero = nonzero;
+                im_max_exp = max_exp;
+                im_min_exp = min_exp;
+                im_max_rad_exp = max_rad_exp;
             }
         }
     }
 
+    re_prec = prec;
+    im_prec = prec;
+
+    if (re_max_exp == WORD_MIN && re_max_rad_exp == WORD_MIN &&
+        im_max_exp == WORD_MIN && im_max_rad_exp == WORD_MIN)
+    {
+        acb_zero(res);
+        return;
+    }
+
+    /* The midpoint sum is zero. */
+    if (re_max_exp == WORD_MIN)
+    {
+        re_prec = 2;
+    }
+    else
+    {
+        if (re_max_rad_exp != WORD_MIN)
+            re_prec = FLINT_MIN(re_prec, re_max_exp - re_max_rad_exp + MAG_BITS);
+        if (re_min_exp != WORD_MAX)
+            re_prec = FLINT_MIN(re_prec, re_max_exp - re_min_exp + MAG_BITS);
+        re_prec = FLINT_MAX(re_prec, 2);
+    }
+
+    if (im_max_exp == WORD_MIN)
+    {
+        im_prec = 2;
+    }
+    else
+    {
+        if (im_max_rad_exp != WORD_MIN)
+            im_prec = FLINT_MIN(im_prec, im_max_exp - im_max_rad_exp + MAG_BITS);
+        if (re_min_exp != WORD_MAX)
+            im_prec = FLINT_MIN(im_prec, im_max_exp - im_min_exp + MAG_BITS);
+        im_prec = FLINT_MAX(im_prec, 2);
+    }
+
+    extend = FLINT_BIT_COUNT(re_nonzero) + 1;
+    padding = 4 + FLINT_BIT_COUNT(len);
+    re_sn = (re_prec + extend + padding + FLINT_BITS - 1) / FLINT_BITS;
+    re_sn = FLINT_MAX(re_sn, 2);
+    re_sum_exp = re_max_exp + extend;
+
+    extend = FLINT_BIT_COUNT(im_nonzero) + 1;
+    padding = 4 + FLINT_BIT_COUNT(len);
+    im_sn = (im_prec + extend + padding + FLINT_BITS - 1) / FLINT_BITS;
+    im_sn = FLINT_MAX(im_sn, 2);
+    im_sum_exp = im_max_exp + extend;
+
+    /* We need sn + 1 limb for the sum (sn limbs + 1 dummy limb
+       for carry or borrow that avoids an extra branch). We need
+       2 * (sn + 2) limbs to store the product of two numbers
+       with up to (sn + 2) limbs, plus 1 extra limb for shifting
+       the product. */
+    alloc = (re_sn + 1) + (im_sn + 1) + 2 * (FLINT_MAX(re_sn, im_sn) + 2) + 1;
+    ARF_ADD_TMP_ALLOC(re_sum, alloc)
+    im_sum = re_sum + (re_sn + 1);
+    tmp = im_sum + (im_sn + 1);
+
+    /* Sum of propagated errors. */
+    re_srad_exp = re_max_rad_exp;
+    re_srad = 0;
+    im_srad_exp = im_max_rad_exp;
+    im_srad = 0;
+
+    /* Set sum to 0 */
+    re_serr = 0;
+    for (j = 0; j < re_sn + 1; j++)
+        re_sum[j] = 0;
+    im_serr = 0;
+    for (j = 0; j < im_sn + 1; j++)
+        im_sum[j] = 0;
+
+    if (initial != NULL)
+    {
+        xm = arb_midref(acb_realref(initial));
+        xr = arb_radref(acb_realref(initial));
+
+        ARB_DOT_ADD(re_sum, re_serr, re_sn, re_sum_exp, subtract, xm);
+        ARB_DOT_ADD_RAD(re_srad, re_srad_exp, xr);
+
+        xm = arb_midref(acb_imagref(initial));
+        xr = arb_radref(acb_imagref(initial));
+
+        ARB_DOT_ADD(im_sum, im_serr, im_sn, im_sum_exp, subtract, xm);
+        ARB_DOT_ADD_RAD(im_srad, im_srad_exp, xr);
+    }
+
+    align.re_sn = re_sn;
+    align.im_sn = im_sn;
+    align.re_sum_exp = re_sum_exp;
+    align.im_sum_exp = im_sum_exp;
+    align.re_srad_exp = re_srad_exp;
+    align.im_srad_exp = im_srad_exp;
+    align.re_prec = re_prec;
+    align.im_prec = im_prec;
+    align.re_zero = (re_max_exp == WORD_MIN && re_max_rad_exp == WORD_MIN);
+    align.im_zero = (im_max_exp == WORD_MIN && im_max_rad_exp == WORD_MIN);
+
+    if (threaded)
+        _acb_dot_sum_terms_threaded(re_sum, &re_serr, &re_srad, im_sum, &im_serr, &im_srad,
+            tmp, &align, x, xstep, y, ystep, len);
+    else
+        _acb_dot_sum_terms(re_sum, &re_serr, &re_srad, im_sum, &im_serr, &im_srad,
+            tmp, &align, x, xstep, y, ystep, len);
+
     _arb_dot_output(acb_realref(res), re_sum, re_sn, subtract, re_serr, re_sum_exp, re_srad, re_srad_exp, re_prec);
     _arb_dot_output(acb_imagref(res), im_sum, im_sn, subtract, im_serr, im_sum_exp, im_srad, im_srad_exp, im_prec);
 
     ARF_ADD_TMP_FREE(re_sum, alloc);
-    if (use_gauss != NULL)
-        flint_free(use_gauss);
+}
+
+void
+acb_dot(acb_t res, const acb_t initial, int subtract, acb_srcptr x, slong xstep, acb_srcptr y, slong ystep, slong len, slong prec)
+{
+    _acb_dot(res, initial, subtract, x, xstep, y, ystep, len, prec, 0);
 }
@@ -0,0 +1,109 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("dot_threaded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 30 * arb_test_multiplier(); iter++)
+    {
+        acb_ptr x, y;
+        acb_t s, r1, r2, r3;
+        slong i, len, prec, xstep, ystep;
+        int subtract, initial;
+
+        len = n_randint(state, 4 * ARB_DOT_THREAD_CHUNK);
+        prec = 2 + n_randint(state, 300);
+        subtract = n_randint(state, 2);
+        initial = n_randint(state, 2);
+        xstep = n_randint(state, 2) ? 1 : -1;
+        ystep = n_randint(state, 2) ? 1 : -1;
+
+        x = _acb_vec_init(len);
+        y = _acb_vec_init(len);
+        acb_init(s);
+        acb_init(r1);
+        acb_init(r2);
+        acb_init(r3);
+
+        for (i = 0; i < len; i++)
+        {
+            acb_randtest(x + i, state, 1 + n_randint(state, 200), 10);
+            acb_randtest(y + i, state, 1 + n_randint(state, 200), 10);
+        }
+
+        acb_randtest(s, state, 200, 10);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        acb_dot_threaded(r1, initial ? s : NULL, subtract,
+            xstep == 1 ? x : x + len - 1, xstep,
+            ystep == 1 ? y : y + len - 1, ystep, len, prec);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        acb_dot_threaded(r2, initial ? s : NULL, subtract,
+            xstep == 1 ? x : x + len - 1, xstep,
+            ystep == 1 ? y : y + len - 1, ystep, len, prec);
+
+        acb_dot(r3, initial ? s : NULL, subtract,
+            xstep == 1 ? x : x + len - 1, xstep,
+            ystep == 1 ? y : y + len - 1, ystep, len, prec);
+
+        if (!acb_equal(r1, r2) || !acb_equal(r1, r3))
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("len = %wd, prec = %wd\n\n", len, prec);
+            flint_printf("r1 = "); acb_printd(r1, 30); flint_printf("\n\n");
+            flint_printf("r2 = "); acb_printd(r2, 30); flint_printf("\n\n");
+            flint_printf("r3 = "); acb_printd(r3, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        /* approximate version */
+        flint_set_num_threads(1 + n_randint(state, 4));
+        acb_approx_dot_threaded(r1, initial ? s : NULL, subtract, x, 1, y, 1, len, prec);
+        flint_set_num_threads(1 + n_randint(state, 4));
+        acb_approx_dot_threaded(r2, initial ? s : NULL, subtract, x, 1, y, 1, len, prec);
+        acb_approx_dot(r3, initial ? s : NULL, subtract, x, 1, y, 1, len, prec);
+
+        if (!arf_equal(arb_midref(acb_realref(r1)), arb_midref(acb_realref(r2))) ||
+            !arf_equal(arb_midref(acb_imagref(r1)), arb_midref(acb_imagref(r2))) ||
+            !arf_equal(arb_midref(acb_realref(r1)), arb_midref(acb_realref(r3))) ||
+            !arf_equal(arb_midref(acb_imagref(r1)), arb_midref(acb_imagref(r3))))
+        {
+            flint_printf("FAIL (approx)\n\n");
+            flint_printf("len = %wd, prec = %wd\n\n", len, prec);
+            flint_printf("r1 = "); acb_printd(r1, 30); flint_printf("\n\n");
+            flint_printf("r2 = "); acb_printd(r2, 30); flint_printf("\n\n");
+            flint_printf("r3 = "); acb_printd(r3, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        _acb_vec_clear(x, len);
+        _acb_vec_clear(y, len);
+        acb_clear(s);
+        acb_clear(r1);
+        acb_clear(r2);
+        acb_clear(r3);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -63,21 +63,6 @@ void gl_init()
 }
 
 /* Compute GL node and weight of index k for n = gl_steps[i]. Cached. */
-typedef struct
-{
-    arb_ptr nodes;
-    arb_ptr weights;
-    slong n;
-    slong wp;
-}
-nodes_work_t;
-
-static void
-nodes_worker(slong jj, nodes_work_t * work)
-{
-    arb_hypgeom_legendre_p_ui_root(work->nodes + jj, work->weights + jj, work->n, jj, work->wp);
-}
-
 /* if k >= 0, compute the node and weight of index k */
 /* if k < 0, compute the first (n+1)/2 nodes and weights (the others are given by symmetry) */
 void
@@ -101,8 +86,6 @@ acb_calc_gl_node(arb_ptr x, arb_ptr w, slong i, slong k, slong prec)
     
     if (gl_cache->gl_prec[i] < prec)
     {
-        nodes_work_t work;
-
         if (gl_cache->gl_prec[i] == 0)
         {
             gl_cache->gl_nodes[i] = _arb_vec_init((n + 1) / 2);
@@ -111,12 +94,8 @@ acb_calc_gl_node(arb_ptr x, arb_ptr w, slong i, slong k, slong prec)
 
         wp = FLINT_MAX(prec, gl_cache->gl_prec[i] * 2 + 30);
 
-        work.nodes = gl_cache->gl_nodes[i];
-        work.weights = gl_cache->gl_weights[i];
-        work.n = n;
-        work.wp = wp;
-
-        flint_parallel_do((do_func_t) nodes_worker, &work, (n + 1) / 2, -1, FLINT_PARALLEL_STRIDED);
+        _arb_hypgeom_legendre_p_ui_roots_vec(gl_cache->gl_nodes[i],
+            gl_cache->gl_weights[i], n, wp);
 
         gl_cache->gl_prec[i] = wp;
     }
@@ -151,6 +151,28 @@ acb_dft_pre_struct;
 
 typedef acb_dft_pre_struct acb_dft_pre_t[1];
 
+/* real transforms of length n, using a complex DFT of length n/2 when
+   n is even */
+typedef struct
+{
+    slong n;
+    acb_ptr z;
+    acb_dft_pre_t pre;
+}
+acb_dft_real_pre_struct;
+
+typedef acb_dft_real_pre_struct acb_dft_real_pre_t[1];
+
+typedef struct
+{
+    slong n;
+    acb_ptr z;
+    acb_dft_real_pre_t real;
+}
+acb_dft_dct_pre_struct;
+
+typedef acb_dft_dct_pre_struct acb_dft_dct_pre_t[1];
+
 /* covers both product and cyclic case */
 struct
 acb_dft_step_struct
@@ -173,6 +195,9 @@ acb_dft_step_struct
 
 #define DFT_VERB 0
 
+/* minimum total length of a product step to split between threads */
+#define ACB_DFT_THREAD_MIN_LEN 256
+
 enum
 {
     DFT_NAIVE, DFT_CYC, DFT_PROD, DFT_CRT , DFT_RAD2 , DFT_CONV
@@ -182,6 +207,9 @@ void acb_dft_step(acb_ptr w, acb_srcptr v, acb_dft_step_ptr cyc, slong num, slon
 
 void acb_dft_precomp(acb_ptr w, acb_srcptr v, const acb_dft_pre_t pre, slong prec);
 void acb_dft_inverse_precomp(acb_ptr w, acb_srcptr v, const acb_dft_pre_t pre, slong prec);
+void acb_dft_precomp_vec(acb_ptr w, acb_srcptr v, slong num, const acb_dft_pre_t pre, slong prec);
+void acb_dft_inverse_precomp_vec(acb_ptr w, acb_srcptr v, slong num, const acb_dft_pre_t pre, slong prec);
+void acb_dft_convol_dft_precomp(acb_ptr w, acb_srcptr f, acb_srcptr g, const acb_dft_pre_t pre, slong prec);
 void acb_dft_naive_precomp(acb_ptr w, acb_srcptr v, const acb_dft_naive_t pol, slong prec);
 void acb_dft_cyc_precomp(acb_ptr w, acb_srcptr v, const acb_dft_cyc_t cyc, slong prec);
 
@@ -204,6 +232,20 @@ void acb_dft_precomp_clear(acb_dft_pre_t pre);
 void acb_dft(acb_ptr w, acb_srcptr v, slong len, slong prec);
 void acb_dft_inverse(acb_ptr w, acb_srcptr v, slong len, slong prec);
 
+void acb_dft_real_precomp_init(acb_dft_real_pre_t pre, slong len, slong prec);
+void acb_dft_real_precomp_clear(acb_dft_real_pre_t pre);
+void acb_dft_real_precomp(acb_ptr w, arb_srcptr v, const acb_dft_real_pre_t pre, slong prec);
+void acb_dft_inverse_real_precomp(arb_ptr w, acb_srcptr v, const acb_dft_real_pre_t pre, slong prec);
+void acb_dft_real(acb_ptr w, arb_srcptr v, slong len, slong prec);
+void acb_dft_inverse_real(arb_ptr w, acb_srcptr v, slong len, slong prec);
+
+void acb_dft_dct_precomp_init(acb_dft_dct_pre_t pre, slong len, slong prec);
+void acb_dft_dct_precomp_clear(acb_dft_dct_pre_t pre);
+void acb_dft_dct2_precomp(arb_ptr w, arb_srcptr v, const acb_dft_dct_pre_t pre, slong prec);
+void acb_dft_dct3_precomp(arb_ptr w, arb_srcptr v, const acb_dft_dct_pre_t pre, slong prec);
+void acb_dft_dct2(arb_ptr w, arb_srcptr v, slong len, slong prec);
+void acb_dft_dct3(arb_ptr w, arb_srcptr v, slong len, slong prec);
+
 acb_dft_step_ptr _acb_dft_steps_prod(slong * m, slong num, slong prec);
 
 ACB_DFT_INLINE void
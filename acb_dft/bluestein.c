@@ -19,7 +19,7 @@ _acb_vec_bluestein_factors(acb_ptr z, slong n, slong prec)
     /* this function is used mostly with prime-power n
      * so the set of squares has index 2 only.
      * computing an addition sequence does not considerably improve things */
-    if (n < 30)
+    if (n < arb_tune_get(ARB_TUNE_DFT_BLUESTEIN_ADDSEQ_MIN_LEN))
     {
         slong k, k2;
         acb_ptr z2n;
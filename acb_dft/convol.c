@@ -15,7 +15,7 @@ static int use_dft(slong len, slong prec)
 {
     slong l2 = len;
     while (l2 >= 16) l2 >>= 1;
-    if (l2 < 11)
+    if (l2 < arb_tune_get(ARB_TUNE_DFT_CONVOL_DFT_CUTOFF))
     {
         while (!(len & 1)) len >>= 1;
         while (len % 3 == 0) len /= 3;
@@ -0,0 +1,157 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dft.h"
+
+/* The DCT-II of length n is obtained from the real DFT U of the
+   permuted sequence u_j = v_{2j}, u_{n-1-j} = v_{2j+1} (Makhoul):
+   with t_k = s_k e(-k/(4n)) U_k, the outputs are X_k = re(t_k) and
+   X_{n-k} = -im(t_k) for 0 <= k <= n/2. The normalization s_k of
+   arb_mat_dct is included in the stored roots. */
+
+void
+acb_dft_dct_precomp_init(acb_dft_dct_pre_t pre, slong len, slong prec)
+{
+    arb_t s;
+
+    pre->n = len;
+    acb_dft_real_precomp_init(pre->real, len, prec);
+
+    if (len == 0)
+    {
+        pre->z = NULL;
+        return;
+    }
+
+    pre->z = _acb_vec_init(len / 2 + 1);
+    _acb_vec_unit_roots(pre->z, -4 * len, len / 2 + 1, prec);
+
+    arb_init(s);
+
+    arb_set_ui(s, len);
+    arb_mul_2exp_si(s, s, -1);
+    arb_rsqrt(s, s, prec);
+    _acb_vec_scalar_mul_arb(pre->z, pre->z, len / 2 + 1, s, prec);
+
+    arb_set_ui(s, len);
+    arb_rsqrt(acb_realref(pre->z), s, prec);
+    arb_zero(acb_imagref(pre->z));
+
+    arb_clear(s);
+}
+
+void
+acb_dft_dct_precomp_clear(acb_dft_dct_pre_t pre)
+{
+    if (pre->z != NULL)
+        _acb_vec_clear(pre->z, pre->n / 2 + 1);
+    acb_dft_real_precomp_clear(pre->real);
+}
+
+void
+acb_dft_dct2_precomp(arb_ptr w, arb_srcptr v, const acb_dft_dct_pre_t pre, slong prec)
+{
+    slong j, k, n;
+    arb_ptr u;
+    acb_ptr t;
+
+    n = pre->n;
+
+    if (n == 0)
+        return;
+
+    u = _arb_vec_init(n);
+    t = _acb_vec_init(n / 2 + 1);
+
+    for (j = 0; 2 * j < n; j++)
+        arb_set(u + j, v + 2 * j);
+    for (j = 0; 2 * j + 1 < n; j++)
+        arb_set(u + n - 1 - j, v + 2 * j + 1);
+
+    acb_dft_real_precomp(t, u, pre->real, prec);
+
+    for (k = 0; 2 * k <= n; k++)
+    {
+        acb_mul(t + k, t + k, pre->z + k, prec);
+
+        arb_swap(w + k, acb_realref(t + k));
+
+        if (k != 0 && 2 * k != n)
+            arb_neg(w + n - k, acb_imagref(t + k));
+    }
+
+    _arb_vec_clear(u, n);
+    _acb_vec_clear(t, n / 2 + 1);
+}
+
+void
+acb_dft_dct3_precomp(arb_ptr w, arb_srcptr v, const acb_dft_dct_pre_t pre, slong prec)
+{
+    slong j, k, n;
+    arb_ptr u;
+    acb_ptr t;
+    acb_t c;
+
+    n = pre->n;
+
+    if (n == 0)
+        return;
+
+    u = _arb_vec_init(n);
+    t = _acb_vec_init(n / 2 + 1);
+    acb_init(c);
+
+    /* U_k = (n / 2) conj(z_k) (X_k - i X_{n-k}), with X_n = 0 and twice
+       that factor for k = 0 */
+    for (k = 0; 2 * k <= n; k++)
+    {
+        if (k == 0)
+            arb_zero(acb_imagref(t + k));
+        else
+            arb_neg(acb_imagref(t + k), v + n - k);
+        arb_set(acb_realref(t + k), v + k);
+
+        acb_conj(c, pre->z + k);
+        acb_mul(t + k, t + k, c, prec);
+        acb_mul_ui(t + k, t + k, n, prec);
+        if (k != 0)
+            acb_mul_2exp_si(t + k, t + k, -1);
+    }
+
+    acb_dft_inverse_real_precomp(u, t, pre->real, prec);
+
+    for (j = 0; 2 * j < n; j++)
+        arb_swap(w + 2 * j, u + j);
+    for (j = 0; 2 * j + 1 < n; j++)
+        arb_swap(w + 2 * j + 1, u + n - 1 - j);
+
+    _arb_vec_clear(u, n);
+    _acb_vec_clear(t, n / 2 + 1);
+    acb_clear(c);
+}
+
+void
+acb_dft_dct2(arb_ptr w, arb_srcptr v, slong len, slong prec)
+{
+    acb_dft_dct_pre_t pre;
+    acb_dft_dct_precomp_init(pre, len, prec);
+    acb_dft_dct2_precomp(w, v, pre, prec);
+    acb_dft_dct_precomp_clear(pre);
+}
+
+void
+acb_dft_dct3(arb_ptr w, arb_srcptr v, slong len, slong prec)
+{
+    acb_dft_dct_pre_t pre;
+    acb_dft_dct_precomp_init(pre, len, prec);
+    acb_dft_dct3_precomp(w, v, pre, prec);
+    acb_dft_dct_precomp_clear(pre);
+}
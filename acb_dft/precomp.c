@@ -22,7 +22,7 @@ _acb_dft_precomp_init(acb_dft_pre_t pre, slong dv, acb_ptr z, slong dz, slong le
     }
     else if (n_is_prime(len))
     {
-        if (len < 100)
+        if (len < arb_tune_get(ARB_TUNE_DFT_BLUESTEIN_MIN_LEN))
         {
             pre->type = DFT_NAIVE;
             _acb_dft_naive_init(pre->t.naive, dv, z, dz, len, prec);
@@ -0,0 +1,66 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/thread_support.h"
+#include "acb_dft.h"
+
+typedef struct
+{
+    acb_ptr w;
+    acb_srcptr v;
+    const acb_dft_pre_struct * pre;
+    slong prec;
+    int inverse;
+}
+work_t;
+
+static void
+worker(slong i, work_t * work)
+{
+    slong n = work->pre->n;
+
+    if (work->inverse)
+        acb_dft_inverse_precomp(work->w + i * n, work->v + i * n, work->pre, work->prec);
+    else
+        acb_dft_precomp(work->w + i * n, work->v + i * n, work->pre, work->prec);
+}
+
+static void
+_acb_dft_precomp_vec(acb_ptr w, acb_srcptr v, slong num,
+    const acb_dft_pre_t pre, slong prec, int inverse)
+{
+    work_t work;
+    slong i;
+
+    work.w = w;
+    work.v = v;
+    work.pre = pre;
+    work.prec = prec;
+    work.inverse = inverse;
+
+    if (num > 1 && arb_flint_get_num_available_threads() > 1)
+        flint_parallel_do((do_func_t) worker, &work, num, -1, FLINT_PARALLEL_STRIDED);
+    else
+        for (i = 0; i < num; i++)
+            worker(i, &work);
+}
+
+void
+acb_dft_precomp_vec(acb_ptr w, acb_srcptr v, slong num, const acb_dft_pre_t pre, slong prec)
+{
+    _acb_dft_precomp_vec(w, v, num, pre, prec, 0);
+}
+
+void
+acb_dft_inverse_precomp_vec(acb_ptr w, acb_srcptr v, slong num, const acb_dft_pre_t pre, slong prec)
+{
+    _acb_dft_precomp_vec(w, v, num, pre, prec, 1);
+}
@@ -0,0 +1,175 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dft.h"
+
+/* For even n = 2m, a real DFT of length n is computed with one complex
+   DFT of length m on z_j = v_{2j} + i v_{2j+1}, followed by an O(n)
+   unpacking step using the roots e(-k/n), k < m. For odd n, the input
+   is embedded in a complex vector. */
+
+void
+acb_dft_real_precomp_init(acb_dft_real_pre_t pre, slong len, slong prec)
+{
+    pre->n = len;
+
+    if (len % 2 == 0 && len >= 2)
+    {
+        pre->z = _acb_vec_init(len / 2);
+        _acb_vec_unit_roots(pre->z, -len, len / 2, prec);
+        acb_dft_precomp_init(pre->pre, len / 2, prec);
+    }
+    else
+    {
+        pre->z = NULL;
+        acb_dft_precomp_init(pre->pre, len, prec);
+    }
+}
+
+void
+acb_dft_real_precomp_clear(acb_dft_real_pre_t pre)
+{
+    if (pre->z != NULL)
+        _acb_vec_clear(pre->z, pre->n / 2);
+    acb_dft_precomp_clear(pre->pre);
+}
+
+void
+acb_dft_real_precomp(acb_ptr w, arb_srcptr v, const acb_dft_real_pre_t pre, slong prec)
+{
+    slong j, k, m, n;
+    acb_ptr t, s;
+
+    n = pre->n;
+
+    if (n == 0)
+        return;
+
+    if (pre->z == NULL)
+    {
+        t = _acb_vec_init(2 * n);
+
+        for (j = 0; j < n; j++)
+            arb_set(acb_realref(t + j), v + j);
+
+        acb_dft_precomp(t + n, t, pre->pre, prec);
+        _acb_vec_set(w, t + n, n / 2 + 1);
+
+        _acb_vec_clear(t, 2 * n);
+        return;
+    }
+
+    m = n / 2;
+    t = _acb_vec_init(2 * m + 3);
+    s = t + m;
+
+    for (j = 0; j < m; j++)
+        acb_set_arb_arb(t + j, v + 2 * j, v + 2 * j + 1);
+
+    acb_dft_precomp(s, t, pre->pre, prec);
+
+    /* X_k = (Z_k + conj(Z_{m-k})) / 2 + e(-k/n) (Z_k - conj(Z_{m-k})) / (2i) */
+    for (k = 1; k < m; k++)
+    {
+        acb_ptr c = t + 2 * m, e = t + 2 * m + 1, o = t + 2 * m + 2;
+
+        acb_conj(c, s + m - k);
+        acb_add(e, s + k, c, prec);
+        acb_sub(o, s + k, c, prec);
+        acb_mul(o, o, pre->z + k, prec);
+        acb_div_onei(o, o);
+        acb_add(w + k, e, o, prec);
+        acb_mul_2exp_si(w + k, w + k, -1);
+    }
+
+    arb_add(acb_realref(w), acb_realref(s), acb_imagref(s), prec);
+    arb_sub(acb_realref(w + m), acb_realref(s), acb_imagref(s), prec);
+    arb_zero(acb_imagref(w));
+    arb_zero(acb_imagref(w + m));
+
+    _acb_vec_clear(t, 2 * m + 3);
+}
+
+void
+acb_dft_inverse_real_precomp(arb_ptr w, acb_srcptr v, const acb_dft_real_pre_t pre, slong prec)
+{
+    slong j, k, m, n;
+    acb_ptr t, s;
+
+    n = pre->n;
+
+    if (n == 0)
+        return;
+
+    if (pre->z == NULL)
+    {
+        t = _acb_vec_init(2 * n);
+
+        _acb_vec_set(t, v, n / 2 + 1);
+        for (k = 1; 2 * k < n; k++)
+            acb_conj(t + n - k, v + k);
+
+        acb_dft_inverse_precomp(t + n, t, pre->pre, prec);
+
+        for (j = 0; j < n; j++)
+            arb_swap(w + j, acb_realref(t + n + j));
+
+        _acb_vec_clear(t, 2 * n);
+        return;
+    }
+
+    m = n / 2;
+    t = _acb_vec_init(2 * m + 2);
+    s = t + m;
+
+    /* Z_k = (X_k + conj(X_{m-k})) / 2 + i e(k/n) (X_k - conj(X_{m-k})) / 2 */
+    for (k = 0; k < m; k++)
+    {
+        acb_ptr c = s, o = s + 1;
+
+        acb_conj(c, v + m - k);
+        acb_sub(o, v + k, c, prec);
+        acb_add(t + k, v + k, c, prec);
+        acb_conj(c, pre->z + k);
+        acb_mul(o, o, c, prec);
+        acb_mul_onei(o, o);
+        acb_add(t + k, t + k, o, prec);
+        acb_mul_2exp_si(t + k, t + k, -1);
+    }
+
+    acb_dft_inverse_precomp(s, t, pre->pre, prec);
+
+    for (j = 0; j < m; j++)
+    {
+        arb_swap(w + 2 * j, acb_realref(s + j));
+        arb_swap(w + 2 * j + 1, acb_imagref(s + j));
+    }
+
+    _acb_vec_clear(t, 2 * m + 2);
+}
+
+void
+acb_dft_real(acb_ptr w, arb_srcptr v, slong len, slong prec)
+{
+    acb_dft_real_pre_t pre;
+    acb_dft_real_precomp_init(pre, len, prec);
+    acb_dft_real_precomp(w, v, pre, prec);
+    acb_dft_real_precomp_clear(pre);
+}
+
+void
+acb_dft_inverse_real(arb_ptr w, acb_srcptr v, slong len, slong prec)
+{
+    acb_dft_real_pre_t pre;
+    acb_dft_real_precomp_init(pre, len, prec);
+    acb_dft_inverse_real_precomp(w, v, pre, prec);
+    acb_dft_real_precomp_clear(pre);
+}
@@ -9,10 +9,39 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_dft.h"
 
 #define REORDER 0
 
+typedef struct
+{
+    acb_ptr w;
+    acb_srcptr v;
+    acb_ptr t;
+    acb_dft_step_ptr cyc;
+    slong num;
+    slong prec;
+}
+step_work_t;
+
+static void
+step_inner_worker(slong i, step_work_t * work)
+{
+    acb_dft_step_struct c = work->cyc[0];
+
+    acb_dft_step(work->w + i * c.M, work->v + i * c.dv,
+        work->cyc + 1, work->num - 1, work->prec);
+}
+
+static void
+step_outer_worker(slong j, step_work_t * work)
+{
+    acb_dft_step_struct c = work->cyc[0];
+
+    acb_dft_precomp(work->t + c.m * j, work->w + j, c.pre, work->prec);
+}
+
 void
 acb_dft_step(acb_ptr w, acb_srcptr v, acb_dft_step_ptr cyc, slong num, slong prec)
 {
@@ -31,6 +60,8 @@ acb_dft_step(acb_ptr w, acb_srcptr v, acb_dft_step_ptr cyc, slong num, slong pre
         slong m = c.m, M = c.M, dv = c.dv, dz = c.dz;
         acb_srcptr z = c.z;
         acb_ptr t;
+        step_work_t work;
+        int threaded;
 #if REORDER
         acb_ptr w2;
 #endif
@@ -43,9 +74,24 @@ acb_dft_step(acb_ptr w, acb_srcptr v, acb_dft_step_ptr cyc, slong num, slong pre
             v = t;
         }
 
+        /* The sub-transforms are independent, so they can be done in
+           parallel without changing the result. */
+        threaded = (m * M >= ACB_DFT_THREAD_MIN_LEN &&
+            arb_flint_get_num_available_threads() > 1);
+
+        work.w = w;
+        work.v = v;
+        work.t = t;
+        work.cyc = cyc;
+        work.num = num;
+        work.prec = prec;
+
         /* m DFT of size M */
-        for (i = 0; i < m; i++)
-            acb_dft_step(w + i * M, v + i * dv, cyc + 1, num - 1, prec);
+        if (threaded)
+            flint_parallel_do((do_func_t) step_inner_worker, &work, m, -1, FLINT_PARALLEL_STRIDED);
+        else
+            for (i = 0; i < m; i++)
+                acb_dft_step(w + i * M, v + i * dv, cyc + 1, num - 1, prec);
 
         /* twiddle if non trivial product */
         if (c.z != NULL)
@@ -71,8 +117,11 @@ acb_dft_step(acb_ptr w, acb_srcptr v, acb_dft_step_ptr cyc, slong num, slong pre
 #endif
 
         /* M DFT of size m */
-        for (j = 0; j < M; j++)
-            acb_dft_precomp(t + m * j, w + j, c.pre, prec);
+        if (threaded)
+            flint_parallel_do((do_func_t) step_outer_worker, &work, M, -1, FLINT_PARALLEL_STRIDED);
+        else
+            for (j = 0; j < M; j++)
+                acb_dft_precomp(t + m * j, w + j, c.pre, prec);
 
         /* reorder */
         for (i = 0; i < m; i++)
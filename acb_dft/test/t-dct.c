@@ -0,0 +1,155 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dft.h"
+#include "arb_mat.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("dct....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* length 4, with exact input */
+    {
+        arb_mat_t A, X, Y;
+        arb_ptr v, w, u;
+        slong i;
+
+        v = _arb_vec_init(4);
+        w = _arb_vec_init(4);
+        u = _arb_vec_init(4);
+        arb_mat_init(A, 4, 4);
+        arb_mat_init(X, 4, 1);
+        arb_mat_init(Y, 4, 1);
+
+        for (i = 0; i < 4; i++)
+        {
+            arb_set_ui(v + i, i + 1);
+            arb_set(arb_mat_entry(X, i, 0), v + i);
+        }
+
+        arb_mat_dct(A, 0, 64);
+        arb_mat_mul(Y, A, X, 64);
+
+        acb_dft_dct2(w, v, 4, 64);
+        acb_dft_dct3(u, w, 4, 64);
+
+        for (i = 0; i < 4; i++)
+        {
+            if (!arb_overlaps(w + i, arb_mat_entry(Y, i, 0)) ||
+                !arb_overlaps(u + i, v + i))
+            {
+                flint_printf("FAIL (len = 4)\n\n");
+                flint_printf("i = %wd\n\n", i);
+                flint_printf("w = "); arb_printd(w + i, 15); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(arb_mat_entry(Y, i, 0), 15); flint_printf("\n\n");
+                flint_printf("u = "); arb_printd(u + i, 15); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _arb_vec_clear(v, 4);
+        _arb_vec_clear(w, 4);
+        _arb_vec_clear(u, 4);
+        arb_mat_clear(A);
+        arb_mat_clear(X);
+        arb_mat_clear(Y);
+    }
+
+    for (iter = 0; iter < 500 * arb_test_multiplier(); iter++)
+    {
+        acb_dft_dct_pre_t pre;
+        arb_mat_t A, X, Y;
+        arb_ptr v, w, u;
+        slong i, len, prec;
+
+        len = n_randint(state, 2) ? n_randint(state, 20) : n_randint(state, 100);
+        prec = 2 + n_randint(state, 200);
+
+        v = _arb_vec_init(len);
+        w = _arb_vec_init(len);
+        u = _arb_vec_init(len);
+        arb_mat_init(A, len, len);
+        arb_mat_init(X, len, 1);
+        arb_mat_init(Y, len, 1);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_randtest_precise(v + i, state, 1 + n_randint(state, 200), 4);
+            arb_set(arb_mat_entry(X, i, 0), v + i);
+        }
+
+        arb_mat_dct(A, 0, prec);
+        arb_mat_mul(Y, A, X, prec);
+
+        acb_dft_dct_precomp_init(pre, len, prec);
+        acb_dft_dct2_precomp(w, v, pre, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!arb_overlaps(w + i, arb_mat_entry(Y, i, 0)))
+            {
+                flint_printf("FAIL (dct2)\n\n");
+                flint_printf("len = %wd, prec = %wd, i = %wd\n\n", len, prec, i);
+                flint_printf("w = "); arb_printd(w + i, 15); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(arb_mat_entry(Y, i, 0), 15); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        acb_dft_dct3_precomp(u, w, pre, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!arb_overlaps(u + i, v + i))
+            {
+                flint_printf("FAIL (dct3)\n\n");
+                flint_printf("len = %wd, prec = %wd, i = %wd\n\n", len, prec, i);
+                flint_printf("u = "); arb_printd(u + i, 15); flint_printf("\n\n");
+                flint_printf("v = "); arb_printd(v + i, 15); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        /* aliasing */
+        acb_dft_dct2_precomp(u, u, pre, prec);
+        acb_dft_dct3_precomp(u, u, pre, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!arb_overlaps(u + i, v + i))
+            {
+                flint_printf("FAIL (aliasing)\n\n");
+                flint_printf("len = %wd, prec = %wd, i = %wd\n\n", len, prec, i);
+                flint_abort();
+            }
+        }
+
+        acb_dft_dct_precomp_clear(pre);
+
+        _arb_vec_clear(v, len);
+        _arb_vec_clear(w, len);
+        _arb_vec_clear(u, len);
+        arb_mat_clear(A);
+        arb_mat_clear(X);
+        arb_mat_clear(Y);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
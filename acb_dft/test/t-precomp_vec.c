@@ -0,0 +1,106 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dft.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("precomp_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100 * arb_test_multiplier(); iter++)
+    {
+        acb_dft_pre_t pre;
+        acb_ptr v, w1, w2, w3;
+        slong i, len, num, prec;
+
+        if (n_randint(state, 2))
+            len = 3 * 5 * 7 * (1 + n_randint(state, 4)) * (1 + n_randint(state, 3));
+        else
+            len = n_randint(state, 600);
+
+        num = n_randint(state, 5);
+        prec = 2 + n_randint(state, 200);
+
+        v = _acb_vec_init(len * num);
+        w1 = _acb_vec_init(len * num);
+        w2 = _acb_vec_init(len * num);
+        w3 = _acb_vec_init(len * num);
+
+        for (i = 0; i < len * num; i++)
+            acb_randtest_precise(v + i, state, 1 + n_randint(state, 200), 4);
+
+        acb_dft_precomp_init(pre, len, prec);
+
+        flint_set_num_threads(1);
+        for (i = 0; i < num; i++)
+            acb_dft_precomp(w1 + i * len, v + i * len, pre, prec);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        acb_dft_precomp_vec(w2, v, num, pre, prec);
+
+        for (i = 0; i < len * num; i++)
+        {
+            if (!acb_equal(w1 + i, w2 + i))
+            {
+                flint_printf("FAIL (threads)\n\n");
+                flint_printf("len = %wd, num = %wd, prec = %wd, i = %wd\n\n", len, num, prec, i);
+                flint_abort();
+            }
+        }
+
+        acb_dft_inverse_precomp_vec(w3, w2, num, pre, prec);
+
+        for (i = 0; i < len * num; i++)
+        {
+            if (!acb_overlaps(w3 + i, v + i))
+            {
+                flint_printf("FAIL (inverse)\n\n");
+                flint_printf("len = %wd, num = %wd, prec = %wd, i = %wd\n\n", len, num, prec, i);
+                flint_abort();
+            }
+        }
+
+        /* convolution with a reused scheme */
+        if (num >= 2)
+        {
+            acb_dft_convol_dft_precomp(w1, v, v + len, pre, prec);
+            acb_dft_convol_naive(w2, v, v + len, len, prec);
+
+            for (i = 0; i < len; i++)
+            {
+                if (!acb_overlaps(w1 + i, w2 + i))
+                {
+                    flint_printf("FAIL (convol)\n\n");
+                    flint_printf("len = %wd, prec = %wd, i = %wd\n\n", len, prec, i);
+                    flint_abort();
+                }
+            }
+        }
+
+        acb_dft_precomp_clear(pre);
+
+        _acb_vec_clear(v, len * num);
+        _acb_vec_clear(w1, len * num);
+        _acb_vec_clear(w2, len * num);
+        _acb_vec_clear(w3, len * num);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
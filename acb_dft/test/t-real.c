@@ -0,0 +1,125 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dft.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("real....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* length 4: X = (10, -2 + 2i, -2) for v = (1, 2, 3, 4) */
+    {
+        arb_ptr v;
+        acb_ptr w, x;
+        slong i;
+
+        v = _arb_vec_init(4);
+        w = _acb_vec_init(3);
+        x = _acb_vec_init(3);
+
+        for (i = 0; i < 4; i++)
+            arb_set_ui(v + i, i + 1);
+
+        acb_set_si(x, 10);
+        acb_set_si_si(x + 1, -2, 2);
+        acb_set_si(x + 2, -2);
+
+        acb_dft_real(w, v, 4, 64);
+
+        for (i = 0; i < 3; i++)
+        {
+            if (!acb_contains(w + i, x + i))
+            {
+                flint_printf("FAIL (len = 4)\n\n");
+                flint_printf("i = %wd\n\n", i);
+                flint_printf("w = "); acb_printd(w + i, 15); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _arb_vec_clear(v, 4);
+        _acb_vec_clear(w, 3);
+        _acb_vec_clear(x, 3);
+    }
+
+    for (iter = 0; iter < 500 * arb_test_multiplier(); iter++)
+    {
+        acb_dft_real_pre_t pre;
+        arb_ptr v, u;
+        acb_ptr w, x, y;
+        slong i, len, prec;
+
+        len = n_randint(state, 2) ? n_randint(state, 30) : n_randint(state, 300);
+        prec = 2 + n_randint(state, 200);
+
+        v = _arb_vec_init(len);
+        u = _arb_vec_init(len);
+        w = _acb_vec_init(len / 2 + 1);
+        x = _acb_vec_init(len);
+        y = _acb_vec_init(len);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_randtest_precise(v + i, state, 1 + n_randint(state, 200), 4);
+            acb_set_arb(y + i, v + i);
+        }
+
+        acb_dft(x, y, len, prec);
+
+        acb_dft_real_precomp_init(pre, len, prec);
+        acb_dft_real_precomp(w, v, pre, prec);
+
+        for (i = 0; 2 * i <= len && len > 0; i++)
+        {
+            if (!acb_overlaps(w + i, x + i))
+            {
+                flint_printf("FAIL (dft)\n\n");
+                flint_printf("len = %wd, prec = %wd, i = %wd\n\n", len, prec, i);
+                flint_printf("w = "); acb_printd(w + i, 15); flint_printf("\n\n");
+                flint_printf("x = "); acb_printd(x + i, 15); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        acb_dft_inverse_real_precomp(u, w, pre, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!arb_overlaps(u + i, v + i))
+            {
+                flint_printf("FAIL (inverse)\n\n");
+                flint_printf("len = %wd, prec = %wd, i = %wd\n\n", len, prec, i);
+                flint_printf("u = "); arb_printd(u + i, 15); flint_printf("\n\n");
+                flint_printf("v = "); arb_printd(v + i, 15); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        acb_dft_real_precomp_clear(pre);
+
+        _arb_vec_clear(v, len);
+        _arb_vec_clear(u, len);
+        _acb_vec_clear(w, len / 2 + 1);
+        _acb_vec_clear(x, len);
+        _acb_vec_clear(y, len);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
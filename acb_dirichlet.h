@@ -53,6 +53,7 @@ void acb_dirichlet_lerch_phi_direct(acb_t res, const acb_t z, const acb_t s, con
 void acb_dirichlet_lerch_phi(acb_t res, const acb_t z, const acb_t s, const acb_t a, slong prec);
 
 void acb_dirichlet_stieltjes(acb_t res, const fmpz_t n, const acb_t a, slong prec);
+void acb_dirichlet_stieltjes_vec(acb_ptr res, const fmpz_t n, const acb_t a, slong num, slong prec);
 
 typedef struct
 {
@@ -77,6 +78,8 @@ void acb_dirichlet_hurwitz_precomp_choose_param(ulong * A, ulong * K, ulong * N,
 
 void _acb_dirichlet_euler_product_real_ui(arb_t res, ulong s,
     const signed char * chi, int mod, int reciprocal, slong prec);
+ulong _acb_dirichlet_euler_product_cutoff(ulong s, slong prec, ulong limit);
+slong _acb_dirichlet_euler_product_num_segments(ulong start, ulong stop);
 
 void acb_dirichlet_eta(acb_t res, const acb_t s, slong prec);
 
@@ -9,56 +9,118 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_dirichlet.h"
 
 #define ONE_OVER_LOG2 1.4426950408889634
 
+/* minimum width and maximum number of segments of the prime range */
+#define EULER_SEGMENT_MIN 4096
+#define EULER_MAX_SEGMENTS 64
+
+/* zeta(s,p) ~= 1/p^s + 1/((s-1) p^(s-1)) */
+static int
+_euler_product_negligible(ulong s, ulong p, slong prec)
+{
+    double logp, powmag, errmag;
+
+    logp = log(p);
+    powmag = s * logp * ONE_OVER_LOG2;
+    errmag = (log(s - 1.0) + (s - 1.0) * logp) * ONE_OVER_LOG2;
+    errmag = FLINT_MIN(powmag, errmag);
+
+    return errmag > prec + 2;
+}
+
+ulong
+_acb_dirichlet_euler_product_cutoff(ulong s, slong prec, ulong limit)
+{
+    ulong a, b, m;
+
+    if (limit <= 2 || _euler_product_negligible(s, 2, prec))
+        return FLINT_MIN(limit, 2);
+
+    /* invariant: the factor at a is not negligible; b is the limit
+       or the factor at b is negligible */
+    a = 2;
+    b = limit;
+
+    while (b - a > 1)
+    {
+        m = a + (b - a) / 2;
+
+        if (_euler_product_negligible(s, m, prec))
+            b = m;
+        else
+            a = m;
+    }
+
+    return b;
+}
+
+slong
+_acb_dirichlet_euler_product_num_segments(ulong start, ulong stop)
+{
+    if (stop <= start)
+        return 1;
+
+    return FLINT_MAX(1, FLINT_MIN(EULER_MAX_SEGMENTS, (stop - start) / EULER_SEGMENT_MIN));
+}
+
+/* Partial product over the primes in segment i of [start, stop). */
 typedef struct
 {
+    arb_ptr v;
     ulong s;
     int mod;
     const signed char * chi;
-    mp_ptr primes;
-    double * powmags;
-    slong num_primes;
     slong wp;
-    slong index;
-    slong num_threads;
-    arb_struct res;
+    ulong start;
+    ulong stop;
+    slong num_segments;
 }
-euler_work_chunk_t;
+euler_work_t;
 
 static void
-euler_worker(void * _work)
+euler_worker(slong i, euler_work_t * work)
 {
-    euler_work_chunk_t * work = ((euler_work_chunk_t *) _work);
-    slong i;
-
+    n_primes_t iter;
+    arb_ptr v;
+    arb_t t, u;
+    ulong p, lo, hi;
     slong powprec;
     double powmag;
-    arb_t t, u;
-    ulong p;
+
+    v = work->v + i;
+    lo = work->start + ((work->stop - work->start) * i) / work->num_segments;
+    hi = work->start + ((work->stop - work->start) * (i + 1)) / work->num_segments;
 
     arb_init(t);
     arb_init(u);
+    arb_one(v);
 
-    for (i = work->index; i < work->num_primes; i += work->num_threads)
-    {
-        p = work->primes[i];
-        powmag = work->powmags[i];
+    n_primes_init(iter);
+    n_primes_jump_after(iter, lo - 1);
 
-        powprec = FLINT_MAX(work->wp - powmag, 8);
+    for (p = n_primes_next(iter); p < hi; p = n_primes_next(iter))
+    {
+        if (work->mod == 1 || work->chi[p % work->mod] != 0)
+        {
+            powmag = work->s * log(p) * ONE_OVER_LOG2;
+            powprec = FLINT_MAX(work->wp - powmag, 8);
 
-        arb_ui_pow_ui(t, p, work->s, powprec);
-        arb_set_round(u, &work->res, powprec);
-        arb_div(t, u, t, powprec);
+            arb_ui_pow_ui(t, p, work->s, powprec);
+            arb_set_round(u, v, powprec);
+            arb_div(t, u, t, powprec);
 
-        if (work->mod == 1 || (work->chi[p % work->mod] == 1))
-            arb_sub(&work->res, &work->res, t, work->wp);
-        else
-            arb_add(&work->res, &work->res, t, work->wp);
+            if (work->mod == 1 || (work->chi[p % work->mod] == 1))
+                arb_sub(v, v, t, work->wp);
+            else
+                arb_add(v, v, t, work->wp);
+        }
     }
 
+    n_primes_clear(iter);
     arb_clear(t);
     arb_clear(u);
 }
@@ -71,7 +133,8 @@ void _acb_dirichlet_euler_product_real_ui(arb_t res, ulong s,
     arb_t t, u;
     ulong p;
     mag_t err;
-    slong num_threads;
+    ulong stop;
+    slong num_segments;
 
     if (s <= 1)
     {
@@ -130,115 +193,48 @@ void _acb_dirichlet_euler_product_real_ui(arb_t res, ulong s,
        which gives prec ^ 1.2956 here. */
     limit = 100 + prec * sqrt(prec);
 
-    num_threads = arb_flint_get_num_available_threads();
+    stop = _acb_dirichlet_euler_product_cutoff(s, prec, (ulong) ceil(limit));
+    num_segments = _acb_dirichlet_euler_product_num_segments(3, stop);
 
-    if (num_threads > 1 && prec > 5000 && s > 5000)
+    if (num_segments > 1)
     {
-        n_primes_t iter;
+        euler_work_t work;
         slong i;
-        mp_ptr primes;
-        double * powmags;
-        slong num_primes = 0;
-        slong alloc = 16;
-        slong thread_limit, num_threads, num_workers;
-        thread_pool_handle * handles;
-        euler_work_chunk_t * work;
 
-        ulong first_omitted_p = 3;
-
-        n_primes_init(iter);
-        n_primes_jump_after(iter, 3);
-
-        primes = flint_malloc(alloc * sizeof(mp_limb_t));
-        powmags = flint_malloc(alloc * sizeof(double));
-
-        for (p = 3; p < limit; p = n_primes_next(iter))
-        {
-            first_omitted_p = p;
-
-            if (mod == 1 || chi[p % mod] != 0)
-            {
-                /* p^s */
-                logp = log(p);
-                powmag = s * logp * ONE_OVER_LOG2;
-
-                /* zeta(s,p) ~= 1/p^s + 1/((s-1) p^(s-1)) */
-                errmag = (log(s - 1.0) + (s - 1.0) * logp) * ONE_OVER_LOG2;
-                errmag = FLINT_MIN(powmag, errmag);
-
-                if (errmag > prec + 2)
-                    break;
-
-                if (num_primes >= alloc)
-                {
-                    alloc *= 2;
-                    primes = flint_realloc(primes, alloc * sizeof(mp_limb_t));
-                    powmags = flint_realloc(powmags, alloc * sizeof(double));
-                }
-
-                primes[num_primes] = p;
-                powmags[num_primes] = powmag;
-
-                num_primes++;
-            }
-        }
-
-        n_primes_clear(iter);
-
-        thread_limit = flint_get_num_threads();
-        thread_limit = FLINT_MIN(thread_limit, num_primes / 4);
-        thread_limit = FLINT_MAX(thread_limit, 1);
-
-        num_workers = flint_request_threads(&handles, thread_limit);
-        num_threads = num_workers + 1;
-
-        work = flint_malloc(num_threads * sizeof(euler_work_chunk_t));
-
-        for (i = 0; i < num_threads; i++)
-        {
-            work[i].s = s;
-            work[i].mod = mod;
-            work[i].chi = chi;
-            work[i].primes = primes;
-            work[i].powmags = powmags;
-            work[i].num_primes = num_primes;
-            work[i].wp = wp;
-            work[i].index = i;
-            work[i].num_threads = num_threads;
-            arb_init(&work[i].res);
-            arb_one(&work[i].res);
-        }
-
-        for (i = 0; i < num_workers; i++)
-            thread_pool_wake(global_thread_pool, handles[i], 0, euler_worker, &work[i]);
-
-        euler_worker(&work[num_workers]);
-
-        for (i = 0; i < num_workers; i++)
-            thread_pool_wait(global_thread_pool, handles[i]);
-
-        flint_give_back_threads(handles, num_workers);
+        work.v = _arb_vec_init(num_segments);
+        work.s = s;
+        work.mod = mod;
+        work.chi = chi;
+        work.wp = wp;
+        work.start = 3;
+        work.stop = stop;
+        work.num_segments = num_segments;
+
+        if (arb_flint_get_num_available_threads() > 1)
+            flint_parallel_do((do_func_t) euler_worker, &work, num_segments, -1, FLINT_PARALLEL_STRIDED);
+        else
+            for (i = 0; i < num_segments; i++)
+                euler_worker(i, &work);
 
-        for (i = 0; i < num_threads; i++)
-        {
-            arb_mul(res, res, &work[i].res, wp);
-            arb_clear(&work[i].res);
-        }
+        /* the segmentation does not depend on the number of threads,
+           and the partial products are combined in a fixed order */
+        for (i = 0; i < num_segments; i++)
+            arb_mul(res, res, work.v + i, wp);
 
-        flint_free(work);
+        _arb_vec_clear(work.v, num_segments);
 
-        flint_free(primes);
-        flint_free(powmags);
+        /* first omitted prime with a nonzero character value */
+        p = n_nextprime(stop - 1, 1);
+        while (mod != 1 && chi[p % mod] == 0)
+            p = n_nextprime(p, 1);
 
         mag_init(err);
-        mag_hurwitz_zeta_uiui(err, s, first_omitted_p);
+        mag_hurwitz_zeta_uiui(err, s, p);
         arb_add_error_mag(res, err);
         mag_clear(err);
     }
     else
     {
-        /* todo: prime iterator here too? */
-
         for (p = 3; p < limit; p = n_nextprime(p, 1))
         {
             if (mod == 1 || chi[p % mod] != 0)
@@ -9,20 +9,106 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_dirichlet.h"
 
 #define ONE_OVER_LOG2 1.4426950408889634
 
+/* tabulate the character values modulo q up to this size */
+#define EULER_CHI_TABLE_MAX (WORD(1) << 20)
+
+/* Partial product over the primes in segment i of [start, stop). */
+typedef struct
+{
+    acb_ptr v;
+    const acb_struct * s;
+    const acb_struct * negs;
+    const dirichlet_group_struct * G;
+    const dirichlet_char_struct * chi;
+    const ulong * table;
+    const acb_dirichlet_roots_struct * roots;
+    int is_int;
+    slong left_s;
+    slong wp;
+    ulong start;
+    ulong stop;
+    slong num_segments;
+}
+euler_work_t;
+
+static void
+euler_worker(slong i, euler_work_t * work)
+{
+    n_primes_t iter;
+    acb_ptr v;
+    acb_t t, u, c;
+    ulong p, lo, hi, val;
+    slong powprec;
+    double powmag;
+
+    v = work->v + i;
+    lo = work->start + ((work->stop - work->start) * i) / work->num_segments;
+    hi = work->start + ((work->stop - work->start) * (i + 1)) / work->num_segments;
+
+    acb_init(t);
+    acb_init(u);
+    acb_init(c);
+    acb_one(v);
+
+    n_primes_init(iter);
+    n_primes_jump_after(iter, lo - 1);
+
+    for (p = n_primes_next(iter); p < hi; p = n_primes_next(iter))
+    {
+        if (work->table != NULL)
+            val = work->table[p % work->G->q];
+        else
+            val = dirichlet_chi(work->G, work->chi, p);
+
+        if (val == DIRICHLET_CHI_NULL)
+            continue;
+
+        /* p^s */
+        powmag = work->left_s * log(p) * ONE_OVER_LOG2;
+        powprec = FLINT_MAX(work->wp - powmag, 8);
+
+        acb_dirichlet_root(c, work->roots, val, powprec);
+        acb_set_ui(t, p);
+
+        if (work->is_int)
+        {
+            acb_pow(t, t, work->s, powprec);
+            acb_set_round(u, v, powprec);
+            acb_div(t, u, t, powprec);
+        }
+        else
+        {
+            acb_pow(t, t, work->negs, powprec);
+            acb_set_round(u, v, powprec);
+            acb_mul(t, u, t, powprec);
+        }
+
+        acb_mul(t, t, c, powprec);
+        acb_sub(v, v, t, work->wp);
+    }
+
+    n_primes_clear(iter);
+    acb_clear(t);
+    acb_clear(u);
+    acb_clear(c);
+}
+
 void
 acb_dirichlet_l_euler_product(acb_t res, const acb_t s,
     const dirichlet_group_t G, const dirichlet_char_t chi, slong prec)
 {
     arf_t left;
-    slong wp, powprec, left_s, acc;
-    ulong val, p, p_limit;
-    double p_needed_approx, powmag, logp, errmag;
-    int is_real, is_int;
-    acb_t t, u, v, c, negs;
+    slong wp, left_s, acc;
+    ulong p, p_limit, stop;
+    ulong * table = NULL;
+    double p_needed_approx;
+    int is_real;
+    acb_t v, negs;
     acb_dirichlet_roots_t roots;
     mag_t err;
 
@@ -85,57 +171,60 @@ acb_dirichlet_l_euler_product(acb_t res, const acb_t s,
     acb_dirichlet_roots_init(roots, G->expo,
         p_needed_approx / (1.0 + log(p_needed_approx)), wp);
 
-    acb_init(t);
-    acb_init(u);
     acb_init(v);
-    acb_init(c);
     acb_init(negs);
 
-    is_int = acb_is_int(s);
-
     acb_neg(negs, s);
-    acb_one(v);
-
-    for (p = 2; p < p_limit; p = n_nextprime(p, 1))
-    {
-        /* p^s */
-        logp = log(p);
-        powmag = left_s * logp * ONE_OVER_LOG2;
 
-        /* zeta(s,p) ~= 1/p^s + 1/((s-1) p^(s-1)) */
-        errmag = (log(left_s - 1.0) + (left_s - 1.0) * logp) * ONE_OVER_LOG2;
-        errmag = FLINT_MIN(powmag, errmag);
+    stop = _acb_dirichlet_euler_product_cutoff(left_s, prec, p_limit);
 
-        if (errmag > prec + 2)
-            break;
-
-        powprec = FLINT_MAX(wp - powmag, 8);
-
-        val = dirichlet_chi(G, chi, p);
+    /* character values from a table indexed by p mod q */
+    if (G->q <= EULER_CHI_TABLE_MAX && G->q <= stop)
+    {
+        table = flint_malloc(sizeof(ulong) * FLINT_MAX(G->q, 2));
+        dirichlet_chi_vec(table, G, chi, G->q);
+        if (G->q == 1)
+            table[0] = 0;
+    }
 
-        if (val != DIRICHLET_CHI_NULL)
-        {
-            acb_dirichlet_root(c, roots, val, powprec);
-            acb_set_ui(t, p);
-
-            if (is_int)
-            {
-                acb_pow(t, t, s, powprec);
-                acb_set_round(u, v, powprec);
-                acb_div(t, u, t, powprec);
-            }
-            else
-            {
-                acb_pow(t, t, negs, powprec);
-                acb_set_round(u, v, powprec);
-                acb_mul(t, u, t, powprec);
-            }
-
-            acb_mul(t, t, c, powprec);
-            acb_sub(v, v, t, wp);
-        }
+    {
+        euler_work_t work;
+        slong i;
+
+        work.num_segments = _acb_dirichlet_euler_product_num_segments(2, stop);
+        work.v = _acb_vec_init(work.num_segments);
+        work.s = s;
+        work.negs = negs;
+        work.G = G;
+        work.chi = chi;
+        work.table = table;
+        work.roots = roots;
+        work.is_int = acb_is_int(s);
+        work.left_s = left_s;
+        work.wp = wp;
+        work.start = 2;
+        work.stop = stop;
+
+        if (work.num_segments > 1 && arb_flint_get_num_available_threads() > 1)
+            flint_parallel_do((do_func_t) euler_worker, &work, work.num_segments, -1, FLINT_PARALLEL_STRIDED);
+        else
+            for (i = 0; i < work.num_segments; i++)
+                euler_worker(i, &work);
+
+        /* the segmentation does not depend on the number of threads,
+           and the partial products are combined in a fixed order */
+        acb_set(v, work.v);
+        for (i = 1; i < work.num_segments; i++)
+            acb_mul(v, v, work.v + i, wp);
+
+        _acb_vec_clear(work.v, work.num_segments);
     }
 
+    /* first omitted prime with a nonzero character value */
+    p = n_nextprime(FLINT_MAX(stop, 2) - 1, 1);
+    while (p < p_limit && dirichlet_chi(G, chi, p) == DIRICHLET_CHI_NULL)
+        p = n_nextprime(p, 1);
+
     mag_init(err);
     mag_hurwitz_zeta_uiui(err, left_s, p);
     if (is_real)
@@ -146,11 +235,11 @@ acb_dirichlet_l_euler_product(acb_t res, const acb_t s,
 
     acb_inv(res, v, prec);
 
+    if (table != NULL)
+        flint_free(table);
+
     acb_dirichlet_roots_clear(roots);
-    acb_clear(t);
-    acb_clear(u);
     acb_clear(v);
-    acb_clear(c);
     acb_clear(negs);
     arf_clear(left);
 }
@@ -11,6 +11,7 @@
 
 #include <math.h>
 #include "flint/double_extras.h"
+#include "flint/thread_support.h"
 #include "acb_dirichlet.h"
 #include "acb_calc.h"
 
@@ -478,6 +479,27 @@ stieltjes_tail_bound(mag_t bound, const arb_t N, const fmpz_t n1, const acb_t al
     mag_clear(u);
 }
 
+typedef struct
+{
+    acb_ptr w;
+    acb_srcptr a;
+    acb_srcptr b;
+    _stieltjes_param * param;
+    const mag_struct * tol;
+    const acb_calc_integrate_opt_struct * opt;
+    slong wp;
+}
+segment_work_t;
+
+static void
+segment_worker(slong i, void * _work)
+{
+    segment_work_t * work = (segment_work_t *) _work;
+
+    acb_calc_integrate(work->w + i, _f_stieltjes, work->param,
+        work->a + i, work->b + i, work->wp, work->tol, work->opt, work->wp);
+}
+
 void
 _acb_dirichlet_stieltjes_integral2(acb_t res, const fmpz_t n, const acb_t alpha, slong prec)
 {
@@ -565,6 +587,41 @@ _acb_dirichlet_stieltjes_integral2(acb_t res, const fmpz_t n, const acb_t alpha,
         acb_calc_integrate(w, _f_stieltjes, &param, a, b, wp, tol, opt, wp);
         acb_add(v, v, w, wp);
     }
+    else if (arb_flint_get_num_available_threads() > 1)
+    {
+        /* integrate the four segments of the path concurrently;
+           they are added in a fixed order */
+        segment_work_t work;
+        acb_ptr zv, wv;
+        slong i;
+
+        zv = _acb_vec_init(5);
+        wv = _acb_vec_init(4);
+
+        acb_zero(zv + 0);                        /* 0 */
+        acb_set_arb(zv + 1, M);                  /* M */
+        acb_set_arb(zv + 2, M);
+        arb_set(acb_imagref(zv + 2), C);         /* M + i C */
+        acb_set_arb(zv + 3, N);
+        arb_set(acb_imagref(zv + 3), C);         /* N + i C */
+        acb_set_arb(zv + 4, N);                  /* N */
+
+        work.w = wv;
+        work.a = zv;
+        work.b = zv + 1;
+        work.param = &param;
+        work.tol = tol;
+        work.opt = opt;
+        work.wp = wp;
+
+        flint_parallel_do((do_func_t) segment_worker, &work, 4, -1, FLINT_PARALLEL_UNIFORM);
+
+        for (i = 0; i < 4; i++)
+            acb_add(v, v, wv + i, wp);
+
+        _acb_vec_clear(zv, 5);
+        _acb_vec_clear(wv, 4);
+    }
     else
     {
         acb_zero(a);                 /* a = 0 */
@@ -767,3 +824,132 @@ acb_dirichlet_stieltjes(acb_t res, const fmpz_t n, const acb_t a, slong prec)
     }
 }
 
+typedef struct
+{
+    acb_ptr res;
+    const fmpz * n;
+    acb_srcptr a;
+    slong prec;
+}
+stieltjes_work_t;
+
+static void
+stieltjes_worker(slong i, void * _work)
+{
+    stieltjes_work_t * work = (stieltjes_work_t *) _work;
+    fmpz_t k;
+
+    fmpz_init(k);
+    fmpz_add_ui(k, work->n, i);
+    acb_dirichlet_stieltjes_integral(work->res + i, k, work->a, work->prec);
+    fmpz_clear(k);
+}
+
+void
+acb_dirichlet_stieltjes_vec(acb_ptr res, const fmpz_t n, const acb_t a, slong num, slong prec)
+{
+    slong i, cutoff, num_em;
+
+    if (num <= 0)
+        return;
+
+    if (num == 1)
+    {
+        acb_dirichlet_stieltjes(res, n, a, prec);
+        return;
+    }
+
+    if (fmpz_sgn(n) < 0)
+    {
+        flint_printf("stieltjes constants only defined for n >= 0");
+        flint_abort();
+    }
+
+    if (acb_contains_int(a) && !arb_is_positive(acb_realref(a)))
+    {
+        _acb_vec_indeterminate(res, num);
+        return;
+    }
+
+    cutoff = FLINT_MAX(100, prec / 2);
+    cutoff = FLINT_MIN(cutoff, 10000);
+
+    if (fmpz_cmp_ui(n, cutoff) < 0)
+        num_em = FLINT_MIN(num, cutoff - fmpz_get_si(n));
+    else
+        num_em = 0;
+
+    /* One Euler-Maclaurin evaluation of the zeta series gives all
+       the coefficients below the cutoff. */
+    if (num_em != 0)
+    {
+        slong n0, nn, wp;
+        acb_ptr z;
+        acb_t s;
+        arb_t f;
+
+        n0 = fmpz_get_si(n);
+        nn = n0 + num_em - 1;
+
+        acb_init(s);
+        arb_init(f);
+        z = _acb_vec_init(nn + 1);
+
+        wp = prec * 1.05 + 2.2*nn + 10;  /* as in acb_dirichlet_stieltjes_em */
+
+        acb_one(s);
+        _acb_poly_zeta_cpx_series(z, s, a, 1, nn + 1, wp);
+
+        arb_fac_ui(f, n0, prec + 10);
+
+        for (i = 0; i < num_em; i++)
+        {
+            if (i != 0)
+                arb_mul_ui(f, f, n0 + i, prec + 10);
+
+            if (n0 + i == 0 && acb_is_one(a))
+            {
+                arb_const_euler(acb_realref(res + i), prec);
+                arb_zero(acb_imagref(res + i));
+                continue;
+            }
+
+            acb_mul_arb(res + i, z + n0 + i, f, prec);
+
+            if ((n0 + i) % 2 == 1)
+                acb_neg(res + i, res + i);
+        }
+
+        acb_clear(s);
+        arb_clear(f);
+        _acb_vec_clear(z, nn + 1);
+    }
+
+    /* The remaining constants are independent integrals. */
+    if (num_em < num)
+    {
+        stieltjes_work_t work;
+        fmpz_t k;
+
+        fmpz_init(k);
+        fmpz_add_ui(k, n, num_em);
+
+        work.res = res + num_em;
+        work.n = k;
+        work.a = a;
+        work.prec = prec;
+
+        if (arb_flint_get_num_available_threads() > 1)
+        {
+            flint_parallel_do((do_func_t) stieltjes_worker, &work,
+                num - num_em, -1, FLINT_PARALLEL_STRIDED);
+        }
+        else
+        {
+            for (i = 0; i < num - num_em; i++)
+                stieltjes_worker(i, &work);
+        }
+
+        fmpz_clear(k);
+    }
+}
@@ -73,6 +73,8 @@ int main()
         arb_init(res2);
         arb_randtest(res1, state, 200, 100);
 
+        flint_set_num_threads(1 + n_randint(state, 3));
+
         _acb_dirichlet_euler_product_real_ui(res1, s, chi[choice] + 1,
             chi[choice][0], reciprocal1, prec1);
         _acb_dirichlet_euler_product_real_ui(res2, s, chi[choice] + 1,
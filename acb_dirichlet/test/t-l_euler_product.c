@@ -23,7 +23,7 @@ int main()
 
     for (iter = 0; iter < 500 * arb_test_multiplier(); iter++)
     {
-        acb_t s, t, u;
+        acb_t s, t, u, v;
         dirichlet_group_t G;
         dirichlet_char_t chi;
         ulong q, k;
@@ -32,6 +32,7 @@ int main()
         acb_init(s);
         acb_init(t);
         acb_init(u);
+        acb_init(v);
 
         q = 1 + n_randint(state, 50);
         prec = 2 + n_randint(state, 500);
@@ -58,6 +59,7 @@ int main()
         else
             acb_dirichlet_l_euler_product(t, s, G, chi, prec * 1.5);
 
+        flint_set_num_threads(1 + n_randint(state, 3));
         acb_dirichlet_l_euler_product(u, s, G, chi, prec);
 
         if (!acb_overlaps(t, u))
@@ -70,11 +72,25 @@ int main()
             flint_abort();
         }
 
+        /* the result must not depend on the number of threads */
+        flint_set_num_threads(1);
+        acb_dirichlet_l_euler_product(v, s, G, chi, prec);
+
+        if (!acb_equal(u, v))
+        {
+            flint_printf("FAIL: threads\n\n");
+            flint_printf("iter = %wd  q = %wu  k = %wu  prec = %wd\n\n", iter, q, k, prec);
+            flint_printf("u = "); acb_printn(u, 100, 0); flint_printf("\n\n");
+            flint_printf("v = "); acb_printn(v, 100, 0); flint_printf("\n\n");
+            flint_abort();
+        }
+
         dirichlet_char_clear(chi);
         dirichlet_group_clear(G);
         acb_clear(s);
         acb_clear(t);
         acb_clear(u);
+        acb_clear(v);
     }
 
     flint_randclear(state);
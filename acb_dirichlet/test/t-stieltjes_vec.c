@@ -0,0 +1,79 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("stieltjes_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100 * arb_test_multiplier(); iter++)
+    {
+        acb_ptr v;
+        acb_t a, b;
+        fmpz_t n, k;
+        slong i, num, prec1, prec2;
+
+        fmpz_init(n);
+        fmpz_init(k);
+        acb_init(a);
+        acb_init(b);
+
+        num = 1 + n_randint(state, 8);
+        fmpz_set_ui(n, n_randint(state, 150));
+        prec1 = 2 + n_randint(state, 200);
+        prec2 = 2 + n_randint(state, 200);
+
+        if (n_randint(state, 4) == 0)
+            acb_randtest_precise(a, state, 200, 2);
+        else
+            acb_one(a);
+
+        v = _acb_vec_init(num);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+        acb_dirichlet_stieltjes_vec(v, n, a, num, prec1);
+
+        for (i = 0; i < num; i++)
+        {
+            fmpz_add_ui(k, n, i);
+            acb_dirichlet_stieltjes(b, k, a, prec2);
+
+            if (!acb_overlaps(v + i, b))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("iter = %wd, i = %wd\n\n", iter, i);
+                flint_printf("n = "); fmpz_print(n); flint_printf("\n\n");
+                flint_printf("a = "); acb_printn(a, 100, 0); flint_printf("\n\n");
+                flint_printf("v = "); acb_printn(v + i, 100, 0); flint_printf("\n\n");
+                flint_printf("b = "); acb_printn(b, 100, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _acb_vec_clear(v, num);
+        acb_clear(a);
+        acb_clear(b);
+        fmpz_clear(n);
+        fmpz_clear(k);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -132,6 +132,8 @@ void acb_hypgeom_m(acb_t res, const acb_t a, const acb_t b, const acb_t z, int r
 void acb_hypgeom_1f1(acb_t res, const acb_t a, const acb_t b, const acb_t z, int regularized, slong prec);
 
 void acb_hypgeom_bessel_j_0f1(acb_t res, const acb_t nu, const acb_t z, slong prec);
+void acb_hypgeom_bessel_j_asymp_prefactors_fallback(acb_t Ap, acb_t Am, acb_t C, const acb_t nu, const acb_t z, slong prec);
+void acb_hypgeom_bessel_j_asymp_prefactors(acb_t Ap, acb_t Am, acb_t C, const acb_t nu, const acb_t z, slong prec);
 void acb_hypgeom_bessel_j_asymp(acb_t res, const acb_t nu, const acb_t z, slong prec);
 void acb_hypgeom_bessel_j(acb_t res, const acb_t nu, const acb_t z, slong prec);
 
@@ -149,6 +151,37 @@ void acb_hypgeom_bessel_k_scaled(acb_t res, const acb_t nu, const acb_t z, slong
 void acb_hypgeom_bessel_y(acb_t res, const acb_t nu, const acb_t z, slong prec);
 void acb_hypgeom_bessel_jy(acb_t res1, acb_t res2, const acb_t nu, const acb_t z, slong prec);
 
+typedef struct
+{
+    acb_struct nu;
+    int nu_int;
+    int nu_negint;
+    int nu_odd;
+    int nu_real;
+    acb_struct jnu;
+    acb_struct jb[2];
+    acb_struct kb1[2];
+    acb_struct kb2[2];
+    acb_struct jc;
+    acb_struct kgamma;
+    acb_struct kc;
+    acb_struct s;
+    acb_struct t;
+    acb_struct phase;
+    arb_struct rsqrt_2pi;
+    arb_struct sqrt_pi;
+}
+acb_hypgeom_bessel_precomp_struct;
+
+typedef acb_hypgeom_bessel_precomp_struct acb_hypgeom_bessel_precomp_t[1];
+
+void acb_hypgeom_bessel_precomp_init(acb_hypgeom_bessel_precomp_t pre, const acb_t nu, slong prec);
+void acb_hypgeom_bessel_precomp_clear(acb_hypgeom_bessel_precomp_t pre);
+void acb_hypgeom_bessel_precomp_eval_j(acb_t res, const acb_hypgeom_bessel_precomp_t pre, const acb_t z, slong prec);
+void acb_hypgeom_bessel_precomp_eval_k(acb_t res, const acb_hypgeom_bessel_precomp_t pre, const acb_t z, int scaled, slong prec);
+void acb_hypgeom_bessel_precomp_eval_j_vec(acb_ptr res, const acb_hypgeom_bessel_precomp_t pre, acb_srcptr z, slong len, slong prec);
+void acb_hypgeom_bessel_precomp_eval_k_vec(acb_ptr res, const acb_hypgeom_bessel_precomp_t pre, acb_srcptr z, slong len, int scaled, slong prec);
+
 void acb_hypgeom_0f1_asymp(acb_t res, const acb_t a, const acb_t z, int regularized, slong prec);
 void acb_hypgeom_0f1_direct(acb_t res, const acb_t a, const acb_t z, int regularized, slong prec);
 void acb_hypgeom_0f1(acb_t res, const acb_t a, const acb_t z, int regularized, slong prec);
@@ -157,11 +190,13 @@ void acb_hypgeom_airy_bound(mag_t ai, mag_t aip, mag_t bi, mag_t bip, const acb_
 void acb_hypgeom_airy_asymp(acb_t ai, acb_t aip, acb_t bi, acb_t bip, const acb_t z, slong n, slong prec);
 void acb_hypgeom_airy_direct(acb_t ai, acb_t aip, acb_t bi, acb_t bip, const acb_t z, slong n, slong prec);
 void acb_hypgeom_airy(acb_t ai, acb_t aip, acb_t bi, acb_t bip, const acb_t z, slong prec);
+void acb_hypgeom_airy_vec(acb_ptr ai, acb_ptr aip, acb_ptr bi, acb_ptr bip, acb_srcptr z, slong len, slong prec);
 void acb_hypgeom_airy_jet(acb_ptr ai, acb_ptr bi, const acb_t z, slong len, slong prec);
 void _acb_hypgeom_airy_series(acb_ptr ai, acb_ptr ai_prime, acb_ptr bi, acb_ptr bi_prime, acb_srcptr z, slong zlen, slong len, slong prec);
 void acb_hypgeom_airy_series(acb_poly_t ai, acb_poly_t ai_prime, acb_poly_t bi, acb_poly_t bi_prime, const acb_poly_t z, slong len, slong prec);
 
 void acb_hypgeom_coulomb(acb_t F, acb_t G, acb_t Hpos, acb_t Hneg, const acb_t l, const acb_t eta, const acb_t z, slong prec);
+void acb_hypgeom_coulomb_vec(acb_ptr F, acb_ptr G, acb_ptr Hpos, acb_ptr Hneg, const acb_t l, const acb_t eta, const acb_t z, slong len, slong prec);
 void acb_hypgeom_coulomb_jet(acb_ptr F, acb_ptr G, acb_ptr Hpos, acb_ptr Hneg, const acb_t l, const acb_t eta, const acb_t z, slong len, slong prec);
 void _acb_hypgeom_coulomb_series(acb_ptr F, acb_ptr G, acb_ptr Hpos, acb_ptr Hneg, const acb_t l, const acb_t eta, acb_srcptr z, slong zlen, slong len, slong prec);
 void acb_hypgeom_coulomb_series(acb_poly_t F, acb_poly_t G, acb_poly_t Hpos, acb_poly_t Hneg, const acb_t l, const acb_t eta, const acb_poly_t z, slong len, slong prec);
@@ -258,6 +293,43 @@ int acb_hypgeom_2f1_choose(const acb_t z);
 
 void acb_hypgeom_2f1(acb_t res, const acb_t a, const acb_t b, const acb_t c, const acb_t z, int regularized, slong prec);
 
+typedef struct
+{
+    acb_struct a;
+    acb_struct b;
+    acb_struct c;
+    int flags;
+    int generic;
+    int limit[2];
+    acb_struct ca;
+    acb_struct cb;
+    acb_struct ab1;
+    acb_struct ba1;
+    acb_struct ac1;
+    acb_struct bc1;
+    acb_struct abc1;
+    acb_struct cab1;
+    acb_struct a1;
+    acb_struct cab;
+    acb_struct gc;
+    acb_struct coeff_t[2];
+    acb_struct coeff_u[2];
+    acb_struct corner_z[2];
+    acb_struct corner_f0[2];
+    acb_struct corner_f1[2];
+}
+acb_hypgeom_2f1_precomp_struct;
+
+typedef acb_hypgeom_2f1_precomp_struct acb_hypgeom_2f1_precomp_t[1];
+
+void acb_hypgeom_2f1_precomp_init(acb_hypgeom_2f1_precomp_t pre, const acb_t a,
+    const acb_t b, const acb_t c, int flags, slong prec);
+void acb_hypgeom_2f1_precomp_clear(acb_hypgeom_2f1_precomp_t pre);
+void acb_hypgeom_2f1_precomp_eval(acb_t res, const acb_hypgeom_2f1_precomp_t pre,
+    const acb_t z, slong prec);
+void acb_hypgeom_2f1_precomp_eval_vec(acb_ptr res, const acb_hypgeom_2f1_precomp_t pre,
+    acb_srcptr z, slong len, slong prec);
+
 #define ACB_HYPGEOM_2F1_REGULARIZED 1
 #define ACB_HYPGEOM_2F1_AB 2   /* a-b integer */
 #define ACB_HYPGEOM_2F1_AC 4   /* a-c integer */
@@ -283,6 +355,32 @@ void acb_hypgeom_dilog_zero_taylor(acb_t res, const acb_t z, slong prec);
 void acb_hypgeom_dilog_zero(acb_t res, const acb_t z, slong prec);
 void acb_hypgeom_dilog(acb_t res, const acb_t z, slong prec);
 
+typedef void (*acb_hypgeom_eval_func_t)(acb_t res, void * param, slong prec);
+
+typedef struct
+{
+    slong lost;
+    slong prec;
+    slong attempts;
+}
+acb_hypgeom_goal_struct;
+
+typedef acb_hypgeom_goal_struct acb_hypgeom_goal_t[1];
+
+void acb_hypgeom_goal_init(acb_hypgeom_goal_t G);
+
+int acb_hypgeom_eval_goal(acb_t res, acb_hypgeom_eval_func_t func, void * param,
+    slong goal, slong maxprec, acb_hypgeom_goal_t G);
+
+int acb_hypgeom_pfq_goal(acb_t res, acb_srcptr a, slong p, acb_srcptr b, slong q,
+    const acb_t z, int regularized, slong goal, slong maxprec, acb_hypgeom_goal_t G);
+int acb_hypgeom_2f1_goal(acb_t res, const acb_t a, const acb_t b, const acb_t c,
+    const acb_t z, int flags, slong goal, slong maxprec, acb_hypgeom_goal_t G);
+int acb_hypgeom_u_goal(acb_t res, const acb_t a, const acb_t b, const acb_t z,
+    slong goal, slong maxprec, acb_hypgeom_goal_t G);
+int acb_hypgeom_bessel_j_goal(acb_t res, const acb_t nu, const acb_t z,
+    slong goal, slong maxprec, acb_hypgeom_goal_t G);
+
 #ifdef __cplusplus
 }
 #endif
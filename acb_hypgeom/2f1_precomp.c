@@ -0,0 +1,504 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/thread_support.h"
+#include "acb_hypgeom.h"
+#include "arb_hypgeom.h"
+
+/* Returns 1 if acb_hypgeom_2f1_nointegration reaches the generic
+   z-dependent dispatch for these parameters (for any z other than
+   0 and 1); otherwise we simply fall back to acb_hypgeom_2f1. */
+static int
+_acb_hypgeom_2f1_params_generic(const acb_t a, const acb_t b,
+    const acb_t c, int flags, slong prec)
+{
+    int regularized, result;
+    acb_t t;
+
+    regularized = flags & ACB_HYPGEOM_2F1_REGULARIZED;
+
+    if (!acb_is_finite(a) || !acb_is_finite(b) || !acb_is_finite(c))
+        return 0;
+
+    if (regularized && acb_is_int(c) && arb_is_nonpositive(acb_realref(c)))
+        return 0;
+
+    if (regularized && (acb_eq(a, c) || acb_eq(b, c)))
+        return 0;
+
+    if (acb_is_int(a) && arf_sgn(arb_midref(acb_realref(a))) <= 0 &&
+         arf_cmpabs_ui(arb_midref(acb_realref(a)), prec) < 0)
+        return 0;
+
+    if (acb_is_int(b) && arf_sgn(arb_midref(acb_realref(b))) <= 0 &&
+         arf_cmpabs_ui(arb_midref(acb_realref(b)), prec) < 0)
+        return 0;
+
+    result = 1;
+
+    if (acb_is_exact(c))
+    {
+        acb_init(t);
+
+        acb_sub(t, c, b, prec);
+        if (acb_is_int(t) && arb_is_nonpositive(acb_realref(t)))
+            result = 0;
+
+        acb_sub(t, c, a, prec);
+        if (acb_is_int(t) && arb_is_nonpositive(acb_realref(t)))
+            result = 0;
+
+        acb_clear(t);
+    }
+
+    return result;
+}
+
+void
+acb_hypgeom_2f1_precomp_init(acb_hypgeom_2f1_precomp_t pre, const acb_t a,
+    const acb_t b, const acb_t c, int flags, slong prec)
+{
+    int regularized, k;
+    acb_t t, u, v, w;
+
+    regularized = flags & ACB_HYPGEOM_2F1_REGULARIZED;
+
+    acb_init(&pre->a);
+    acb_init(&pre->b);
+    acb_init(&pre->c);
+    acb_init(&pre->ca);
+    acb_init(&pre->cb);
+    acb_init(&pre->ab1);
+    acb_init(&pre->ba1);
+    acb_init(&pre->ac1);
+    acb_init(&pre->bc1);
+    acb_init(&pre->abc1);
+    acb_init(&pre->cab1);
+    acb_init(&pre->a1);
+    acb_init(&pre->cab);
+    acb_init(&pre->gc);
+
+    for (k = 0; k < 2; k++)
+    {
+        acb_init(pre->coeff_t + k);
+        acb_init(pre->coeff_u + k);
+        acb_init(pre->corner_z + k);
+        acb_init(pre->corner_f0 + k);
+        acb_init(pre->corner_f1 + k);
+    }
+
+    acb_set(&pre->a, a);
+    acb_set(&pre->b, b);
+    acb_set(&pre->c, c);
+    pre->flags = flags;
+    pre->generic = _acb_hypgeom_2f1_params_generic(a, b, c, flags, prec);
+    pre->limit[0] = pre->limit[1] = 0;
+
+    if (!pre->generic)
+        return;
+
+    acb_init(t);
+    acb_init(u);
+    acb_init(v);
+    acb_init(w);
+
+    acb_sub(&pre->ca, c, a, prec);                 /* c - a */
+    acb_sub(&pre->cb, c, b, prec);                 /* c - b */
+    acb_sub(&pre->cab, &pre->ca, b, prec);         /* c - a - b */
+    acb_sub(t, b, a, prec);                        /* t = b - a */
+    acb_sub_ui(&pre->ac1, &pre->ca, 1, prec);      /* a - c + 1 */
+    acb_neg(&pre->ac1, &pre->ac1);
+    acb_sub_ui(&pre->bc1, &pre->cb, 1, prec);      /* b - c + 1 */
+    acb_neg(&pre->bc1, &pre->bc1);
+    acb_sub_ui(&pre->ab1, t, 1, prec);             /* a - b + 1 */
+    acb_neg(&pre->ab1, &pre->ab1);
+    acb_add_ui(&pre->ba1, t, 1, prec);             /* b - a + 1 */
+    acb_sub_ui(&pre->abc1, &pre->cab, 1, prec);    /* a + b - c + 1 */
+    acb_neg(&pre->abc1, &pre->abc1);
+    acb_add_ui(&pre->cab1, &pre->cab, 1, prec);    /* c - a - b + 1 */
+    acb_sub_ui(&pre->a1, a, 1, prec);              /* 1 - a */
+    acb_neg(&pre->a1, &pre->a1);
+
+    if (regularized)
+        acb_one(&pre->gc);
+    else
+        acb_gamma(&pre->gc, c, prec);
+
+    /* Same choice between the limit and nonlimit formulas as in
+       acb_hypgeom_2f1_transform. */
+    pre->limit[0] = (flags & ACB_HYPGEOM_2F1_AB) || acb_is_int(t);
+    pre->limit[1] = (flags & ACB_HYPGEOM_2F1_ABC) || acb_is_int(&pre->cab);
+
+    /* Connection coefficients for 1/z, 1/(1-z) (k = 0)
+       and 1-z, 1-1/z (k = 1), DLMF 15.8.1 - 15.8.5. */
+    for (k = 0; k < 2; k++)
+    {
+        if (pre->limit[k])
+            continue;
+
+        if (k == 0)
+            acb_sin_pi(w, t, prec);
+        else
+            acb_sin_pi(w, &pre->cab, prec);
+
+        acb_const_pi(v, prec);
+        acb_div(w, v, w, prec);
+        acb_mul(w, w, &pre->gc, prec);
+
+        acb_rgamma(u, &pre->ca, prec);
+        acb_rgamma(v, (k == 0) ? b : &pre->cb, prec);
+        acb_mul(u, u, v, prec);
+        acb_mul(pre->coeff_t + k, u, w, prec);
+
+        acb_rgamma(u, a, prec);
+        acb_rgamma(v, (k == 0) ? &pre->cb : b, prec);
+        acb_mul(u, u, v, prec);
+        acb_mul(pre->coeff_u + k, u, w, prec);
+    }
+
+    /* Continue the solution from 0 to the last point before z used by
+       acb_hypgeom_2f1_corner, in each half-plane. */
+    for (k = 0; k < 2; k++)
+    {
+        acb_set_d_d(t, 0.375, k ? 0.625 : -0.625);
+        acb_set_d_d(pre->corner_z + k, 0.5, k ? 0.8125 : -0.8125);
+
+        acb_hypgeom_2f1_direct(pre->corner_f0 + k, a, b, c, t, regularized, prec);
+
+        acb_add_ui(u, a, 1, prec);
+        acb_add_ui(v, b, 1, prec);
+        acb_add_ui(w, c, 1, prec);
+        acb_hypgeom_2f1_direct(pre->corner_f1 + k, u, v, w, t, regularized, prec);
+        acb_mul(pre->corner_f1 + k, pre->corner_f1 + k, a, prec);
+        acb_mul(pre->corner_f1 + k, pre->corner_f1 + k, b, prec);
+        if (!regularized)
+            acb_div(pre->corner_f1 + k, pre->corner_f1 + k, c, prec);
+
+        acb_hypgeom_2f1_continuation(pre->corner_f0 + k, pre->corner_f1 + k,
+            a, b, c, t, pre->corner_z + k, pre->corner_f0 + k, pre->corner_f1 + k, prec);
+    }
+
+    acb_clear(t);
+    acb_clear(u);
+    acb_clear(v);
+    acb_clear(w);
+}
+
+void
+acb_hypgeom_2f1_precomp_clear(acb_hypgeom_2f1_precomp_t pre)
+{
+    int k;
+
+    acb_clear(&pre->a);
+    acb_clear(&pre->b);
+    acb_clear(&pre->c);
+    acb_clear(&pre->ca);
+    acb_clear(&pre->cb);
+    acb_clear(&pre->ab1);
+    acb_clear(&pre->ba1);
+    acb_clear(&pre->ac1);
+    acb_clear(&pre->bc1);
+    acb_clear(&pre->abc1);
+    acb_clear(&pre->cab1);
+    acb_clear(&pre->a1);
+    acb_clear(&pre->cab);
+    acb_clear(&pre->gc);
+
+    for (k = 0; k < 2; k++)
+    {
+        acb_clear(pre->coeff_t + k);
+        acb_clear(pre->coeff_u + k);
+        acb_clear(pre->corner_z + k);
+        acb_clear(pre->corner_f0 + k);
+        acb_clear(pre->corner_f1 + k);
+    }
+}
+
+/* Same as acb_hypgeom_2f1_transform_nolimit, with cached coefficients. */
+static void
+_acb_hypgeom_2f1_precomp_transform(acb_t res, const acb_hypgeom_2f1_precomp_t pre,
+    const acb_t z, int which, slong prec)
+{
+    acb_srcptr a, b;
+    acb_t s, w, t, u, v;
+    int k;
+
+    if (acb_contains_zero(z) || !acb_is_finite(z) ||
+        (arb_contains_si(acb_realref(z), 1) && arb_contains_zero(acb_imagref(z))))
+    {
+        acb_indeterminate(res);
+        return;
+    }
+
+    a = &pre->a;
+    b = &pre->b;
+    k = (which >= 4);
+
+    acb_init(s);
+    acb_init(w);
+    acb_init(t);
+    acb_init(u);
+    acb_init(v);
+
+    acb_sub_ui(s, z, 1, prec);    /* s = 1 - z */
+    acb_neg(s, s);
+
+    if (which == 2)
+    {
+        acb_inv(w, z, prec);
+        acb_hypgeom_2f1_direct(t, a, &pre->ac1, &pre->ab1, w, 1, prec);
+        acb_hypgeom_2f1_direct(u, b, &pre->bc1, &pre->ba1, w, 1, prec);
+        acb_neg(s, z);
+    }
+    else if (which == 3)
+    {
+        acb_inv(w, s, prec);
+        acb_hypgeom_2f1_direct(t, a, &pre->cb, &pre->ab1, w, 1, prec);
+        acb_hypgeom_2f1_direct(u, b, &pre->ca, &pre->ba1, w, 1, prec);
+    }
+    else if (which == 4)
+    {
+        acb_hypgeom_2f1_direct(t, a, b, &pre->abc1, s, 1, prec);
+        acb_hypgeom_2f1_direct(u, &pre->ca, &pre->cb, &pre->cab1, s, 1, prec);
+    }
+    else
+    {
+        acb_inv(w, z, prec);
+        acb_neg(w, w);
+        acb_add_ui(w, w, 1, prec);
+        acb_hypgeom_2f1_direct(t, a, &pre->ac1, &pre->abc1, w, 1, prec);
+        acb_hypgeom_2f1_direct(u, &pre->ca, &pre->a1, &pre->cab1, w, 1, prec);
+    }
+
+    if (k == 0)
+    {
+        acb_neg(v, a);
+        acb_pow(v, s, v, prec);
+        acb_mul(t, t, v, prec);
+
+        acb_neg(v, b);
+        acb_pow(v, s, v, prec);
+        acb_mul(u, u, v, prec);
+    }
+    else
+    {
+        acb_pow(v, s, &pre->cab, prec);
+        acb_mul(u, u, v, prec);
+
+        if (which == 5)
+        {
+            acb_neg(v, a);
+            acb_pow(v, z, v, prec);
+            acb_mul(t, t, v, prec);
+
+            acb_neg(v, &pre->ca);
+            acb_pow(v, z, v, prec);
+            acb_mul(u, u, v, prec);
+        }
+    }
+
+    acb_mul(t, t, pre->coeff_t + k, prec);
+    acb_mul(u, u, pre->coeff_u + k, prec);
+    acb_sub(res, t, u, prec);
+
+    acb_clear(s);
+    acb_clear(w);
+    acb_clear(t);
+    acb_clear(u);
+    acb_clear(v);
+}
+
+/* Which evaluation strategy to use for z; -1 means that we simply call
+   acb_hypgeom_2f1 (special parameters or special z). */
+static int
+_acb_hypgeom_2f1_precomp_choose(const acb_hypgeom_2f1_precomp_t pre, const acb_t z)
+{
+    if (!pre->generic || !acb_is_finite(z) || acb_is_zero(z) || acb_is_one(z))
+        return -1;
+
+    return acb_hypgeom_2f1_choose(z);
+}
+
+static void
+_acb_hypgeom_2f1_precomp_eval(acb_t res, const acb_hypgeom_2f1_precomp_t pre,
+    const acb_t z, int which, slong prec)
+{
+    acb_srcptr a, b, c;
+    acb_t t, u, v;
+    slong acc, max, m;
+    int regularized;
+
+    a = &pre->a;
+    b = &pre->b;
+    c = &pre->c;
+    regularized = pre->flags & ACB_HYPGEOM_2F1_REGULARIZED;
+
+    if (which < 0)
+    {
+        acb_hypgeom_2f1(res, a, b, c, z, pre->flags, prec);
+        return;
+    }
+
+    acb_init(t);
+    acb_init(u);
+    acb_init(v);
+
+    if (which == 0)
+    {
+        acb_hypgeom_2f1_direct(t, a, b, c, z, regularized, prec);
+    }
+    else if (which == 1)
+    {
+        acb_sub_ui(u, z, 1, prec);
+        acb_div(v, z, u, prec);      /* v = z/(z-1) */
+        acb_hypgeom_2f1_direct(t, a, &pre->cb, c, v, 1, prec);
+        acb_mul(t, t, &pre->gc, prec);
+        acb_neg(u, u);
+        acb_neg(v, a);
+        acb_pow(u, u, v, prec);      /* (1-z)^(-a) */
+        acb_mul(t, t, u, prec);
+    }
+    else if (which <= 5)
+    {
+        if (pre->limit[which >= 4])
+            acb_hypgeom_2f1_transform(t, a, b, c, z, pre->flags, which, prec);
+        else
+            _acb_hypgeom_2f1_precomp_transform(t, pre, z, which, prec);
+    }
+    else
+    {
+        int upper = arb_is_positive(acb_imagref(z));
+
+        acb_hypgeom_2f1_continuation(t, u, a, b, c, pre->corner_z + upper, z,
+            pre->corner_f0 + upper, pre->corner_f1 + upper, prec);
+    }
+
+    if (which >= 1 && which <= 5 && !acb_is_finite(t))
+        acb_indeterminate(t);
+
+    /* Same fallback to numerical integration as in acb_hypgeom_2f1. */
+    acc = acb_rel_accuracy_bits(t);
+
+    if (acc < 0.5 * prec)
+    {
+        max = prec;
+        m = acb_rel_accuracy_bits(z); max = FLINT_MIN(max, m);
+        m = acb_rel_accuracy_bits(a); max = FLINT_MIN(max, m);
+        m = acb_rel_accuracy_bits(b); max = FLINT_MIN(max, m);
+        m = acb_rel_accuracy_bits(c); max = FLINT_MIN(max, m);
+
+        if (max > 2 && acc < 0.5 * max &&
+            acb_is_real(a) && acb_is_real(b) && acb_is_real(c) && acb_is_real(z) &&
+            arf_cmpabs_2exp_si(arb_midref(acb_realref(a)), 60) < 0 &&
+            arf_cmpabs_2exp_si(arb_midref(acb_realref(b)), 60) < 0 &&
+            arf_cmpabs_2exp_si(arb_midref(acb_realref(c)), 60) < 0 &&
+            arf_cmpabs_2exp_si(arb_midref(acb_realref(z)), 60) < 0)
+        {
+            arb_hypgeom_2f1_integration(acb_realref(u), acb_realref(a),
+                acb_realref(b), acb_realref(c), acb_realref(z), pre->flags, prec);
+            arb_zero(acb_imagref(u));
+
+            if (acb_rel_accuracy_bits(u) > acc ||
+                (acb_is_finite(u) && !acb_is_finite(t)))
+                acb_swap(t, u);
+        }
+    }
+
+    acb_swap(res, t);
+
+    acb_clear(t);
+    acb_clear(u);
+    acb_clear(v);
+}
+
+void
+acb_hypgeom_2f1_precomp_eval(acb_t res, const acb_hypgeom_2f1_precomp_t pre,
+    const acb_t z, slong prec)
+{
+    _acb_hypgeom_2f1_precomp_eval(res, pre,
+        z, _acb_hypgeom_2f1_precomp_choose(pre, z), prec);
+}
+
+typedef struct
+{
+    acb_ptr res;
+    acb_hypgeom_2f1_precomp_struct * pre;
+    acb_srcptr z;
+    const slong * perm;
+    const int * which;
+    slong prec;
+}
+precomp_work_t;
+
+static void
+precomp_worker(slong i, void * _work)
+{
+    precomp_work_t * work = (precomp_work_t *) _work;
+    slong j = work->perm[i];
+
+    _acb_hypgeom_2f1_precomp_eval(work->res + j, work->pre,
+        work->z + j, work->which[j], work->prec);
+}
+
+void
+acb_hypgeom_2f1_precomp_eval_vec(acb_ptr res, const acb_hypgeom_2f1_precomp_t pre,
+    acb_srcptr z, slong len, slong prec)
+{
+    slong i, count[8];
+    slong * perm;
+    int * which;
+
+    if (len <= 0)
+        return;
+
+    perm = flint_malloc(sizeof(slong) * len);
+    which = flint_malloc(sizeof(int) * len);
+
+    /* Group the points by transformation, so that each group runs
+       over the same series parameters and connection coefficients. */
+    for (i = 0; i < 8; i++)
+        count[i] = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        which[i] = _acb_hypgeom_2f1_precomp_choose(pre, z + i);
+        count[which[i] + 1]++;
+    }
+
+    for (i = 1; i < 8; i++)
+        count[i] += count[i - 1];
+
+    for (i = len - 1; i >= 0; i--)
+        perm[--count[which[i] + 1]] = i;
+
+    if (len >= 2 && arb_flint_get_num_available_threads() > 1)
+    {
+        precomp_work_t work;
+
+        work.res = res;
+        work.pre = (acb_hypgeom_2f1_precomp_struct *) pre;
+        work.z = z;
+        work.perm = perm;
+        work.which = which;
+        work.prec = prec;
+
+        flint_parallel_do((do_func_t) precomp_worker, &work, len, -1, FLINT_PARALLEL_STRIDED);
+    }
+    else
+    {
+        for (i = 0; i < len; i++)
+            _acb_hypgeom_2f1_precomp_eval(res + perm[i], pre,
+                z + perm[i], which[perm[i]], prec);
+    }
+
+    flint_free(perm);
+    flint_free(which);
+}
@@ -0,0 +1,61 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/thread_support.h"
+#include "acb_hypgeom.h"
+
+typedef struct
+{
+    acb_ptr ai;
+    acb_ptr aip;
+    acb_ptr bi;
+    acb_ptr bip;
+    acb_srcptr z;
+    slong prec;
+}
+airy_work_t;
+
+static void
+airy_worker(slong i, void * _work)
+{
+    airy_work_t * work = (airy_work_t *) _work;
+
+    acb_hypgeom_airy((work->ai == NULL) ? NULL : work->ai + i,
+                     (work->aip == NULL) ? NULL : work->aip + i,
+                     (work->bi == NULL) ? NULL : work->bi + i,
+                     (work->bip == NULL) ? NULL : work->bip + i,
+                     work->z + i, work->prec);
+}
+
+void
+acb_hypgeom_airy_vec(acb_ptr ai, acb_ptr aip, acb_ptr bi, acb_ptr bip,
+    acb_srcptr z, slong len, slong prec)
+{
+    airy_work_t work;
+    slong i;
+
+    work.ai = ai;
+    work.aip = aip;
+    work.bi = bi;
+    work.bip = bip;
+    work.z = z;
+    work.prec = prec;
+
+    if (len >= 2 && arb_flint_get_num_available_threads() > 1)
+    {
+        flint_parallel_do((do_func_t) airy_worker, &work, len, -1, FLINT_PARALLEL_STRIDED);
+    }
+    else
+    {
+        for (i = 0; i < len; i++)
+            airy_worker(i, &work);
+    }
+}
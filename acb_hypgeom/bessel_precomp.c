@@ -0,0 +1,448 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/thread_support.h"
+#include "arb_hypgeom.h"
+#include "acb_hypgeom.h"
+
+void
+acb_hypgeom_bessel_precomp_init(acb_hypgeom_bessel_precomp_t pre, const acb_t nu, slong prec)
+{
+    acb_t u;
+
+    acb_init(&pre->nu);
+    acb_init(&pre->jnu);
+    acb_init(pre->jb + 0);
+    acb_init(pre->jb + 1);
+    acb_init(pre->kb1 + 0);
+    acb_init(pre->kb1 + 1);
+    acb_init(pre->kb2 + 0);
+    acb_init(pre->kb2 + 1);
+    acb_init(&pre->jc);
+    acb_init(&pre->kgamma);
+    acb_init(&pre->kc);
+    acb_init(&pre->s);
+    acb_init(&pre->t);
+    acb_init(&pre->phase);
+    arb_init(&pre->rsqrt_2pi);
+    arb_init(&pre->sqrt_pi);
+    acb_init(u);
+
+    acb_set(&pre->nu, nu);
+    pre->nu_real = acb_is_real(nu);
+    pre->nu_int = acb_is_int(nu);
+    pre->nu_negint = pre->nu_int && arb_is_negative(acb_realref(nu));
+    pre->nu_odd = 0;
+
+    if (pre->nu_int)
+    {
+        acb_mul_2exp_si(u, nu, -1);
+        pre->nu_odd = !acb_is_int(u);
+    }
+
+    /* J: (z/2)^nu / gamma(nu+1) 0F1(nu+1, -z^2/4), using
+       J_{-n}(z) = (-1)^n J_n(z) for negative integers */
+    if (pre->nu_negint)
+        acb_neg(&pre->jnu, nu);
+    else
+        acb_set(&pre->jnu, nu);
+
+    acb_add_ui(pre->jb + 0, &pre->jnu, 1, prec);
+    acb_one(pre->jb + 1);
+    acb_rgamma(&pre->jc, pre->jb + 0, prec);
+
+    /* K, noninteger order: 0F1(1+nu) and 0F1(1-nu) with
+       gamma(nu) and pi / (gamma(nu) nu sin(pi nu)) */
+    if (!pre->nu_int)
+    {
+        acb_add_ui(pre->kb1 + 0, nu, 1, prec);
+        acb_one(pre->kb1 + 1);
+        acb_sub_ui(pre->kb2 + 0, nu, 1, prec);
+        acb_neg(pre->kb2 + 0, pre->kb2 + 0);
+        acb_one(pre->kb2 + 1);
+
+        acb_gamma(&pre->kgamma, nu, prec);
+        acb_sin_pi(u, nu, prec);
+        acb_mul(u, u, &pre->kgamma, prec);
+        acb_mul(u, u, nu, prec);
+        acb_const_pi(&pre->kc, prec);
+        acb_div(&pre->kc, &pre->kc, u, prec);
+    }
+
+    /* asymptotic expansions: U(1/2+nu, 1+2nu, w) */
+    acb_one(&pre->s);
+    acb_mul_2exp_si(&pre->s, &pre->s, -1);
+    acb_add(&pre->s, &pre->s, nu, prec);
+
+    acb_mul_2exp_si(&pre->t, nu, 1);
+    acb_add_ui(&pre->t, &pre->t, 1, prec);
+
+    /* -(2nu+1)/4 * pi */
+    acb_const_pi(u, prec);
+    acb_mul(&pre->phase, &pre->t, u, prec);
+    acb_mul_2exp_si(&pre->phase, &pre->phase, -2);
+    acb_neg(&pre->phase, &pre->phase);
+
+    arb_const_pi(&pre->rsqrt_2pi, prec);
+    arb_mul_2exp_si(&pre->rsqrt_2pi, &pre->rsqrt_2pi, 1);
+    arb_rsqrt(&pre->rsqrt_2pi, &pre->rsqrt_2pi, prec);
+
+    arb_const_sqrt_pi(&pre->sqrt_pi, prec);
+
+    acb_clear(u);
+}
+
+void
+acb_hypgeom_bessel_precomp_clear(acb_hypgeom_bessel_precomp_t pre)
+{
+    acb_clear(&pre->nu);
+    acb_clear(&pre->jnu);
+    acb_clear(pre->jb + 0);
+    acb_clear(pre->jb + 1);
+    acb_clear(pre->kb1 + 0);
+    acb_clear(pre->kb1 + 1);
+    acb_clear(pre->kb2 + 0);
+    acb_clear(pre->kb2 + 1);
+    acb_clear(&pre->jc);
+    acb_clear(&pre->kgamma);
+    acb_clear(&pre->kc);
+    acb_clear(&pre->s);
+    acb_clear(&pre->t);
+    acb_clear(&pre->phase);
+    arb_clear(&pre->rsqrt_2pi);
+    arb_clear(&pre->sqrt_pi);
+}
+
+/* same algorithm selection as acb_hypgeom_bessel_j and
+   acb_hypgeom_bessel_k_nointegration */
+static int
+_acb_hypgeom_bessel_use_0f1(const acb_t z, slong prec)
+{
+    mag_t zmag;
+    int result;
+
+    mag_init(zmag);
+    acb_get_mag(zmag, z);
+
+    result = (mag_cmp_2exp_si(zmag, 4) < 0 ||
+        (mag_cmp_2exp_si(zmag, 64) < 0 && 2 * mag_get_d(zmag) < prec));
+
+    mag_clear(zmag);
+    return result;
+}
+
+static void
+_acb_hypgeom_bessel_j_0f1_precomp(acb_t res,
+    const acb_hypgeom_bessel_precomp_t pre, const acb_t z, slong prec)
+{
+    acb_t w, c, t;
+
+    acb_init(w);
+    acb_init(c);
+    acb_init(t);
+
+    /* (z/2)^nu / gamma(nu+1) */
+    acb_mul_2exp_si(c, z, -1);
+    acb_pow(c, c, &pre->jnu, prec);
+    acb_mul(c, c, &pre->jc, prec);
+
+    /* -z^2/4 */
+    acb_mul(w, z, z, prec);
+    acb_mul_2exp_si(w, w, -2);
+    acb_neg(w, w);
+
+    acb_hypgeom_pfq_direct(t, NULL, 0, pre->jb, 2, w, -1, prec);
+    acb_mul(res, t, c, prec);
+
+    if (pre->nu_negint && pre->nu_odd)
+        acb_neg(res, res);
+
+    acb_clear(w);
+    acb_clear(c);
+    acb_clear(t);
+}
+
+static void
+_acb_hypgeom_bessel_j_asymp_precomp(acb_t res,
+    const acb_hypgeom_bessel_precomp_t pre, const acb_t z, slong prec)
+{
+    acb_t A1, A2, C, U1, U2, u;
+    int is_real, is_imag;
+
+    if (acb_is_finite(&pre->nu) && !acb_is_finite(z) &&
+        acb_is_real(z) && !acb_contains_zero(z))
+    {
+        acb_zero(res);
+        return;
+    }
+
+    acb_init(A1);
+    acb_init(A2);
+    acb_init(C);
+    acb_init(U1);
+    acb_init(U2);
+    acb_init(u);
+
+    is_imag = 0;
+    is_real = pre->nu_real && acb_is_real(z)
+        && (pre->nu_int || arb_is_positive(acb_realref(z)));
+
+    if (!is_real && arb_is_zero(acb_realref(z)) && pre->nu_int)
+    {
+        if (pre->nu_odd)
+            is_imag = 1;
+        else
+            is_real = 1;
+    }
+
+    if (arb_is_positive(acb_realref(z)))
+    {
+        /* exp(+/- i(z - (2nu+1)/4 pi)), (2 pi z)^(-1/2) */
+        acb_add(u, &pre->phase, z, prec);
+        acb_mul_onei(u, u);
+        acb_exp_invexp(A1, A2, u, prec);
+
+        acb_rsqrt(C, z, prec);
+        acb_mul_arb(C, C, &pre->rsqrt_2pi, prec);
+    }
+    else
+    {
+        acb_hypgeom_bessel_j_asymp_prefactors_fallback(A1, A2, C, &pre->nu, z, prec);
+    }
+
+    if (!acb_is_finite(A1) || !acb_is_finite(A2) || !acb_is_finite(C))
+    {
+        acb_indeterminate(res);
+    }
+    else
+    {
+        acb_mul_onei(u, z);
+        acb_mul_2exp_si(u, u, 1);
+        acb_hypgeom_u_asymp(U2, &pre->s, &pre->t, u, -1, prec);
+        acb_neg(u, u);
+        acb_hypgeom_u_asymp(U1, &pre->s, &pre->t, u, -1, prec);
+
+        acb_mul(res, A1, U1, prec);
+        acb_addmul(res, A2, U2, prec);
+        acb_mul(res, res, C, prec);
+
+        if (is_real)
+            arb_zero(acb_imagref(res));
+        if (is_imag)
+            arb_zero(acb_realref(res));
+    }
+
+    acb_clear(A1);
+    acb_clear(A2);
+    acb_clear(C);
+    acb_clear(U1);
+    acb_clear(U2);
+    acb_clear(u);
+}
+
+void
+acb_hypgeom_bessel_precomp_eval_j(acb_t res, const acb_hypgeom_bessel_precomp_t pre,
+    const acb_t z, slong prec)
+{
+    if (_acb_hypgeom_bessel_use_0f1(z, prec))
+        _acb_hypgeom_bessel_j_0f1_precomp(res, pre, z, prec);
+    else
+        _acb_hypgeom_bessel_j_asymp_precomp(res, pre, z, prec);
+}
+
+static void
+_acb_hypgeom_bessel_k_0f1_precomp(acb_t res,
+    const acb_hypgeom_bessel_precomp_t pre, const acb_t z, int scaled, slong prec)
+{
+    acb_t t, u, v;
+
+    acb_init(t);
+    acb_init(u);
+    acb_init(v);
+
+    /* u = 0F1(1+nu), v = 0F1(1-nu) */
+    acb_mul(t, z, z, prec);
+    acb_mul_2exp_si(t, t, -2);
+    acb_hypgeom_pfq_direct(u, NULL, 0, pre->kb1, 2, t, -1, prec);
+    acb_hypgeom_pfq_direct(v, NULL, 0, pre->kb2, 2, t, -1, prec);
+
+    /* v = v * gamma(nu) / (z/2)^nu */
+    acb_mul_2exp_si(t, z, -1);
+    acb_pow(t, t, &pre->nu, prec);
+    acb_mul(v, v, &pre->kgamma, prec);
+    acb_div(v, v, t, prec);
+
+    /* u = u * t * pi / (gamma(nu) * nu * sin(pi nu)) */
+    acb_mul(u, u, t, prec);
+    acb_mul(u, u, &pre->kc, prec);
+
+    acb_sub(v, v, u, prec);
+    acb_mul_2exp_si(v, v, -1);
+
+    if (scaled)
+    {
+        acb_exp(t, z, prec);
+        acb_mul(v, v, t, prec);
+    }
+
+    acb_swap(res, v);
+
+    acb_clear(t);
+    acb_clear(u);
+    acb_clear(v);
+}
+
+static void
+_acb_hypgeom_bessel_k_asymp_precomp(acb_t res,
+    const acb_hypgeom_bessel_precomp_t pre, const acb_t z, int scaled, slong prec)
+{
+    acb_t t, w;
+
+    acb_init(t);
+    acb_init(w);
+
+    acb_mul_2exp_si(w, z, 1);
+    acb_hypgeom_u_asymp(t, &pre->s, &pre->t, w, -1, prec);
+
+    if (!scaled)
+    {
+        acb_neg(w, z);
+        acb_exp(w, w, prec);
+        acb_mul(t, t, w, prec);
+    }
+
+    acb_mul_2exp_si(w, z, 1);
+    acb_rsqrt(w, w, prec);
+    acb_mul(res, t, w, prec);
+    acb_mul_arb(res, res, &pre->sqrt_pi, prec);
+
+    acb_clear(t);
+    acb_clear(w);
+}
+
+void
+acb_hypgeom_bessel_precomp_eval_k(acb_t res, const acb_hypgeom_bessel_precomp_t pre,
+    const acb_t z, int scaled, slong prec)
+{
+    acb_srcptr nu = &pre->nu;
+    acb_t res2;
+    slong acc, max, t;
+
+    acb_init(res2);
+
+    if (!_acb_hypgeom_bessel_use_0f1(z, prec))
+        _acb_hypgeom_bessel_k_asymp_precomp(res2, pre, z, scaled, prec);
+    else if (pre->nu_int)
+        acb_hypgeom_bessel_k_0f1(res2, nu, z, scaled, prec);
+    else
+        _acb_hypgeom_bessel_k_0f1_precomp(res2, pre, z, scaled, prec);
+
+    /* same fallback to numerical integration as in acb_hypgeom_bessel_k */
+    acc = acb_rel_accuracy_bits(res2);
+
+    if (acc < 0.5 * prec)
+    {
+        max = prec;
+        t = acb_rel_accuracy_bits(z);
+        max = FLINT_MIN(max, t);
+        t = acb_rel_accuracy_bits(nu);
+        max = FLINT_MIN(max, t);
+
+        if (max > 2 && acc < 0.5 * max)
+        {
+            if (acb_is_real(nu) && acb_is_real(z) && arf_cmp_d(arb_midref(acb_realref(nu)), -0.5) > 0 &&
+                arf_cmp_2exp_si(arb_midref(acb_realref(z)), -16) > 0 &&
+                arf_cmpabs_2exp_si(arb_midref(acb_realref(nu)), 60) < 0 &&
+                arf_cmpabs_2exp_si(arb_midref(acb_realref(z)), 60) < 0)
+            {
+                acb_t res3;
+                acb_init(res3);
+
+                arb_hypgeom_bessel_k_integration(acb_realref(res3),
+                        acb_realref(nu), acb_realref(z), scaled, prec);
+
+                if (acb_rel_accuracy_bits(res3) > acb_rel_accuracy_bits(res2) ||
+                    (acb_is_finite(res3) && !acb_is_finite(res2)))
+                {
+                    acb_swap(res3, res2);
+                }
+
+                acb_clear(res3);
+            }
+        }
+    }
+
+    acb_swap(res, res2);
+    acb_clear(res2);
+}
+
+typedef struct
+{
+    acb_ptr res;
+    const acb_hypgeom_bessel_precomp_struct * pre;
+    acb_srcptr z;
+    int kind;
+    int scaled;
+    slong prec;
+}
+bessel_work_t;
+
+static void
+bessel_worker(slong i, void * _work)
+{
+    bessel_work_t * work = (bessel_work_t *) _work;
+
+    if (work->kind == 0)
+        acb_hypgeom_bessel_precomp_eval_j(work->res + i,
+            work->pre, work->z + i, work->prec);
+    else
+        acb_hypgeom_bessel_precomp_eval_k(work->res + i,
+            work->pre, work->z + i, work->scaled, work->prec);
+}
+
+static void
+_acb_hypgeom_bessel_precomp_eval_vec(acb_ptr res, const acb_hypgeom_bessel_precomp_t pre,
+    acb_srcptr z, slong len, int kind, int scaled, slong prec)
+{
+    bessel_work_t work;
+    slong i;
+
+    work.res = res;
+    work.pre = pre;
+    work.z = z;
+    work.kind = kind;
+    work.scaled = scaled;
+    work.prec = prec;
+
+    if (len >= 2 && arb_flint_get_num_available_threads() > 1)
+    {
+        flint_parallel_do((do_func_t) bessel_worker, &work, len, -1, FLINT_PARALLEL_STRIDED);
+    }
+    else
+    {
+        for (i = 0; i < len; i++)
+            bessel_worker(i, &work);
+    }
+}
+
+void
+acb_hypgeom_bessel_precomp_eval_j_vec(acb_ptr res, const acb_hypgeom_bessel_precomp_t pre,
+    acb_srcptr z, slong len, slong prec)
+{
+    _acb_hypgeom_bessel_precomp_eval_vec(res, pre, z, len, 0, 0, prec);
+}
+
+void
+acb_hypgeom_bessel_precomp_eval_k_vec(acb_ptr res, const acb_hypgeom_bessel_precomp_t pre,
+    acb_srcptr z, slong len, int scaled, slong prec)
+{
+    _acb_hypgeom_bessel_precomp_eval_vec(res, pre, z, len, 1, scaled, prec);
+}
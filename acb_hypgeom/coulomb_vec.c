@@ -0,0 +1,201 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_hypgeom.h"
+
+/* Guard bits for the ball recurrence; when a value has lost more than this,
+   it is recomputed directly. */
+#define REC_GUARD_BITS 64
+
+/*
+  With R_L = sqrt(L + i eta) sqrt(L - i eta) (consistent with the
+  normalization constant C_L(eta) defined via log-gamma), each of
+  F, G, H+, H- satisfies
+
+    (L+1) R_L u_{L-1} - (2L+1) (eta + L(L+1)/z) u_L + L R_{L+1} u_{L+1} = 0.
+*/
+
+static void
+_coulomb_R(acb_t R, const acb_t L, const acb_t eta, slong prec)
+{
+    acb_t t;
+    acb_init(t);
+    acb_mul_onei(t, eta);
+    acb_add(R, L, t, prec);
+    acb_sub(t, L, t, prec);
+    acb_sqrt(R, R, prec);
+    acb_sqrt(t, t, prec);
+    acb_mul(R, R, t, prec);
+    acb_clear(t);
+}
+
+/* A = (2L+1) (eta + L(L+1)/z) */
+static void
+_coulomb_A(acb_t A, const acb_t L, const acb_t eta, const acb_t zinv, slong prec)
+{
+    acb_t t;
+    acb_init(t);
+    acb_add_ui(t, L, 1, prec);
+    acb_mul(t, t, L, prec);
+    acb_mul(t, t, zinv, prec);
+    acb_add(t, t, eta, prec);
+    acb_mul_2exp_si(A, L, 1);
+    acb_add_ui(A, A, 1, prec);
+    acb_mul(A, A, t, prec);
+    acb_clear(t);
+}
+
+static int
+_coulomb_ok(acb_srcptr u, slong goal)
+{
+    return (u == NULL) || (acb_rel_accuracy_bits(u) >= goal);
+}
+
+void
+acb_hypgeom_coulomb_vec(acb_ptr F, acb_ptr G, acb_ptr Hpos, acb_ptr Hneg,
+    const acb_t l, const acb_t eta, const acb_t z, slong len, slong prec)
+{
+    acb_t L, zinv, A, R0, R1, t, u;
+    slong k, wp, goal;
+
+    if (len <= 0)
+        return;
+
+    acb_init(L);
+    acb_init(zinv);
+    acb_init(A);
+    acb_init(R0);
+    acb_init(R1);
+    acb_init(t);
+    acb_init(u);
+
+    wp = prec + REC_GUARD_BITS;
+
+    if (len <= 2 || !acb_is_finite(z) || acb_contains_zero(z))
+    {
+        for (k = 0; k < len; k++)
+        {
+            acb_add_ui(L, l, k, wp);
+            acb_hypgeom_coulomb(F ? F + k : NULL, G ? G + k : NULL,
+                Hpos ? Hpos + k : NULL, Hneg ? Hneg + k : NULL, L, eta, z, prec);
+        }
+
+        goto cleanup;
+    }
+
+    goal = FLINT_MIN(acb_rel_accuracy_bits(l), acb_rel_accuracy_bits(eta));
+    goal = FLINT_MIN(goal, acb_rel_accuracy_bits(z));
+    goal = FLINT_MIN(prec, goal) + 2;
+
+    acb_inv(zinv, z, wp);
+
+    /* G and H+- are dominant for large L: forward recurrence. */
+    if (G != NULL || Hpos != NULL || Hneg != NULL)
+    {
+        acb_hypgeom_coulomb(NULL, G, Hpos, Hneg, l, eta, z, wp);
+        acb_add_ui(L, l, 1, wp);
+        acb_hypgeom_coulomb(NULL, G ? G + 1 : NULL, Hpos ? Hpos + 1 : NULL,
+            Hneg ? Hneg + 1 : NULL, L, eta, z, wp);
+
+        _coulomb_R(R1, L, eta, wp);
+
+        for (k = 2; k < len; k++)
+        {
+            /* step from L = l + k - 1 to L + 1 */
+            acb_swap(R0, R1);
+            acb_add_ui(L, l, k - 1, wp);
+            acb_add_ui(t, L, 1, wp);
+            _coulomb_R(R1, t, eta, wp);
+            _coulomb_A(A, L, eta, zinv, wp);
+
+            /* t = (L+1) R_L, u = L R_{L+1} */
+            acb_add_ui(t, L, 1, wp);
+            acb_mul(t, t, R0, wp);
+            acb_mul(u, L, R1, wp);
+
+#define FORWARD(v) \
+            if (v != NULL) \
+            { \
+                acb_mul(v + k, v + k - 1, A, wp); \
+                acb_submul(v + k, v + k - 2, t, wp); \
+                acb_div(v + k, v + k, u, wp); \
+            }
+
+            FORWARD(G)
+            FORWARD(Hpos)
+            FORWARD(Hneg)
+#undef FORWARD
+
+            if (!_coulomb_ok(G ? G + k : NULL, goal) ||
+                !_coulomb_ok(Hpos ? Hpos + k : NULL, goal) ||
+                !_coulomb_ok(Hneg ? Hneg + k : NULL, goal))
+            {
+                acb_add_ui(t, l, k, wp);
+                acb_hypgeom_coulomb(NULL, G ? G + k : NULL,
+                    Hpos ? Hpos + k : NULL, Hneg ? Hneg + k : NULL,
+                    t, eta, z, wp);
+            }
+        }
+    }
+
+    /* F is minimal for large L: backward recurrence. */
+    if (F != NULL)
+    {
+        acb_add_ui(L, l, len - 1, wp);
+        acb_hypgeom_coulomb(F + len - 1, NULL, NULL, NULL, L, eta, z, wp);
+        acb_sub_ui(L, L, 1, wp);
+        acb_hypgeom_coulomb(F + len - 2, NULL, NULL, NULL, L, eta, z, wp);
+
+        acb_add_ui(t, L, 1, wp);
+        _coulomb_R(R0, t, eta, wp);
+
+        for (k = len - 3; k >= 0; k--)
+        {
+            /* step from L = l + k + 1 to L - 1 */
+            acb_swap(R1, R0);
+            acb_add_ui(L, l, k + 1, wp);
+            _coulomb_R(R0, L, eta, wp);
+            _coulomb_A(A, L, eta, zinv, wp);
+
+            /* t = L R_{L+1}, u = (L+1) R_L */
+            acb_mul(t, L, R1, wp);
+            acb_add_ui(u, L, 1, wp);
+            acb_mul(u, u, R0, wp);
+
+            acb_mul(F + k, F + k + 1, A, wp);
+            acb_submul(F + k, F + k + 2, t, wp);
+            acb_div(F + k, F + k, u, wp);
+
+            if (!_coulomb_ok(F + k, goal))
+            {
+                acb_add_ui(t, l, k, wp);
+                acb_hypgeom_coulomb(F + k, NULL, NULL, NULL, t, eta, z, wp);
+            }
+        }
+    }
+
+    for (k = 0; k < len; k++)
+    {
+        if (F != NULL) acb_set_round(F + k, F + k, prec);
+        if (G != NULL) acb_set_round(G + k, G + k, prec);
+        if (Hpos != NULL) acb_set_round(Hpos + k, Hpos + k, prec);
+        if (Hneg != NULL) acb_set_round(Hneg + k, Hneg + k, prec);
+    }
+
+cleanup:
+    acb_clear(L);
+    acb_clear(zinv);
+    acb_clear(A);
+    acb_clear(R0);
+    acb_clear(R1);
+    acb_clear(t);
+    acb_clear(u);
+}
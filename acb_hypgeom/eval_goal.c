@@ -0,0 +1,182 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_hypgeom.h"
+
+#define GOAL_GUARD_BITS 16
+
+void
+acb_hypgeom_goal_init(acb_hypgeom_goal_t G)
+{
+    G->lost = 0;
+    G->prec = 0;
+    G->attempts = 0;
+}
+
+int
+acb_hypgeom_eval_goal(acb_t res, acb_hypgeom_eval_func_t func, void * param,
+    slong goal, slong maxprec, acb_hypgeom_goal_t G)
+{
+    acb_t t, u;
+    slong wp, next, acc, best, lost, attempts;
+    int success, finite;
+
+    goal = FLINT_MAX(goal, 2);
+    maxprec = FLINT_MAX(maxprec, goal);
+
+    /* start from the cancellation seen in the previous evaluation */
+    lost = (G != NULL) ? G->lost : 0;
+    wp = FLINT_MIN(goal + lost + GOAL_GUARD_BITS, maxprec);
+
+    acb_init(t);
+    acb_init(u);
+
+    best = -ARF_PREC_EXACT;
+    attempts = 0;
+    success = 0;
+
+    while (1)
+    {
+        func(t, param, wp);
+        attempts++;
+
+        acc = acb_rel_accuracy_bits(t);
+
+        finite = acb_is_finite(t) && acc > 0;
+
+        if (finite)
+            lost = FLINT_MAX(wp - acc, 0);
+
+        /* each attempt gives a valid enclosure; keep the best one
+           (not in res, which may be aliased with an input) */
+        if (attempts == 1 || acc > best)
+        {
+            acb_swap(u, t);
+            best = acc;
+        }
+
+        if (acc >= goal)
+        {
+            success = 1;
+            break;
+        }
+
+        if (wp >= maxprec)
+            break;
+
+        if (finite)
+        {
+            /* The number of bits lost to cancellation usually changes
+               slowly with the precision: aim directly for goal bits. */
+            next = goal + lost + lost / 8 + GOAL_GUARD_BITS;
+            next = FLINT_MAX(next, wp + wp / 4);
+        }
+        else
+        {
+            next = 2 * wp;
+        }
+
+        wp = FLINT_MIN(next, maxprec);
+    }
+
+    if (G != NULL)
+    {
+        G->lost = lost;
+        G->prec = wp;
+        G->attempts = attempts;
+    }
+
+    acb_swap(res, u);
+
+    acb_clear(t);
+    acb_clear(u);
+    return success;
+}
+
+typedef struct
+{
+    acb_srcptr a;
+    slong p;
+    acb_srcptr b;
+    slong q;
+    acb_srcptr z;
+    acb_srcptr c;
+    int flags;
+}
+goal_args_struct;
+
+static void
+_pfq_func(acb_t res, void * param, slong prec)
+{
+    goal_args_struct * A = param;
+    acb_hypgeom_pfq(res, A->a, A->p, A->b, A->q, A->z, A->flags, prec);
+}
+
+static void
+_2f1_func(acb_t res, void * param, slong prec)
+{
+    goal_args_struct * A = param;
+    acb_hypgeom_2f1(res, A->a, A->b, A->c, A->z, A->flags, prec);
+}
+
+static void
+_u_func(acb_t res, void * param, slong prec)
+{
+    goal_args_struct * A = param;
+    acb_hypgeom_u(res, A->a, A->b, A->z, prec);
+}
+
+static void
+_bessel_j_func(acb_t res, void * param, slong prec)
+{
+    goal_args_struct * A = param;
+    acb_hypgeom_bessel_j(res, A->a, A->z, prec);
+}
+
+int
+acb_hypgeom_pfq_goal(acb_t res, acb_srcptr a, slong p, acb_srcptr b, slong q,
+    const acb_t z, int regularized, slong goal, slong maxprec, acb_hypgeom_goal_t G)
+{
+    goal_args_struct A;
+    A.a = a; A.p = p; A.b = b; A.q = q; A.z = z; A.c = NULL;
+    A.flags = regularized;
+    return acb_hypgeom_eval_goal(res, _pfq_func, &A, goal, maxprec, G);
+}
+
+int
+acb_hypgeom_2f1_goal(acb_t res, const acb_t a, const acb_t b, const acb_t c,
+    const acb_t z, int flags, slong goal, slong maxprec, acb_hypgeom_goal_t G)
+{
+    goal_args_struct A;
+    A.a = a; A.p = 0; A.b = b; A.q = 0; A.z = z; A.c = c;
+    A.flags = flags;
+    return acb_hypgeom_eval_goal(res, _2f1_func, &A, goal, maxprec, G);
+}
+
+int
+acb_hypgeom_u_goal(acb_t res, const acb_t a, const acb_t b, const acb_t z,
+    slong goal, slong maxprec, acb_hypgeom_goal_t G)
+{
+    goal_args_struct A;
+    A.a = a; A.p = 0; A.b = b; A.q = 0; A.z = z; A.c = NULL;
+    A.flags = 0;
+    return acb_hypgeom_eval_goal(res, _u_func, &A, goal, maxprec, G);
+}
+
+int
+acb_hypgeom_bessel_j_goal(acb_t res, const acb_t nu, const acb_t z,
+    slong goal, slong maxprec, acb_hypgeom_goal_t G)
+{
+    goal_args_struct A;
+    A.a = nu; A.p = 0; A.b = NULL; A.q = 0; A.z = z; A.c = NULL;
+    A.flags = 0;
+    return acb_hypgeom_eval_goal(res, _bessel_j_func, &A, goal, maxprec, G);
+}
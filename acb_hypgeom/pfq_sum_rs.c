@@ -11,6 +11,227 @@
 
 #include "acb_hypgeom.h"
 
+/* Parameters of the form num / 2^e with |num|, 2^e < 2^SMALL_PARAM_BITS. */
+#define SMALL_PARAM_BITS 30
+
+/* Writes x = num / 2^e if x is a small exact dyadic number. */
+static int
+_acb_get_small_dyadic(slong * num, slong * e, const acb_t x)
+{
+    fmpz_t man, exp;
+    int success;
+
+    if (!acb_is_exact(x) || !arb_is_zero(acb_imagref(x)))
+        return 0;
+
+    if (arf_is_zero(arb_midref(acb_realref(x))))
+    {
+        *num = 0;
+        *e = 0;
+        return 1;
+    }
+
+    fmpz_init(man);
+    fmpz_init(exp);
+
+    arf_get_fmpz_2exp(man, exp, arb_midref(acb_realref(x)));
+
+    success = fmpz_bits(man) <= SMALL_PARAM_BITS &&
+        fmpz_cmp_si(exp, -SMALL_PARAM_BITS) >= 0 &&
+        fmpz_cmp_si(exp, SMALL_PARAM_BITS - fmpz_bits(man)) <= 0;
+
+    if (success)
+    {
+        slong v = fmpz_get_si(exp);
+
+        if (v >= 0)
+        {
+            *num = fmpz_get_si(man) * (WORD(1) << v);
+            *e = 0;
+        }
+        else
+        {
+            *num = fmpz_get_si(man);
+            *e = -v;
+        }
+    }
+
+    fmpz_clear(man);
+    fmpz_clear(exp);
+
+    return success;
+}
+
+/* Converts the parameters, checking that each product
+   prod_i (num_i + 2^e_i (k-1)) for 1 <= k <= n fits in a word,
+   and optionally that it does not vanish. */
+static int
+_acb_get_small_params(slong * num, slong * e, acb_srcptr a, slong p,
+    slong n, int nonzero)
+{
+    slong i, bits;
+
+    bits = 0;
+
+    for (i = 0; i < p; i++)
+    {
+        if (!_acb_get_small_dyadic(num + i, e + i, a + i))
+            return 0;
+
+        bits += FLINT_MAX(FLINT_BIT_COUNT(FLINT_ABS(num[i])),
+                    e[i] + FLINT_BIT_COUNT(n)) + 1;
+
+        /* num + 2^e (k-1) = 0 for some k */
+        if (nonzero && num[i] <= 0 && (-num[i]) % (WORD(1) << e[i]) == 0 &&
+                (-num[i]) >> e[i] <= n - 1)
+            return 0;
+    }
+
+    return bits <= FLINT_BITS - 2;
+}
+
+static slong
+_small_poly_eval(const slong * num, const slong * e, slong p, slong k)
+{
+    slong i, c;
+
+    c = 1;
+    for (i = 0; i < p; i++)
+        c *= num[i] + ((k - 1) << e[i]);
+
+    return c;
+}
+
+/*
+    Rectangular splitting with word-size coefficients, for parameters
+    a_i = an_i / 2^ae_i, b_i = bn_i / 2^be_i. The term ratio is
+    2^(sum be - sum ae) z P(k) / Q(k) with integer polynomials P, Q.
+    Consecutive terms are collected with integer coefficients as long
+    as these fit in a word, so that each such run costs one dot product
+    and one division by a word instead of multiplications and divisions
+    by the parameters for every term.
+*/
+static void
+_acb_hypgeom_pfq_sum_rs_small(acb_t res, acb_t term,
+    const slong * an, const slong * ae, slong p,
+    const slong * bn, const slong * be, slong q,
+    const acb_t z, slong n, slong prec)
+{
+    acb_ptr zpow;
+    acb_t s, t;
+    slong i, j, k, kb, m, len, bits, tb, e, c, den;
+    slong * P, * Q, * cs;
+    mag_t B, C;
+
+    m = n_sqrt(n);
+    m = FLINT_MIN(m, 150);
+
+    mag_init(B);
+    mag_init(C);
+    acb_init(s);
+    acb_init(t);
+    zpow = _acb_vec_init(m + 1);
+    P = flint_malloc(sizeof(slong) * m);
+    Q = flint_malloc(sizeof(slong) * m);
+    cs = flint_malloc(sizeof(slong) * m);
+
+    e = 0;
+    for (i = 0; i < q; i++)
+        e += be[i];
+    for (i = 0; i < p; i++)
+        e -= ae[i];
+
+    acb_mul_2exp_si(t, z, e);
+    _acb_vec_set_powers(zpow, t, m + 1, prec);
+
+    /* bound for the first omitted term */
+    mag_one(B);
+    mag_mul_ui(B, B, FLINT_ABS(_small_poly_eval(an, ae, p, n)));
+    mag_div_ui(B, B, FLINT_ABS(_small_poly_eval(bn, be, q, n)));
+
+    for (k = n - 1; k >= 0; k = kb - 1)
+    {
+        j = k % m;
+
+        /* collect terms k, k-1, ..., kb within the same giant step */
+        bits = 0;
+        for (len = 0; len <= j; len++)
+        {
+            if (k - len == 0)
+            {
+                P[len] = Q[len] = 1;
+            }
+            else
+            {
+                P[len] = _small_poly_eval(an, ae, p, k - len);
+                Q[len] = _small_poly_eval(bn, be, q, k - len);
+            }
+
+            tb = FLINT_MAX(FLINT_BIT_COUNT(FLINT_ABS(P[len])),
+                           FLINT_BIT_COUNT(FLINT_ABS(Q[len])));
+
+            if (len != 0 && bits + tb > FLINT_BITS - 2)
+                break;
+
+            bits += tb;
+            mag_mul_ui(B, B, FLINT_ABS(P[len]));
+            mag_div_ui(B, B, FLINT_ABS(Q[len]));
+        }
+
+        kb = k - len + 1;
+
+        /* The coefficient of the term k - i is P(kb) ... P(k - i)
+           Q(k - i + 1) ... Q(k); cs is stored in order of increasing
+           powers of z. */
+        c = 1;
+        for (i = len - 1; i >= 0; i--)
+        {
+            c *= P[i];
+            cs[len - 1 - i] = c;
+        }
+
+        den = 1;
+        for (i = 0; i < len; i++)
+        {
+            cs[len - 1 - i] *= den;
+            den *= Q[i];
+        }
+
+        /* s <- (cs[top] (s + z^j) + sum cs[i] z^(j - len + 1 + i)) / den */
+        acb_add(t, s, zpow + j, prec);
+        acb_swap(zpow + j, t);
+        acb_dot_si(s, NULL, 0, zpow + j - len + 1, 1, cs, 1, len, prec);
+        acb_swap(zpow + j, t);
+
+        if (den != 1)
+            acb_div_si(s, s, den, prec);
+
+        if (kb % m == 0 && kb > 0)
+            acb_mul(s, s, zpow + m, prec);
+    }
+
+    acb_get_mag(C, zpow + 1);
+    mag_pow_ui(C, C, n);
+    mag_mul(B, B, C);
+
+    acb_zero(term);
+    if (acb_is_real(z))
+        arb_add_error_mag(acb_realref(term), B);
+    else
+        acb_add_error_mag(term, B);
+
+    acb_swap(res, s);
+
+    mag_clear(B);
+    mag_clear(C);
+    acb_clear(s);
+    acb_clear(t);
+    _acb_vec_clear(zpow, m + 1);
+    flint_free(P);
+    flint_free(Q);
+    flint_free(cs);
+}
+
 void
 acb_hypgeom_pfq_sum_rs(acb_t res, acb_t term, acb_srcptr a, slong p,
                                               acb_srcptr b, slong q, const acb_t z, slong n, slong prec)
@@ -30,6 +251,18 @@ acb_hypgeom_pfq_sum_rs(acb_t res, acb_t term, acb_srcptr a, slong p,
     if (n < 0)
         flint_abort();
 
+    if (n >= 4 && p <= 8 && q <= 8)
+    {
+        slong an[8], ae[8], bn[8], be[8];
+
+        if (_acb_get_small_params(an, ae, a, p, n, 0) &&
+            _acb_get_small_params(bn, be, b, q, n, 1))
+        {
+            _acb_hypgeom_pfq_sum_rs_small(res, term, an, ae, p, bn, be, q, z, n, prec);
+            return;
+        }
+    }
+
     m = n_sqrt(n);
     m = FLINT_MIN(m, 150);
 
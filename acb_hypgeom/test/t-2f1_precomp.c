@@ -0,0 +1,127 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_hypgeom.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("2f1_precomp....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 300 * arb_test_multiplier(); iter++)
+    {
+        acb_t a, b, c, t;
+        acb_ptr z, r1, r2;
+        acb_hypgeom_2f1_precomp_t pre;
+        slong i, len, prec;
+        int flags;
+
+        acb_init(a);
+        acb_init(b);
+        acb_init(c);
+        acb_init(t);
+
+        prec = 2 + n_randint(state, 200);
+        len = n_randint(state, 20);
+        flags = 0;
+
+        if (n_randint(state, 4) == 0)
+            flags |= ACB_HYPGEOM_2F1_REGULARIZED;
+
+        if (n_randint(state, 2))
+        {
+            acb_set_si(a, (slong) n_randint(state, 10) - 5);
+            acb_mul_2exp_si(a, a, -1);
+            acb_set_si(b, (slong) n_randint(state, 10) - 5);
+            acb_mul_2exp_si(b, b, -1);
+            acb_set_si(c, (slong) n_randint(state, 10) - 5);
+            acb_mul_2exp_si(c, c, -1);
+        }
+        else
+        {
+            acb_randtest_param(a, state, 1 + n_randint(state, 400), 1 + n_randint(state, 3));
+            acb_randtest_param(b, state, 1 + n_randint(state, 400), 1 + n_randint(state, 3));
+            acb_randtest_param(c, state, 1 + n_randint(state, 400), 1 + n_randint(state, 3));
+        }
+
+        z = _acb_vec_init(len);
+        r1 = _acb_vec_init(len);
+        r2 = _acb_vec_init(len);
+
+        /* points in all regions of the plane */
+        for (i = 0; i < len; i++)
+        {
+            if (n_randint(state, 4) == 0)
+                acb_randtest_special(z + i, state, 1 + n_randint(state, 400), 3);
+            else
+                acb_randtest(z + i, state, 1 + n_randint(state, 400), 2);
+        }
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        acb_hypgeom_2f1_precomp_init(pre, a, b, c, flags, prec);
+        acb_hypgeom_2f1_precomp_eval_vec(r1, pre, z, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            acb_hypgeom_2f1(r2 + i, a, b, c, z + i, flags, prec);
+            acb_hypgeom_2f1_precomp_eval(t, pre, z + i, prec);
+
+            if (!acb_overlaps(r1 + i, r2 + i) || !acb_equal(r1 + i, t))
+            {
+                flint_printf("FAIL\n\n");
+                flint_printf("flags = %d, prec = %wd, i = %wd\n\n", flags, prec, i);
+                flint_printf("a = "); acb_printd(a, 30); flint_printf("\n\n");
+                flint_printf("b = "); acb_printd(b, 30); flint_printf("\n\n");
+                flint_printf("c = "); acb_printd(c, 30); flint_printf("\n\n");
+                flint_printf("z = "); acb_printd(z + i, 30); flint_printf("\n\n");
+                flint_printf("r1 = "); acb_printd(r1 + i, 30); flint_printf("\n\n");
+                flint_printf("r2 = "); acb_printd(r2 + i, 30); flint_printf("\n\n");
+                flint_printf("t = "); acb_printd(t, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        /* aliasing */
+        acb_hypgeom_2f1_precomp_eval_vec(z, pre, z, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!acb_equal(r1 + i, z + i))
+            {
+                flint_printf("FAIL (aliasing)\n\n");
+                flint_printf("flags = %d, prec = %wd, i = %wd\n\n", flags, prec, i);
+                flint_abort();
+            }
+        }
+
+        acb_hypgeom_2f1_precomp_clear(pre);
+
+        _acb_vec_clear(z, len);
+        _acb_vec_clear(r1, len);
+        _acb_vec_clear(r2, len);
+
+        acb_clear(a);
+        acb_clear(b);
+        acb_clear(c);
+        acb_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
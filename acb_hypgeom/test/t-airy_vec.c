@@ -0,0 +1,79 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_hypgeom.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("airy_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 300 * arb_test_multiplier(); iter++)
+    {
+        acb_ptr z, ai, aip, bi, bip;
+        acb_t t, u;
+        slong i, len, prec;
+
+        prec = 2 + n_randint(state, 300);
+        len = n_randint(state, 20);
+
+        z = _acb_vec_init(len);
+        ai = _acb_vec_init(len);
+        aip = _acb_vec_init(len);
+        bi = _acb_vec_init(len);
+        bip = _acb_vec_init(len);
+        acb_init(t);
+        acb_init(u);
+
+        for (i = 0; i < len; i++)
+            acb_randtest(z + i, state, 1 + n_randint(state, 300), 1 + n_randint(state, 8));
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        acb_hypgeom_airy_vec(ai, n_randint(state, 2) ? aip : NULL,
+            bi, n_randint(state, 2) ? bip : NULL, z, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            acb_hypgeom_airy(t, NULL, u, NULL, z + i, prec);
+
+            if (!acb_overlaps(t, ai + i) || !acb_overlaps(u, bi + i))
+            {
+                flint_printf("FAIL\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("z = "); acb_printd(z + i, 30); flint_printf("\n\n");
+                flint_printf("ai = "); acb_printd(ai + i, 30); flint_printf("\n\n");
+                flint_printf("t = "); acb_printd(t, 30); flint_printf("\n\n");
+                flint_printf("bi = "); acb_printd(bi + i, 30); flint_printf("\n\n");
+                flint_printf("u = "); acb_printd(u, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _acb_vec_clear(z, len);
+        _acb_vec_clear(ai, len);
+        _acb_vec_clear(aip, len);
+        _acb_vec_clear(bi, len);
+        _acb_vec_clear(bip, len);
+        acb_clear(t);
+        acb_clear(u);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
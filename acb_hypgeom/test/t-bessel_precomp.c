@@ -0,0 +1,129 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_hypgeom.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("bessel_precomp....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 300 * arb_test_multiplier(); iter++)
+    {
+        acb_t nu, t;
+        acb_ptr z, r1, r2;
+        acb_hypgeom_bessel_precomp_t pre;
+        slong i, len, prec;
+        int kind;
+
+        acb_init(nu);
+        acb_init(t);
+
+        prec = 2 + n_randint(state, 300);
+        len = n_randint(state, 20);
+        kind = n_randint(state, 3);
+
+        if (n_randint(state, 2))
+            acb_set_si(nu, (slong) n_randint(state, 20) - 10);
+        else
+            acb_randtest_param(nu, state, 1 + n_randint(state, 400), 1 + n_randint(state, 4));
+
+        if (n_randint(state, 2))
+            acb_mul_2exp_si(nu, nu, -1);
+
+        z = _acb_vec_init(len);
+        r1 = _acb_vec_init(len);
+        r2 = _acb_vec_init(len);
+
+        for (i = 0; i < len; i++)
+        {
+            acb_randtest(z + i, state, 1 + n_randint(state, 400), 2 + n_randint(state, 8));
+
+            if (n_randint(state, 2))
+                arb_zero(acb_imagref(z + i));
+        }
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        acb_hypgeom_bessel_precomp_init(pre, nu, prec);
+
+        if (kind == 0)
+            acb_hypgeom_bessel_precomp_eval_j_vec(r1, pre, z, len, prec);
+        else
+            acb_hypgeom_bessel_precomp_eval_k_vec(r1, pre, z, len, kind - 1, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (kind == 0)
+            {
+                acb_hypgeom_bessel_j(r2 + i, nu, z + i, prec);
+                acb_hypgeom_bessel_precomp_eval_j(t, pre, z + i, prec);
+            }
+            else if (kind == 1)
+            {
+                acb_hypgeom_bessel_k(r2 + i, nu, z + i, prec);
+                acb_hypgeom_bessel_precomp_eval_k(t, pre, z + i, 0, prec);
+            }
+            else
+            {
+                acb_hypgeom_bessel_k_scaled(r2 + i, nu, z + i, prec);
+                acb_hypgeom_bessel_precomp_eval_k(t, pre, z + i, 1, prec);
+            }
+
+            if (!acb_overlaps(r1 + i, r2 + i) || !acb_equal(r1 + i, t))
+            {
+                flint_printf("FAIL\n\n");
+                flint_printf("kind = %d, prec = %wd, i = %wd\n\n", kind, prec, i);
+                flint_printf("nu = "); acb_printd(nu, 30); flint_printf("\n\n");
+                flint_printf("z = "); acb_printd(z + i, 30); flint_printf("\n\n");
+                flint_printf("r1 = "); acb_printd(r1 + i, 30); flint_printf("\n\n");
+                flint_printf("r2 = "); acb_printd(r2 + i, 30); flint_printf("\n\n");
+                flint_printf("t = "); acb_printd(t, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        /* aliasing */
+        if (kind == 0)
+            acb_hypgeom_bessel_precomp_eval_j_vec(z, pre, z, len, prec);
+        else
+            acb_hypgeom_bessel_precomp_eval_k_vec(z, pre, z, len, kind - 1, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!acb_equal(r1 + i, z + i))
+            {
+                flint_printf("FAIL (aliasing)\n\n");
+                flint_printf("kind = %d, prec = %wd, i = %wd\n\n", kind, prec, i);
+                flint_abort();
+            }
+        }
+
+        acb_hypgeom_bessel_precomp_clear(pre);
+
+        _acb_vec_clear(z, len);
+        _acb_vec_clear(r1, len);
+        _acb_vec_clear(r2, len);
+
+        acb_clear(nu);
+        acb_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,106 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_hypgeom.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("coulomb_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 200 * arb_test_multiplier(); iter++)
+    {
+        acb_ptr F, G, Hp, Hn;
+        acb_t l, eta, z, m, F1, G1, Hp1, Hn1;
+        slong len, k, prec;
+        int which;
+
+        len = n_randint(state, 40);
+        prec = 2 + n_randint(state, 200);
+        which = n_randint(state, 16);
+
+        F = _acb_vec_init(len);
+        G = _acb_vec_init(len);
+        Hp = _acb_vec_init(len);
+        Hn = _acb_vec_init(len);
+        acb_init(l);
+        acb_init(eta);
+        acb_init(z);
+        acb_init(m);
+        acb_init(F1);
+        acb_init(G1);
+        acb_init(Hp1);
+        acb_init(Hn1);
+
+        if (n_randint(state, 2))
+        {
+            acb_set_ui(l, n_randint(state, 5));
+            arb_randtest(acb_realref(eta), state, 2 + n_randint(state, 100), 3);
+            arb_randtest(acb_realref(z), state, 2 + n_randint(state, 100), 5);
+            arb_abs(acb_realref(z), acb_realref(z));
+        }
+        else
+        {
+            acb_randtest_param(l, state, 2 + n_randint(state, 100), 3);
+            acb_randtest_param(eta, state, 2 + n_randint(state, 100), 3);
+            acb_randtest(z, state, 2 + n_randint(state, 100), 5);
+        }
+
+        acb_hypgeom_coulomb_vec((which & 1) ? F : NULL, (which & 2) ? G : NULL,
+            (which & 4) ? Hp : NULL, (which & 8) ? Hn : NULL, l, eta, z, len, prec);
+
+        for (k = 0; k < len; k++)
+        {
+            acb_add_ui(m, l, k, prec + 64);
+            acb_hypgeom_coulomb(F1, G1, Hp1, Hn1, m, eta, z, prec);
+
+            if (((which & 1) && !acb_overlaps(F1, F + k)) ||
+                ((which & 2) && !acb_overlaps(G1, G + k)) ||
+                ((which & 4) && !acb_overlaps(Hp1, Hp + k)) ||
+                ((which & 8) && !acb_overlaps(Hn1, Hn + k)))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("len = %wd, k = %wd, prec = %wd, which = %d\n\n", len, k, prec, which);
+                flint_printf("l = "); acb_printn(l, 30, 0); flint_printf("\n\n");
+                flint_printf("eta = "); acb_printn(eta, 30, 0); flint_printf("\n\n");
+                flint_printf("z = "); acb_printn(z, 30, 0); flint_printf("\n\n");
+                flint_printf("F1 = "); acb_printn(F1, 30, 0); flint_printf("\n\n");
+                flint_printf("F = "); acb_printn(F + k, 30, 0); flint_printf("\n\n");
+                flint_printf("G1 = "); acb_printn(G1, 30, 0); flint_printf("\n\n");
+                flint_printf("G = "); acb_printn(G + k, 30, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _acb_vec_clear(F, len);
+        _acb_vec_clear(G, len);
+        _acb_vec_clear(Hp, len);
+        _acb_vec_clear(Hn, len);
+        acb_clear(l);
+        acb_clear(eta);
+        acb_clear(z);
+        acb_clear(m);
+        acb_clear(F1);
+        acb_clear(G1);
+        acb_clear(Hp1);
+        acb_clear(Hn1);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,120 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_hypgeom.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("eval_goal....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        acb_t a, b, c, z, r1, r2;
+        acb_hypgeom_goal_t G;
+        slong goal, maxprec;
+        int success, alg;
+
+        acb_init(a);
+        acb_init(b);
+        acb_init(c);
+        acb_init(z);
+        acb_init(r1);
+        acb_init(r2);
+        acb_hypgeom_goal_init(G);
+
+        goal = 2 + n_randint(state, 200);
+        maxprec = goal + n_randint(state, 1000);
+
+        acb_set_si(a, (slong) n_randint(state, 40) - 20);
+        acb_set_si(b, (slong) n_randint(state, 40) - 20);
+        acb_set_si(c, (slong) n_randint(state, 40) + 1);
+        acb_randtest(z, state, 2 + n_randint(state, 200), 3);
+        arb_zero(acb_imagref(z));
+
+        alg = n_randint(state, 4);
+
+        /* evaluate twice to exercise the remembered cancellation */
+        if (alg == 0)
+        {
+            acb_hypgeom_2f1_goal(r1, a, b, c, z, 0, goal, maxprec, G);
+            success = acb_hypgeom_2f1_goal(r1, a, b, c, z, 0, goal, maxprec, G);
+            acb_hypgeom_2f1(r2, a, b, c, z, 0, maxprec);
+        }
+        else if (alg == 1)
+        {
+            acb_hypgeom_u_goal(r1, a, c, z, goal, maxprec, G);
+            success = acb_hypgeom_u_goal(r1, a, c, z, goal, maxprec, G);
+            acb_hypgeom_u(r2, a, c, z, maxprec);
+        }
+        else if (alg == 2)
+        {
+            acb_hypgeom_bessel_j_goal(r1, a, z, goal, maxprec, G);
+            success = acb_hypgeom_bessel_j_goal(r1, a, z, goal, maxprec, G);
+            acb_hypgeom_bessel_j(r2, a, z, maxprec);
+        }
+        else
+        {
+            acb_hypgeom_pfq_goal(r1, a, 1, c, 1, z, 0, goal, maxprec, G);
+            success = acb_hypgeom_pfq_goal(r1, a, 1, c, 1, z, 0, goal, maxprec, G);
+            acb_hypgeom_pfq(r2, a, 1, c, 1, z, 0, maxprec);
+        }
+
+        if (!acb_overlaps(r1, r2) ||
+            (success && acb_rel_accuracy_bits(r1) < goal) ||
+            G->attempts < 1 || G->prec > maxprec)
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("alg = %d, goal = %wd, maxprec = %wd, success = %d\n\n", alg, goal, maxprec, success);
+            flint_printf("z = "); acb_printn(z, 30, 0); flint_printf("\n\n");
+            flint_printf("r1 = "); acb_printn(r1, 30, 0); flint_printf("\n\n");
+            flint_printf("r2 = "); acb_printn(r2, 30, 0); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        /* aliasing */
+        acb_set(r2, z);
+        if (alg == 0)
+            acb_hypgeom_2f1_goal(r2, a, b, c, r2, 0, goal, maxprec, NULL);
+        else if (alg == 1)
+            acb_hypgeom_u_goal(r2, a, c, r2, goal, maxprec, NULL);
+        else if (alg == 2)
+            acb_hypgeom_bessel_j_goal(r2, a, r2, goal, maxprec, NULL);
+        else
+            acb_hypgeom_pfq_goal(r2, a, 1, c, 1, r2, 0, goal, maxprec, NULL);
+
+        if (!acb_overlaps(r1, r2))
+        {
+            flint_printf("FAIL (aliasing)\n\n");
+            flint_printf("alg = %d, goal = %wd, maxprec = %wd\n\n", alg, goal, maxprec);
+            flint_printf("r1 = "); acb_printn(r1, 30, 0); flint_printf("\n\n");
+            flint_printf("r2 = "); acb_printn(r2, 30, 0); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        acb_clear(a);
+        acb_clear(b);
+        acb_clear(c);
+        acb_clear(z);
+        acb_clear(r1);
+        acb_clear(r2);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -53,6 +53,22 @@ int main()
         for (i = 0; i < q; i++)
             acb_randtest(b + i, state, 1 + n_randint(state, 100), 1 + n_randint(state, 10));
 
+        /* small rational parameters */
+        if (n_randint(state, 2))
+        {
+            for (i = 0; i < p; i++)
+            {
+                acb_set_si(a + i, (slong) n_randint(state, 100) - 50);
+                acb_mul_2exp_si(a + i, a + i, -(slong) n_randint(state, 4));
+            }
+
+            for (i = 0; i < q; i++)
+            {
+                acb_set_si(b + i, (slong) n_randint(state, 100) - 50);
+                acb_mul_2exp_si(b + i, b + i, -(slong) n_randint(state, 4));
+            }
+        }
+
         acb_hypgeom_pfq_sum_forward(s1, t1, a, p, b, q, z, n, prec1);
         acb_hypgeom_pfq_sum_rs(s2, t2, a, p, b, q, z, n, prec2);
 
@@ -83,7 +83,8 @@ acb_mat_mul(acb_mat_t C, const acb_mat_t A, const acb_mat_t B, slong prec)
     }
 
     if (flint_get_num_threads() > 1 &&
-        ((double) ar * (double) ac * (double) bc * (double) prec > 100000))
+        ((double) ar * (double) ac * (double) bc * (double) prec >
+            arb_tune_get(ARB_TUNE_MAT_MUL_THREAD_MIN)))
     {
         acb_mat_mul_threaded(C, A, B, prec);
     }
@@ -330,6 +330,14 @@ void acb_poly_mullow_transpose_gauss(acb_poly_t res, const acb_poly_t poly1,
                                             const acb_poly_t poly2,
                                                 slong n, slong prec);
 
+void _acb_poly_mullow_block(acb_ptr res,
+    acb_srcptr poly1, slong len1,
+    acb_srcptr poly2, slong len2, slong n, slong prec);
+
+void acb_poly_mullow_block(acb_poly_t res, const acb_poly_t poly1,
+                                            const acb_poly_t poly2,
+                                                slong n, slong prec);
+
 void _acb_poly_mullow(acb_ptr res,
     acb_srcptr poly1, slong len1,
     acb_srcptr poly2, slong len2, slong n, slong prec);
@@ -338,6 +346,27 @@ void acb_poly_mullow(acb_poly_t res, const acb_poly_t poly1,
                                             const acb_poly_t poly2,
                                                 slong n, slong prec);
 
+void _acb_poly_mulmid_classical(acb_ptr res,
+    acb_srcptr poly1, slong len1,
+    acb_srcptr poly2, slong len2, slong lo, slong hi, slong prec);
+
+void acb_poly_mulmid_classical(acb_poly_t res, const acb_poly_t poly1,
+    const acb_poly_t poly2, slong lo, slong hi, slong prec);
+
+void _acb_poly_mulmid_block(acb_ptr res,
+    acb_srcptr poly1, slong len1,
+    acb_srcptr poly2, slong len2, slong lo, slong hi, slong prec);
+
+void acb_poly_mulmid_block(acb_poly_t res, const acb_poly_t poly1,
+    const acb_poly_t poly2, slong lo, slong hi, slong prec);
+
+void _acb_poly_mulmid(acb_ptr res,
+    acb_srcptr poly1, slong len1,
+    acb_srcptr poly2, slong len2, slong lo, slong hi, slong prec);
+
+void acb_poly_mulmid(acb_poly_t res, const acb_poly_t poly1,
+    const acb_poly_t poly2, slong lo, slong hi, slong prec);
+
 void _acb_poly_mul(acb_ptr C,
     acb_srcptr A, slong lenA,
     acb_srcptr B, slong lenB, slong prec);
@@ -524,6 +553,33 @@ void _acb_poly_tree_free(acb_ptr * tree, slong len);
 void
 _acb_poly_tree_build(acb_ptr * tree, acb_srcptr roots, slong len, slong prec);
 
+/* Levels of the tree with at least this many points are processed
+   in parallel when threads are available. */
+#define ACB_POLY_TREE_THREAD_CUTOFF 64
+
+typedef struct
+{
+    acb_ptr * tree;
+    acb_ptr weights;
+    slong len;
+    slong prec;
+}
+acb_poly_tree_struct;
+
+typedef acb_poly_tree_struct acb_poly_tree_t[1];
+
+void acb_poly_tree_init(acb_poly_tree_t T, acb_srcptr xs, slong len, slong prec);
+
+void acb_poly_tree_clear(acb_poly_tree_t T);
+
+void
+acb_poly_evaluate_vec_tree(acb_ptr ys,
+        const acb_poly_t poly, const acb_poly_tree_t T, slong prec);
+
+void
+acb_poly_interpolate_tree(acb_poly_t poly,
+        acb_srcptr ys, acb_poly_tree_t T, slong prec);
+
 
 void _acb_poly_root_inclusion(acb_t r, const acb_t m,
     acb_srcptr poly,
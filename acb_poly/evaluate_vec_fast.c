@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_poly.h"
 
 /* This gives some speedup for small lengths. */
@@ -27,14 +28,82 @@ _acb_poly_rem_2(acb_ptr r, acb_srcptr a, slong al,
     }
 }
 
+/* Reduces the k-th chunk of t modulo the two polynomials
+   below it on level i, writing the remainders to u. */
+static void
+_acb_poly_evaluate_vec_fast_chunk(acb_ptr u, acb_srcptr t,
+    acb_ptr * tree, slong len, slong i, slong k, slong prec)
+{
+    slong pow, left;
+    acb_ptr pa, pc;
+    acb_srcptr pb;
+
+    pow = WORD(1) << i;
+    left = len - 2 * pow * k;
+    pa = tree[i] + (2 * pow + 2) * k;
+    pb = t + 2 * pow * k;
+    pc = u + 2 * pow * k;
+
+    if (left >= 2 * pow)
+    {
+        _acb_poly_rem_2(pc, pb, 2 * pow, pa, pow + 1, prec);
+        _acb_poly_rem_2(pc + pow, pb, 2 * pow, pa + pow + 1, pow + 1, prec);
+    }
+    else if (left > pow)
+    {
+        _acb_poly_rem(pc, pb, left, pa, pow + 1, prec);
+        _acb_poly_rem(pc + pow, pb, left, pa + pow + 1, left - pow + 1, prec);
+    }
+    else if (left > 0)
+        _acb_vec_set(pc, pb, left);
+}
+
+typedef struct
+{
+    acb_ptr u;
+    acb_srcptr t;
+    acb_srcptr poly;
+    slong plen;
+    acb_ptr * tree;
+    slong len;
+    slong level;
+    slong prec;
+}
+eval_work_t;
+
+static void
+initial_worker(slong k, void * _work)
+{
+    eval_work_t * work = (eval_work_t *) _work;
+    slong i, j, pow, tlen;
+
+    pow = WORD(1) << work->level;
+    i = pow * k;
+    j = (pow + 1) * k;
+    tlen = ((i + pow) <= work->len) ? pow : work->len % pow;
+
+    _acb_poly_rem(work->u + i, work->poly, work->plen,
+        work->tree[work->level] + j, tlen + 1, work->prec);
+}
+
+static void
+descent_worker(slong k, void * _work)
+{
+    eval_work_t * work = (eval_work_t *) _work;
+
+    _acb_poly_evaluate_vec_fast_chunk(work->u, work->t, work->tree,
+        work->len, work->level, k, work->prec);
+}
+
 void
 _acb_poly_evaluate_vec_fast_precomp(acb_ptr vs, acb_srcptr poly,
     slong plen, acb_ptr * tree, slong len, slong prec)
 {
-    slong height, i, j, pow, left;
+    slong height, i, j, k, num, pow;
     slong tree_height;
     slong tlen;
-    acb_ptr t, u, swap, pa, pb, pc;
+    int threaded;
+    acb_ptr t, u, swap;
 
     /* avoid worrying about some degenerate cases */
     if (len < 2 || plen < 2)
@@ -62,7 +131,8 @@ _acb_poly_evaluate_vec_fast_precomp(acb_ptr vs, acb_srcptr poly,
     t = _acb_vec_init(len);
     u = _acb_vec_init(len);
 
-    left = len;
+    threaded = (len >= ACB_POLY_TREE_THREAD_CUTOFF &&
+        flint_get_num_threads() > 1);
 
     /* Initial reduction. We allow the polynomial to be larger
         or smaller than the number of points. */
@@ -71,39 +141,55 @@ _acb_poly_evaluate_vec_fast_precomp(acb_ptr vs, acb_srcptr poly,
     while (height >= tree_height)
         height--;
     pow = WORD(1) << height;
+    num = (len + pow - 1) / pow;
 
-    for (i = j = 0; i < len; i += pow, j += (pow + 1))
+    if (threaded && num >= 2)
     {
-        tlen = ((i + pow) <= len) ? pow : len % pow;
-        _acb_poly_rem(t + i, poly, plen, tree[height] + j, tlen + 1, prec);
+        eval_work_t work;
+
+        work.u = t;
+        work.poly = poly;
+        work.plen = plen;
+        work.tree = tree;
+        work.len = len;
+        work.level = height;
+        work.prec = prec;
+
+        flint_parallel_do((do_func_t) initial_worker, &work, num, -1, FLINT_PARALLEL_STRIDED);
+    }
+    else
+    {
+        for (i = j = 0; i < len; i += pow, j += (pow + 1))
+        {
+            tlen = ((i + pow) <= len) ? pow : len % pow;
+            _acb_poly_rem(t + i, poly, plen, tree[height] + j, tlen + 1, prec);
+        }
     }
 
+    /* Remainders on each level are independent. */
     for (i = height - 1; i >= 0; i--)
     {
         pow = WORD(1) << i;
-        left = len;
-        pa = tree[i];
-        pb = t;
-        pc = u;
+        num = (len + 2 * pow - 1) / (2 * pow);
 
-        while (left >= 2 * pow)
+        if (threaded && num >= 2)
         {
-            _acb_poly_rem_2(pc, pb, 2 * pow, pa, pow + 1, prec);
-            _acb_poly_rem_2(pc + pow, pb, 2 * pow, pa + pow + 1, pow + 1, prec);
+            eval_work_t work;
 
-            pa += 2 * pow + 2;
-            pb += 2 * pow;
-            pc += 2 * pow;
-            left -= 2 * pow;
-        }
+            work.u = u;
+            work.t = t;
+            work.tree = tree;
+            work.len = len;
+            work.level = i;
+            work.prec = prec;
 
-        if (left > pow)
+            flint_parallel_do((do_func_t) descent_worker, &work, num, -1, FLINT_PARALLEL_STRIDED);
+        }
+        else
         {
-            _acb_poly_rem(pc, pb, left, pa, pow + 1, prec);
-            _acb_poly_rem(pc + pow, pb, left, pa + pow + 1, left - pow + 1, prec);
+            for (k = 0; k < num; k++)
+                _acb_poly_evaluate_vec_fast_chunk(u, t, tree, len, i, k, prec);
         }
-        else if (left > 0)
-            _acb_vec_set(pc, pb, left);
 
         swap = t;
         t = u;
@@ -133,3 +219,11 @@ acb_poly_evaluate_vec_fast(acb_ptr ys,
     _acb_poly_evaluate_vec_fast(ys, poly->coeffs,
                                         poly->length, xs, n, prec);
 }
+
+void
+acb_poly_evaluate_vec_tree(acb_ptr ys,
+        const acb_poly_t poly, const acb_poly_tree_t T, slong prec)
+{
+    _acb_poly_evaluate_vec_fast_precomp(ys, poly->coeffs,
+                                        poly->length, T->tree, T->len, prec);
+}
@@ -49,7 +49,7 @@ _acb_poly_mullow(acb_ptr res,
         if (2 * FLINT_MIN(len1, len2) <= cutoff || n <= cutoff)
             _acb_poly_mullow_classical(res, poly1, len1, poly2, len2, n, prec);
         else
-            _acb_poly_mullow_transpose(res, poly1, len1, poly2, len2, n, prec);
+            _acb_poly_mullow_block(res, poly1, len1, poly2, len2, n, prec);
     }
 }
 
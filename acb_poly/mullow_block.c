@@ -0,0 +1,678 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_poly.h"
+
+/* Same tuning parameters as for real polynomials. */
+#define ALPHA (arb_tune_get(ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA) * 0.01)
+#define BETA arb_tune_get(ARB_TUNE_POLY_MULLOW_BLOCK_BETA)
+
+static int
+_acb_vec_is_finite(acb_srcptr x, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        if (!acb_is_finite(x + i))
+            return 0;
+
+    return 1;
+}
+
+static int
+_acb_mid_is_special(const acb_t x)
+{
+    return arf_is_special(arb_midref(acb_realref(x))) &&
+           arf_is_special(arb_midref(acb_imagref(x)));
+}
+
+/* Exponent of the larger part of the midpoint (not both special). */
+static const fmpz *
+_acb_mid_expref(const acb_t x)
+{
+    const arf_struct * a = arb_midref(acb_realref(x));
+    const arf_struct * b = arb_midref(acb_imagref(x));
+
+    if (arf_is_special(a))
+        return ARF_EXPREF(b);
+    else if (arf_is_special(b))
+        return ARF_EXPREF(a);
+    else
+        return (fmpz_cmp(ARF_EXPREF(a), ARF_EXPREF(b)) >= 0) ?
+            ARF_EXPREF(a) : ARF_EXPREF(b);
+}
+
+/* Complex version of _arb_poly_get_scale. */
+static void
+_acb_poly_get_scale(fmpz_t scale, acb_srcptr x, slong xlen,
+                                  acb_srcptr y, slong ylen)
+{
+    slong xa, xb, ya, yb, den;
+
+    fmpz_zero(scale);
+
+    xa = 0;
+    xb = xlen - 1;
+    while (xa < xlen && _acb_mid_is_special(x + xa)) xa++;
+    while (xb > xa && _acb_mid_is_special(x + xb)) xb--;
+
+    ya = 0;
+    yb = ylen - 1;
+    while (ya < ylen && _acb_mid_is_special(y + ya)) ya++;
+    while (yb > ya && _acb_mid_is_special(y + yb)) yb--;
+
+    if (xa <= xb && ya <= yb && (xa < xb || ya < yb))
+    {
+        fmpz_add(scale, scale, _acb_mid_expref(x + xb));
+        fmpz_sub(scale, scale, _acb_mid_expref(x + xa));
+        fmpz_add(scale, scale, _acb_mid_expref(y + yb));
+        fmpz_sub(scale, scale, _acb_mid_expref(y + ya));
+
+        den = (xb - xa) + (yb - ya);
+
+        fmpz_mul_2exp(scale, scale, 1);
+        fmpz_add_ui(scale, scale, den);
+        fmpz_fdiv_q_ui(scale, scale, 2 * den);
+    }
+}
+
+/* Like _arb_vec_get_fmpz_2exp_blocks, but the real and imaginary parts
+   share the blocks: the height of a block is determined by both parts,
+   so the two integer vectors in a block have the same exponent. */
+static void
+_acb_vec_get_fmpz_2exp_blocks(fmpz * re, fmpz * im, fmpz * exps,
+    slong * blocks, const fmpz_t scale, acb_srcptr x, slong len, slong prec)
+{
+    fmpz_t top, bot, t, b, v, block_top, block_bot;
+    slong i, j, s, block, rbits, ibits, maxheight;
+    int in_zero;
+
+    fmpz_init(top);
+    fmpz_init(bot);
+    fmpz_init(t);
+    fmpz_init(b);
+    fmpz_init(v);
+    fmpz_init(block_top);
+    fmpz_init(block_bot);
+
+    blocks[0] = 0;
+    block = 0;
+    in_zero = 1;
+
+    if (prec == ARF_PREC_EXACT)
+        maxheight = ARF_PREC_EXACT;
+    else
+        maxheight = ALPHA * prec + BETA;
+
+    for (i = 0; i < len; i++)
+    {
+        rbits = arf_bits(arb_midref(acb_realref(x + i)));
+        ibits = arf_bits(arb_midref(acb_imagref(x + i)));
+
+        /* Skip (must be zero, since we assume there are no Infs/NaNs). */
+        if (rbits == 0 && ibits == 0)
+            continue;
+
+        /* Bottom and top exponent of current number */
+        if (ibits == 0)
+        {
+            fmpz_set(top, ARF_EXPREF(arb_midref(acb_realref(x + i))));
+            fmpz_sub_ui(bot, top, rbits);
+        }
+        else if (rbits == 0)
+        {
+            fmpz_set(top, ARF_EXPREF(arb_midref(acb_imagref(x + i))));
+            fmpz_sub_ui(bot, top, ibits);
+        }
+        else
+        {
+            fmpz_sub_ui(t, ARF_EXPREF(arb_midref(acb_realref(x + i))), rbits);
+            fmpz_sub_ui(b, ARF_EXPREF(arb_midref(acb_imagref(x + i))), ibits);
+            fmpz_min(bot, t, b);
+            fmpz_max(top, ARF_EXPREF(arb_midref(acb_realref(x + i))),
+                ARF_EXPREF(arb_midref(acb_imagref(x + i))));
+        }
+
+        fmpz_submul_ui(top, scale, i);
+        fmpz_submul_ui(bot, scale, i);
+
+        /* Extend current block. */
+        if (in_zero)
+        {
+            fmpz_swap(block_top, top);
+            fmpz_swap(block_bot, bot);
+        }
+        else
+        {
+            fmpz_max(t, top, block_top);
+            fmpz_min(b, bot, block_bot);
+            fmpz_sub(v, t, b);
+
+            /* extend current block */
+            if (fmpz_cmp_ui(v, maxheight) < 0)
+            {
+                fmpz_swap(block_top, t);
+                fmpz_swap(block_bot, b);
+            }
+            else  /* start new block */
+            {
+                /* write exponent for previous block */
+                fmpz_set(exps + block, block_bot);
+
+                block++;
+                blocks[block] = i;
+
+                fmpz_swap(block_top, top);
+                fmpz_swap(block_bot, bot);
+            }
+        }
+
+        in_zero = 0;
+    }
+
+    /* write exponent for last block */
+    fmpz_set(exps + block, block_bot);
+
+    /* end marker */
+    blocks[block + 1] = len;
+
+    /* write the block data */
+    for (i = 0; blocks[i] != len; i++)
+    {
+        for (j = blocks[i]; j < blocks[i + 1]; j++)
+        {
+            arf_srcptr mid[2];
+            fmpz * out[2];
+            int k;
+
+            mid[0] = arb_midref(acb_realref(x + j));
+            mid[1] = arb_midref(acb_imagref(x + j));
+            out[0] = re + j;
+            out[1] = im + j;
+
+            for (k = 0; k < 2; k++)
+            {
+                if (arf_is_special(mid[k]))
+                {
+                    fmpz_zero(out[k]);
+                }
+                else
+                {
+                    arf_get_fmpz_2exp(out[k], bot, mid[k]);
+
+                    fmpz_mul_ui(t, scale, j);
+                    fmpz_sub(t, bot, t);
+                    s = _fmpz_sub_small(t, exps + i);
+                    if (s < 0) flint_abort(); /* Bug catcher */
+                    fmpz_mul_2exp(out[k], out[k], s);
+                }
+            }
+        }
+    }
+
+    fmpz_clear(top);
+    fmpz_clear(bot);
+    fmpz_clear(t);
+    fmpz_clear(b);
+    fmpz_clear(v);
+    fmpz_clear(block_top);
+    fmpz_clear(block_bot);
+}
+
+/* Sets entries lo <= k < n of zre, zim to the coefficients of
+   (xre + i xim)(yre + i yim), using the 3-multiplication formula when
+   all four parts are nonzero. The vectors xs and ys must contain
+   xre + xim and yre + yim. Entries below lo are undefined. */
+static void
+_fmpzi_poly_mulmid(fmpz * zre, fmpz * zim, fmpz * tmp,
+    const fmpz * xre, const fmpz * xim, const fmpz * xs, slong xl,
+    const fmpz * yre, const fmpz * yim, const fmpz * ys, slong yl,
+    slong lo, slong n, int squaring)
+{
+    int xr0, xi0, yr0, yi0;
+
+    xr0 = _fmpz_vec_is_zero(xre, xl);
+    xi0 = _fmpz_vec_is_zero(xim, xl);
+    yr0 = squaring ? xr0 : _fmpz_vec_is_zero(yre, yl);
+    yi0 = squaring ? xi0 : _fmpz_vec_is_zero(yim, yl);
+
+    if (!xr0 && !xi0 && !yr0 && !yi0)
+    {
+        if (squaring)
+        {
+            _fmpz_poly_sqrlow(zre, xre, xl, n);
+            _fmpz_poly_sqrlow(tmp, xim, xl, n);
+            _fmpz_poly_sqrlow(zim, xs, xl, n);
+        }
+        else
+        {
+            _arb_poly_fmpz_mulmid(zre, xre, xl, yre, yl, lo, n);
+            _arb_poly_fmpz_mulmid(tmp, xim, xl, yim, yl, lo, n);
+            _arb_poly_fmpz_mulmid(zim, xs, xl, ys, yl, lo, n);
+        }
+
+        /* (ac - bd) + ((a+b)(c+d) - ac - bd) i */
+        _fmpz_vec_sub(zim + lo, zim + lo, zre + lo, n - lo);
+        _fmpz_vec_sub(zim + lo, zim + lo, tmp + lo, n - lo);
+        _fmpz_vec_sub(zre + lo, zre + lo, tmp + lo, n - lo);
+    }
+    else
+    {
+        _fmpz_vec_zero(zre + lo, n - lo);
+        _fmpz_vec_zero(zim + lo, n - lo);
+
+        if (!xr0 && !yr0)
+        {
+            _arb_poly_fmpz_mulmid(tmp, xre, xl, yre, yl, lo, n);
+            _fmpz_vec_add(zre + lo, zre + lo, tmp + lo, n - lo);
+        }
+
+        if (!xi0 && !yi0)
+        {
+            _arb_poly_fmpz_mulmid(tmp, xim, xl, yim, yl, lo, n);
+            _fmpz_vec_sub(zre + lo, zre + lo, tmp + lo, n - lo);
+        }
+
+        if (!xr0 && !yi0)
+        {
+            _arb_poly_fmpz_mulmid(tmp, xre, xl, yim, yl, lo, n);
+            _fmpz_vec_add(zim + lo, zim + lo, tmp + lo, n - lo);
+        }
+
+        if (!xi0 && !yr0)
+        {
+            _arb_poly_fmpz_mulmid(tmp, xim, xl, yre, yl, lo, n);
+            _fmpz_vec_add(zim + lo, zim + lo, tmp + lo, n - lo);
+        }
+    }
+}
+
+static void
+_acb_poly_addmulmid_block(acb_ptr z, fmpz * zre, fmpz * zim, fmpz * tmp,
+    const fmpz * xre, const fmpz * xim, const fmpz * xs, const fmpz * xexps,
+    const slong * xblocks, slong xlen,
+    const fmpz * yre, const fmpz * yim, const fmpz * ys, const fmpz * yexps,
+    const slong * yblocks, slong ylen,
+    slong lo, slong n, slong prec, int squaring)
+{
+    slong i, j, k, xp, yp, xl, yl, bn, klo;
+    fmpz_t zexp;
+
+    fmpz_init(zexp);
+
+    if (squaring)
+    {
+        for (i = 0; (xp = xblocks[i]) != xlen; i++)
+        {
+            if (2 * xp >= n)
+                continue;
+
+            xl = xblocks[i + 1] - xp;
+            bn = FLINT_MIN(2 * xl - 1, n - 2 * xp);
+            xl = FLINT_MIN(xl, bn);
+
+            klo = FLINT_MAX(0, lo - 2 * xp);
+            if (klo >= bn)
+                continue;
+
+            _fmpzi_poly_mulmid(zre, zim, tmp, xre + xp, xim + xp, xs + xp, xl,
+                xre + xp, xim + xp, xs + xp, xl, klo, bn, 1);
+            _fmpz_add2_fast(zexp, xexps + i, xexps + i, 0);
+
+            for (k = klo; k < bn; k++)
+            {
+                arb_add_fmpz_2exp(acb_realref(z + 2 * xp + k - lo),
+                    acb_realref(z + 2 * xp + k - lo), zre + k, zexp, prec);
+                arb_add_fmpz_2exp(acb_imagref(z + 2 * xp + k - lo),
+                    acb_imagref(z + 2 * xp + k - lo), zim + k, zexp, prec);
+            }
+        }
+    }
+
+    for (i = 0; (xp = xblocks[i]) != xlen; i++)
+    {
+        for (j = squaring ? i + 1 : 0; (yp = yblocks[j]) != ylen; j++)
+        {
+            if (xp + yp >= n)
+                continue;
+
+            xl = xblocks[i + 1] - xp;
+            yl = yblocks[j + 1] - yp;
+            bn = FLINT_MIN(xl + yl - 1, n - xp - yp);
+            xl = FLINT_MIN(xl, bn);
+            yl = FLINT_MIN(yl, bn);
+
+            klo = FLINT_MAX(0, lo - xp - yp);
+            if (klo >= bn)
+                continue;
+
+            _fmpzi_poly_mulmid(zre, zim, tmp, xre + xp, xim + xp, xs + xp, xl,
+                yre + yp, yim + yp, ys + yp, yl, klo, bn, 0);
+            _fmpz_add2_fast(zexp, xexps + i, yexps + j, squaring);
+
+            for (k = klo; k < bn; k++)
+            {
+                arb_add_fmpz_2exp(acb_realref(z + xp + yp + k - lo),
+                    acb_realref(z + xp + yp + k - lo), zre + k, zexp, prec);
+                arb_add_fmpz_2exp(acb_imagref(z + xp + yp + k - lo),
+                    acb_imagref(z + xp + yp + k - lo), zim + k, zexp, prec);
+            }
+        }
+    }
+
+    fmpz_clear(zexp);
+}
+
+static slong
+_mag_vec_nonzero_length(mag_srcptr x, slong len)
+{
+    while (len > 0 && mag_is_zero(x + len - 1))
+        len--;
+    return len;
+}
+
+void
+_acb_poly_mulmid_block(acb_ptr z, acb_srcptr x, slong xlen,
+    acb_srcptr y, slong ylen, slong lo, slong n, slong prec)
+{
+    slong xmlen, xrlen, ymlen, yrlen, i;
+    fmpz *xre, *xim, *xs, *yre, *yim, *ys, *zre, *zim, *tmp;
+    fmpz *xe, *ye;
+    slong *xblocks, *yblocks;
+    int squaring;
+    fmpz_t scale, t;
+
+    xlen = FLINT_MIN(xlen, n);
+    ylen = FLINT_MIN(ylen, n);
+
+    squaring = (x == y) && (xlen == ylen);
+
+    /* We don't know how to deal with infinities or NaNs */
+    if (!_acb_vec_is_finite(x, xlen) ||
+        (!squaring && !_acb_vec_is_finite(y, ylen)))
+    {
+        _acb_poly_mulmid_classical(z, x, xlen, y, ylen, lo, n, prec);
+        return;
+    }
+
+    /* Strip trailing zeros */
+    xmlen = xrlen = xlen;
+    while (xmlen > 0 && _acb_mid_is_special(x + xmlen - 1)) xmlen--;
+    while (xrlen > 0 && mag_is_zero(arb_radref(acb_realref(x + xrlen - 1)))
+        && mag_is_zero(arb_radref(acb_imagref(x + xrlen - 1)))) xrlen--;
+
+    if (squaring)
+    {
+        ymlen = xmlen;
+        yrlen = xrlen;
+    }
+    else
+    {
+        ymlen = yrlen = ylen;
+        while (ymlen > 0 && _acb_mid_is_special(y + ymlen - 1)) ymlen--;
+        while (yrlen > 0 && mag_is_zero(arb_radref(acb_realref(y + yrlen - 1)))
+            && mag_is_zero(arb_radref(acb_imagref(y + yrlen - 1)))) yrlen--;
+    }
+
+    xlen = FLINT_MAX(xmlen, xrlen);
+    ylen = FLINT_MAX(ymlen, yrlen);
+
+    /* Start with the zero polynomial */
+    _acb_vec_zero(z, n - lo);
+
+    /* Nothing to do */
+    if (xlen == 0 || ylen == 0 || xlen + ylen - 1 <= lo)
+        return;
+
+    n = FLINT_MIN(n, xlen + ylen - 1);
+
+    fmpz_init(scale);
+    fmpz_init(t);
+
+    _acb_poly_get_scale(scale, x, xlen, y, ylen);
+
+    /* Error propagation. With |x| = |Re(x)| + |Im(x)| for the midpoints
+       and radii, both parts of the product have radius bounded by
+       |xm| yr + xr (|ym| + yr), so we need only two real products. */
+    if (xrlen != 0 || yrlen != 0)
+    {
+        mag_ptr xm, xr, ym, yr;
+        arb_ptr zr;
+        fmpz *xz, *yz, *zz;
+        double *xdbl, *ydbl;
+        slong alen, blen;
+
+        xm = _mag_vec_init(xlen);
+        xr = _mag_vec_init(xlen);
+        ym = _mag_vec_init(ylen);
+        yr = _mag_vec_init(ylen);
+        zr = _arb_vec_init(n - lo);
+        xz = _fmpz_vec_init(xlen);
+        yz = _fmpz_vec_init(ylen);
+        zz = _fmpz_vec_init(n);
+        xe = _fmpz_vec_init(xlen);
+        ye = _fmpz_vec_init(ylen);
+        xblocks = flint_malloc(sizeof(slong) * (xlen + 1));
+        yblocks = flint_malloc(sizeof(slong) * (ylen + 1));
+        xdbl = flint_malloc(sizeof(double) * xlen);
+        ydbl = flint_malloc(sizeof(double) * ylen);
+
+        for (i = 0; i < xlen; i++)
+        {
+            arf_get_mag(xm + i, arb_midref(acb_realref(x + i)));
+            arf_get_mag(xr + i, arb_midref(acb_imagref(x + i)));
+            mag_add(xm + i, xm + i, xr + i);
+            mag_add(xr + i, arb_radref(acb_realref(x + i)),
+                            arb_radref(acb_imagref(x + i)));
+        }
+
+        /* ym holds |ym| + yr */
+        for (i = 0; i < ylen; i++)
+        {
+            arf_get_mag(ym + i, arb_midref(acb_realref(y + i)));
+            arf_get_mag(yr + i, arb_midref(acb_imagref(y + i)));
+            mag_add(ym + i, ym + i, yr + i);
+            mag_add(yr + i, arb_radref(acb_realref(y + i)),
+                            arb_radref(acb_imagref(y + i)));
+            mag_add(ym + i, ym + i, yr + i);
+        }
+
+        /* |xm| * yr */
+        alen = _mag_vec_nonzero_length(xm, xlen);
+        blen = _mag_vec_nonzero_length(yr, ylen);
+        if (alen != 0 && blen != 0)
+        {
+            _mag_vec_get_fmpz_2exp_blocks(xz, xdbl, xe, xblocks, scale, NULL, xm, alen);
+            _mag_vec_get_fmpz_2exp_blocks(yz, ydbl, ye, yblocks, scale, NULL, yr, blen);
+            _arb_poly_addmulmid_rad(zr, zz, xz, xdbl, xe, xblocks, alen, yz, ydbl, ye, yblocks, blen, lo, n);
+        }
+
+        /* xr * (|ym| + yr) */
+        alen = _mag_vec_nonzero_length(xr, xlen);
+        blen = _mag_vec_nonzero_length(ym, ylen);
+        if (alen != 0 && blen != 0)
+        {
+            _mag_vec_get_fmpz_2exp_blocks(xz, xdbl, xe, xblocks, scale, NULL, xr, alen);
+            _mag_vec_get_fmpz_2exp_blocks(yz, ydbl, ye, yblocks, scale, NULL, ym, blen);
+            _arb_poly_addmulmid_rad(zr, zz, xz, xdbl, xe, xblocks, alen, yz, ydbl, ye, yblocks, blen, lo, n);
+        }
+
+        for (i = 0; i < n - lo; i++)
+        {
+            mag_set(arb_radref(acb_realref(z + i)), arb_radref(zr + i));
+            mag_set(arb_radref(acb_imagref(z + i)), arb_radref(zr + i));
+        }
+
+        _mag_vec_clear(xm, xlen);
+        _mag_vec_clear(xr, xlen);
+        _mag_vec_clear(ym, ylen);
+        _mag_vec_clear(yr, ylen);
+        _arb_vec_clear(zr, n - lo);
+        _fmpz_vec_clear(xz, xlen);
+        _fmpz_vec_clear(yz, ylen);
+        _fmpz_vec_clear(zz, n);
+        _fmpz_vec_clear(xe, xlen);
+        _fmpz_vec_clear(ye, ylen);
+        flint_free(xblocks);
+        flint_free(yblocks);
+        flint_free(xdbl);
+        flint_free(ydbl);
+    }
+
+    /* multiply midpoints */
+    if (xmlen != 0 && ymlen != 0)
+    {
+        xre = _fmpz_vec_init(xmlen);
+        xim = _fmpz_vec_init(xmlen);
+        xs = _fmpz_vec_init(xmlen);
+        xe = _fmpz_vec_init(xmlen);
+        xblocks = flint_malloc(sizeof(slong) * (xmlen + 1));
+        zre = _fmpz_vec_init(n);
+        zim = _fmpz_vec_init(n);
+        tmp = _fmpz_vec_init(n);
+
+        _acb_vec_get_fmpz_2exp_blocks(xre, xim, xe, xblocks, scale, x, xmlen, prec);
+        _fmpz_vec_add(xs, xre, xim, xmlen);
+
+        if (squaring)
+        {
+            _acb_poly_addmulmid_block(z, zre, zim, tmp,
+                xre, xim, xs, xe, xblocks, xmlen,
+                xre, xim, xs, xe, xblocks, xmlen, lo, n, prec, 1);
+        }
+        else
+        {
+            yre = _fmpz_vec_init(ymlen);
+            yim = _fmpz_vec_init(ymlen);
+            ys = _fmpz_vec_init(ymlen);
+            ye = _fmpz_vec_init(ymlen);
+            yblocks = flint_malloc(sizeof(slong) * (ymlen + 1));
+
+            _acb_vec_get_fmpz_2exp_blocks(yre, yim, ye, yblocks, scale, y, ymlen, prec);
+            _fmpz_vec_add(ys, yre, yim, ymlen);
+
+            _acb_poly_addmulmid_block(z, zre, zim, tmp,
+                xre, xim, xs, xe, xblocks, xmlen,
+                yre, yim, ys, ye, yblocks, ymlen, lo, n, prec, 0);
+
+            _fmpz_vec_clear(yre, ymlen);
+            _fmpz_vec_clear(yim, ymlen);
+            _fmpz_vec_clear(ys, ymlen);
+            _fmpz_vec_clear(ye, ymlen);
+            flint_free(yblocks);
+        }
+
+        _fmpz_vec_clear(xre, xmlen);
+        _fmpz_vec_clear(xim, xmlen);
+        _fmpz_vec_clear(xs, xmlen);
+        _fmpz_vec_clear(xe, xmlen);
+        flint_free(xblocks);
+        _fmpz_vec_clear(zre, n);
+        _fmpz_vec_clear(zim, n);
+        _fmpz_vec_clear(tmp, n);
+    }
+
+    /* Unscale. */
+    if (!fmpz_is_zero(scale))
+    {
+        fmpz_mul_si(t, scale, lo);
+        for (i = 0; i < n - lo; i++)
+        {
+            acb_mul_2exp_fmpz(z + i, z + i, t);
+            fmpz_add(t, t, scale);
+        }
+    }
+
+    fmpz_clear(scale);
+    fmpz_clear(t);
+}
+
+void
+_acb_poly_mullow_block(acb_ptr z, acb_srcptr x, slong xlen,
+                                acb_srcptr y, slong ylen, slong n, slong prec)
+{
+    _acb_poly_mulmid_block(z, x, xlen, y, ylen, 0, n, prec);
+}
+
+void
+acb_poly_mullow_block(acb_poly_t res, const acb_poly_t poly1,
+              const acb_poly_t poly2, slong n, slong prec)
+{
+    slong xlen, ylen, zlen;
+
+    xlen = poly1->length;
+    ylen = poly2->length;
+
+    if (xlen == 0 || ylen == 0 || n == 0)
+    {
+        acb_poly_zero(res);
+        return;
+    }
+
+    xlen = FLINT_MIN(xlen, n);
+    ylen = FLINT_MIN(ylen, n);
+    zlen = FLINT_MIN(xlen + ylen - 1, n);
+
+    if (res == poly1 || res == poly2)
+    {
+        acb_poly_t tmp;
+        acb_poly_init2(tmp, zlen);
+        _acb_poly_mullow_block(tmp->coeffs, poly1->coeffs, xlen,
+            poly2->coeffs, ylen, zlen, prec);
+        acb_poly_swap(res, tmp);
+        acb_poly_clear(tmp);
+    }
+    else
+    {
+        acb_poly_fit_length(res, zlen);
+        _acb_poly_mullow_block(res->coeffs, poly1->coeffs, xlen,
+            poly2->coeffs, ylen, zlen, prec);
+    }
+
+    _acb_poly_set_length(res, zlen);
+    _acb_poly_normalise(res);
+}
+
+void
+acb_poly_mulmid_block(acb_poly_t res, const acb_poly_t poly1,
+    const acb_poly_t poly2, slong lo, slong hi, slong prec)
+{
+    slong len;
+
+    hi = FLINT_MIN(hi, poly1->length + poly2->length - 1);
+
+    if (poly1->length == 0 || poly2->length == 0 || hi <= lo)
+    {
+        acb_poly_zero(res);
+        return;
+    }
+
+    len = hi - lo;
+
+    if (res == poly1 || res == poly2)
+    {
+        acb_poly_t tmp;
+        acb_poly_init2(tmp, len);
+        _acb_poly_mulmid_block(tmp->coeffs, poly1->coeffs, poly1->length,
+            poly2->coeffs, poly2->length, lo, hi, prec);
+        acb_poly_swap(res, tmp);
+        acb_poly_clear(tmp);
+    }
+    else
+    {
+        acb_poly_fit_length(res, len);
+        _acb_poly_mulmid_block(res->coeffs, poly1->coeffs, poly1->length,
+            poly2->coeffs, poly2->length, lo, hi, prec);
+    }
+
+    _acb_poly_set_length(res, len);
+    _acb_poly_normalise(res);
+}
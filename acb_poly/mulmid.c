@@ -0,0 +1,98 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_poly.h"
+
+void
+_acb_poly_mulmid(acb_ptr res,
+    acb_srcptr poly1, slong len1,
+    acb_srcptr poly2, slong len2, slong lo, slong hi, slong prec)
+{
+    len1 = FLINT_MIN(len1, hi);
+    len2 = FLINT_MIN(len2, hi);
+
+    if (lo == 0)
+    {
+        if (len1 >= len2)
+            _acb_poly_mullow(res, poly1, len1, poly2, len2, hi, prec);
+        else
+            _acb_poly_mullow(res, poly2, len2, poly1, len1, hi, prec);
+    }
+    else if (hi - lo <= 7 || len1 <= 7 || len2 <= 7)
+    {
+        _acb_poly_mulmid_classical(res, poly1, len1, poly2, len2, lo, hi, prec);
+    }
+    else
+    {
+        slong cutoff;
+        double p;
+
+        if (prec <= 2 * FLINT_BITS)
+        {
+            cutoff = 110;
+        }
+        else
+        {
+            p = log(prec);
+
+            cutoff = 10000.0 / (p * p * p);
+            cutoff = FLINT_MIN(cutoff, 60);
+            if (poly1 == poly2 && prec >= 256)
+                cutoff *= 1.25;
+            if (poly1 == poly2 && prec >= 4096)
+                cutoff *= 1.25;
+            cutoff = FLINT_MAX(cutoff, 8);
+        }
+
+        if (2 * FLINT_MIN(len1, len2) <= cutoff || hi - lo <= cutoff)
+            _acb_poly_mulmid_classical(res, poly1, len1, poly2, len2, lo, hi, prec);
+        else
+            _acb_poly_mulmid_block(res, poly1, len1, poly2, len2, lo, hi, prec);
+    }
+}
+
+void
+acb_poly_mulmid(acb_poly_t res, const acb_poly_t poly1,
+    const acb_poly_t poly2, slong lo, slong hi, slong prec)
+{
+    slong len1, len2, len;
+
+    len1 = poly1->length;
+    len2 = poly2->length;
+    hi = FLINT_MIN(hi, len1 + len2 - 1);
+
+    if (len1 == 0 || len2 == 0 || hi <= lo)
+    {
+        acb_poly_zero(res);
+        return;
+    }
+
+    len = hi - lo;
+
+    if (res == poly1 || res == poly2)
+    {
+        acb_poly_t t;
+        acb_poly_init2(t, len);
+        _acb_poly_mulmid(t->coeffs, poly1->coeffs, len1,
+            poly2->coeffs, len2, lo, hi, prec);
+        acb_poly_swap(res, t);
+        acb_poly_clear(t);
+    }
+    else
+    {
+        acb_poly_fit_length(res, len);
+        _acb_poly_mulmid(res->coeffs, poly1->coeffs, len1,
+            poly2->coeffs, len2, lo, hi, prec);
+    }
+
+    _acb_poly_set_length(res, len);
+    _acb_poly_normalise(res);
+}
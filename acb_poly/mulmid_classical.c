@@ -0,0 +1,68 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_poly.h"
+
+void
+_acb_poly_mulmid_classical(acb_ptr res,
+    acb_srcptr poly1, slong len1,
+    acb_srcptr poly2, slong len2, slong lo, slong hi, slong prec)
+{
+    slong k, start, stop;
+
+    for (k = lo; k < hi; k++)
+    {
+        start = FLINT_MAX(0, k - len2 + 1);
+        stop = FLINT_MIN(len1 - 1, k);
+
+        if (start > stop)
+            acb_zero(res + k - lo);
+        else
+            acb_dot(res + k - lo, NULL, 0, poly1 + start, 1,
+                poly2 + k - start, -1, stop - start + 1, prec);
+    }
+}
+
+void
+acb_poly_mulmid_classical(acb_poly_t res, const acb_poly_t poly1,
+    const acb_poly_t poly2, slong lo, slong hi, slong prec)
+{
+    slong len;
+
+    hi = FLINT_MIN(hi, poly1->length + poly2->length - 1);
+
+    if (poly1->length == 0 || poly2->length == 0 || hi <= lo)
+    {
+        acb_poly_zero(res);
+        return;
+    }
+
+    len = hi - lo;
+
+    if (res == poly1 || res == poly2)
+    {
+        acb_poly_t t;
+        acb_poly_init2(t, len);
+        _acb_poly_mulmid_classical(t->coeffs, poly1->coeffs, poly1->length,
+            poly2->coeffs, poly2->length, lo, hi, prec);
+        acb_poly_swap(res, t);
+        acb_poly_clear(t);
+    }
+    else
+    {
+        acb_poly_fit_length(res, len);
+        _acb_poly_mulmid_classical(res->coeffs, poly1->coeffs, poly1->length,
+            poly2->coeffs, poly2->length, lo, hi, prec);
+    }
+
+    _acb_poly_set_length(res, len);
+    _acb_poly_normalise(res);
+}
@@ -56,7 +56,7 @@ _acb_poly_rsqrt_series(acb_ptr g,
         tlen = FLINT_MIN(2 * m - 1, n);
         _acb_poly_mullow(t, g, m, g, m, tlen, prec);
         _acb_poly_mullow(u, g, m, t, tlen, n, prec);
-        _acb_poly_mullow(t, u, n, h, hlen, n, prec);
+        _acb_poly_mulmid(t + m, u, n, h, hlen, m, n, prec);
         _acb_vec_scalar_mul_2exp_si(g + m, t + m, n - m, -1);
         _acb_vec_neg(g + m, g + m, n - m);
         NEWTON_END_LOOP
@@ -0,0 +1,137 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_poly.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("tree....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        slong i, n, qbits1, qbits2, rbits1, rbits2, rbits3;
+        fmpq_poly_t P;
+        acb_poly_t R, S;
+        acb_poly_tree_t T;
+        fmpq_t t, u;
+        acb_ptr xs, ys, zs, vs;
+
+        fmpq_poly_init(P);
+        acb_poly_init(R);
+        acb_poly_init(S);
+        fmpq_init(t);
+        fmpq_init(u);
+
+        qbits1 = 2 + n_randint(state, 100);
+        qbits2 = 2 + n_randint(state, 5);
+        rbits1 = 2 + n_randint(state, 200);
+        rbits2 = 2 + n_randint(state, 200);
+        rbits3 = 2 + n_randint(state, 200);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        fmpq_poly_randtest(P, state, 1 + n_randint(state, 150), qbits1);
+        n = P->length;
+
+        xs = _acb_vec_init(n);
+        ys = _acb_vec_init(n);
+        zs = _acb_vec_init(n);
+        vs = _acb_vec_init(n);
+
+        acb_poly_set_fmpq_poly(R, P, rbits1);
+
+        if (n > 0)
+        {
+            fmpq_randtest(t, state, qbits2);
+            acb_set_fmpq(xs, t, rbits2);
+
+            for (i = 1; i < n; i++)
+            {
+                fmpq_randtest_not_zero(u, state, qbits2);
+                fmpq_abs(u, u);
+                fmpq_add(t, t, u);
+                acb_set_fmpq(xs + i, t, rbits2);
+            }
+        }
+
+        acb_poly_tree_init(T, xs, n, rbits2);
+
+        /* evaluation */
+        acb_poly_evaluate_vec_tree(ys, R, T, rbits2);
+        acb_poly_evaluate_vec_iter(zs, R, xs, n, rbits2);
+
+        for (i = 0; i < n; i++)
+        {
+            if (!acb_overlaps(ys + i, zs + i))
+            {
+                flint_printf("FAIL (evaluation):\n");
+                flint_printf("n = %wd, i = %wd\n\n", n, i);
+                flint_printf("R = "); acb_poly_printd(R, 15); flint_printf("\n\n");
+                flint_printf("y = "); acb_printd(ys + i, 15); flint_printf("\n\n");
+                flint_printf("z = "); acb_printd(zs + i, 15); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        /* the result must not depend on the number of threads */
+        flint_set_num_threads(1);
+        acb_poly_evaluate_vec_tree(vs, R, T, rbits2);
+
+        for (i = 0; i < n; i++)
+        {
+            if (!acb_equal(vs + i, ys + i))
+            {
+                flint_printf("FAIL (threads):\n");
+                flint_printf("n = %wd, i = %wd\n\n", n, i);
+                flint_abort();
+            }
+        }
+
+        /* interpolation, reusing the tree */
+        for (i = 0; i < n; i++)
+            acb_poly_evaluate(ys + i, R, xs + i, rbits2);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+        acb_poly_interpolate_tree(S, ys, T, rbits3);
+
+        if (!acb_poly_contains_fmpq_poly(S, P))
+        {
+            flint_printf("FAIL (interpolation):\n");
+            flint_printf("P = "); fmpq_poly_print(P); flint_printf("\n\n");
+            flint_printf("R = "); acb_poly_printd(R, 15); flint_printf("\n\n");
+            flint_printf("S = "); acb_poly_printd(S, 15); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        acb_poly_tree_clear(T);
+
+        fmpq_poly_clear(P);
+        acb_poly_clear(R);
+        acb_poly_clear(S);
+        fmpq_clear(t);
+        fmpq_clear(u);
+        _acb_vec_clear(xs, n);
+        _acb_vec_clear(ys, n);
+        _acb_vec_clear(zs, n);
+        _acb_vec_clear(vs, n);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "acb_poly.h"
 
 acb_ptr * _acb_poly_tree_alloc(slong len)
@@ -40,11 +41,48 @@ void _acb_poly_tree_free(acb_ptr * tree, slong len)
     }
 }
 
+/* Multiplies the k-th pair of polynomials on level i into level i + 1. */
+static void
+_acb_poly_tree_build_pair(acb_ptr * tree, slong len, slong i, slong k, slong prec)
+{
+    slong pow, left;
+    acb_ptr pa, pb;
+
+    pow = WORD(1) << i;
+    left = len - 2 * pow * k;
+    pa = tree[i] + (2 * pow + 2) * k;
+    pb = tree[i + 1] + (2 * pow + 1) * k;
+
+    if (left >= 2 * pow)
+        _acb_poly_mul_monic(pb, pa, pow + 1, pa + pow + 1, pow + 1, prec);
+    else if (left > pow)
+        _acb_poly_mul_monic(pb, pa, pow + 1, pa + pow + 1, left - pow + 1, prec);
+    else if (left > 0)
+        _acb_vec_set(pb, pa, left + 1);
+}
+
+typedef struct
+{
+    acb_ptr * tree;
+    slong len;
+    slong level;
+    slong prec;
+}
+tree_work_t;
+
+static void
+tree_worker(slong k, void * _work)
+{
+    tree_work_t * work = (tree_work_t *) _work;
+
+    _acb_poly_tree_build_pair(work->tree, work->len, work->level, k, work->prec);
+}
+
 void
 _acb_poly_tree_build(acb_ptr * tree, acb_srcptr roots, slong len, slong prec)
 {
-    slong height, pow, left, i;
-    acb_ptr pa, pb;
+    slong height, pow, num, i, k;
+    acb_ptr pa;
     acb_srcptr a, b;
 
     if (len == 0)
@@ -82,26 +120,47 @@ _acb_poly_tree_build(acb_ptr * tree, acb_srcptr roots, slong len, slong prec)
         }
     }
 
+    /* The products on each level are independent. */
     for (i = 1; i < height - 1; i++)
     {
-        left = len;
         pow = WORD(1) << i;
-        pa = tree[i];
-        pb = tree[i + 1];
+        num = (len + 2 * pow - 1) / (2 * pow);
 
-        while (left >= 2 * pow)
+        if (num >= 2 && len >= ACB_POLY_TREE_THREAD_CUTOFF &&
+            flint_get_num_threads() > 1)
         {
-            _acb_poly_mul_monic(pb, pa, pow + 1, pa + pow + 1, pow + 1, prec);
-            left -= 2 * pow;
-            pa += 2 * pow + 2;
-            pb += 2 * pow + 1;
-        }
+            tree_work_t work;
+
+            work.tree = tree;
+            work.len = len;
+            work.level = i;
+            work.prec = prec;
 
-        if (left > pow)
+            flint_parallel_do((do_func_t) tree_worker, &work, num, -1, FLINT_PARALLEL_STRIDED);
+        }
+        else
         {
-            _acb_poly_mul_monic(pb, pa, pow + 1, pa + pow + 1, left - pow + 1, prec);
+            for (k = 0; k < num; k++)
+                _acb_poly_tree_build_pair(tree, len, i, k, prec);
         }
-        else if (left > 0)
-            _acb_vec_set(pb, pa, left + 1);
     }
 }
+
+void
+acb_poly_tree_init(acb_poly_tree_t T, acb_srcptr xs, slong len, slong prec)
+{
+    T->tree = _acb_poly_tree_alloc(len);
+    _acb_poly_tree_build(T->tree, xs, len, prec);
+    T->weights = NULL;
+    T->len = len;
+    T->prec = prec;
+}
+
+void
+acb_poly_tree_clear(acb_poly_tree_t T)
+{
+    _acb_poly_tree_free(T->tree, T->len);
+
+    if (T->weights != NULL)
+        _acb_vec_clear(T->weights, T->len);
+}
@@ -442,6 +442,13 @@ void arb_dot(arb_t res, const arb_t initial, int subtract,
 void arb_approx_dot(arb_t res, const arb_t initial, int subtract,
     arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len, slong prec);
 
+#define ARB_DOT_THREAD_CHUNK 4096
+
+void arb_dot_threaded(arb_t res, const arb_t initial, int subtract,
+    arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len, slong prec);
+void arb_approx_dot_threaded(arb_t res, const arb_t initial, int subtract,
+    arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len, slong prec);
+
 void arb_dot_ui(arb_t res, const arb_t initial, int subtract,
     arb_srcptr x, slong xstep, const ulong * y, slong ystep, slong len, slong prec);
 void arb_dot_si(arb_t res, const arb_t initial, int subtract,
@@ -817,6 +824,26 @@ _arb_vec_bits(arb_srcptr x, slong len)
 
 void _arb_vec_set_powers(arb_ptr xs, const arb_t x, slong len, slong prec);
 
+/* The vector functions below split the work across threads only when
+   the scalar functions do not themselves depend on the number of
+   threads, so that the output is identical to that of the scalar
+   functions. */
+#define ARB_VEC_THREAD_MIN_LEN 16
+#define ARB_VEC_THREAD_MAX_PREC 10000
+
+void _arb_vec_exp(arb_ptr res, arb_srcptr x, slong len, slong prec);
+
+void _arb_vec_log(arb_ptr res, arb_srcptr x, slong len, slong prec);
+
+void _arb_vec_sin_cos(arb_ptr s, arb_ptr c, arb_srcptr x, slong len, slong prec);
+
+typedef void (*arb_get_d_func_t)(arb_t res, slong i, void * param, slong prec);
+
+int arb_get_d_rounded(double * res, const arb_t x);
+
+int _arb_vec_get_d_rounded(double * res, arb_srcptr vec, slong len,
+    arb_get_d_func_t func, void * param, slong prec, slong maxprec);
+
 ARB_INLINE void
 _arb_vec_add_error_arf_vec(arb_ptr res, arf_srcptr err, slong len)
 {
@@ -859,6 +886,53 @@ _arb_vec_get_unique_fmpz_vec(fmpz * res,  arb_srcptr vec, slong len)
     return 1;
 }
 
+/* runtime tuning parameters */
+
+#define ARB_TUNE_EXP_LOG_REDUCTION_PREC 0
+#define ARB_TUNE_LOG_NEWTON_PREC 1
+#define ARB_TUNE_ATAN_NEWTON_PREC 2
+#define ARB_TUNE_SIN_COS_ATAN_REDUCTION_PREC 3
+#define ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA 4
+#define ARB_TUNE_POLY_MULLOW_BLOCK_BETA 5
+#define ARB_TUNE_EXP_SUM_BS_THREADS_2 6
+#define ARB_TUNE_EXP_SUM_BS_THREADS_4 7
+#define ARB_TUNE_EXP_SUM_BS_THREADS_8 8
+#define ARB_TUNE_MAT_MUL_BLOCK_CUTOFF_1 9
+#define ARB_TUNE_MAT_MUL_BLOCK_CUTOFF_2 10
+#define ARB_TUNE_MAT_MUL_BLOCK_CUTOFF_3 11
+#define ARB_TUNE_MAT_MUL_THREAD_MIN 12
+#define ARB_TUNE_DFT_BLUESTEIN_MIN_LEN 13
+#define ARB_TUNE_DFT_BLUESTEIN_ADDSEQ_MIN_LEN 14
+#define ARB_TUNE_DFT_CONVOL_DFT_CUTOFF 15
+#define ARB_TUNE_POLY_MULLOW_FFT_MIN_LEN 16
+#define ARB_TUNE_POLY_MULLOW_FFT_MAX_PREC 17
+#define ARB_TUNE_POLY_MULMID_NTT_MIN_LEN 18
+#define ARB_TUNE_NUM 19
+
+ARB_DLL extern slong arb_tune_tab[ARB_TUNE_NUM];
+
+ARB_INLINE slong
+arb_tune_get(slong i)
+{
+    return arb_tune_tab[i];
+}
+
+int arb_tune_set(slong i, slong value);
+
+slong arb_tune_default(slong i);
+
+const char * arb_tune_name(slong i);
+
+slong arb_tune_lookup(const char * name);
+
+void arb_tune_reset(void);
+
+int arb_tune_load(const char * filename);
+
+void arb_tune_load_env(void);
+
+int arb_tune_save(const char * filename);
+
 /* arctangent implementation */
 
 #define ARB_ATAN_TAB1_BITS 8
@@ -882,7 +956,7 @@ _arb_atan_taylor_naive(mp_ptr y, mp_limb_t * error,
 void _arb_atan_taylor_rs(mp_ptr y, mp_limb_t * error,
     mp_srcptr x, mp_size_t xn, ulong N, int alternating);
 
-#define ARB_ATAN_NEWTON_PREC 3400
+#define ARB_ATAN_NEWTON_PREC (arb_tune_tab[ARB_TUNE_ATAN_NEWTON_PREC])
 
 void arb_atan_newton(arb_t res, const arb_t x, slong prec);
 void arb_atan_arf_newton(arb_t res, const arf_t x, slong prec);
@@ -959,10 +1033,11 @@ void _arb_exp_sum_bs_simple(fmpz_t T, fmpz_t Q, flint_bitcnt_t * Qexp,
     const fmpz_t x, flint_bitcnt_t r, slong N);
 
 #define ARB_LOG_REDUCTION_DEFAULT_MAX_PREC 4000000
-#define ARB_EXP_LOG_REDUCTION_PREC 2240
-#define ARB_LOG_NEWTON_PREC 2800
+#define ARB_EXP_LOG_REDUCTION_PREC (arb_tune_tab[ARB_TUNE_EXP_LOG_REDUCTION_PREC])
+#define ARB_LOG_NEWTON_PREC (arb_tune_tab[ARB_TUNE_LOG_NEWTON_PREC])
 
 void arb_exp_arf_log_reduction(arb_t res, const arf_t x, slong prec, int minus_one);
+void arb_exp_arf_log_reduction_vec(arb_ptr res, arf_srcptr x, slong len, slong prec, int minus_one);
 void arb_exp_arf_generic(arb_t z, const arf_t x, slong prec, int minus_one);
 void arb_exp_arf(arb_t z, const arf_t x, slong prec, int minus_one, slong maglim);
 
@@ -1014,7 +1089,7 @@ void arb_atan_gauss_primes_vec_bsplit(arb_ptr res, slong n, slong prec);
 #define ARB_ATAN_GAUSS_PRIME_CACHE_NUM 13
 
 #define ARB_SIN_COS_ATAN_REDUCTION_DEFAULT_MAX_PREC 4000000
-#define ARB_SIN_COS_ATAN_REDUCTION_PREC 2600
+#define ARB_SIN_COS_ATAN_REDUCTION_PREC (arb_tune_tab[ARB_TUNE_SIN_COS_ATAN_REDUCTION_PREC])
 
 ARB_DLL extern const mp_limb_t arb_atan_gauss_tab[ARB_ATAN_GAUSS_PRIME_CACHE_NUM][ARB_ATAN_TAB2_LIMBS];
 
@@ -1022,6 +1097,7 @@ void _arb_atan_gauss_p_ensure_cached(slong prec);
 arb_srcptr _arb_atan_gauss_p_cache_vec(void);
 
 void arb_sin_cos_arf_atan_reduction(arb_t res1, arb_t res2, const arf_t x, slong prec);
+void arb_sin_cos_arf_atan_reduction_vec(arb_ptr res1, arb_ptr res2, arf_srcptr x, slong len, slong prec);
 
 
 ARB_INLINE flint_bitcnt_t
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "arb.h"
 #include "flint/longlong.h"
 
@@ -61,175 +62,21 @@ arb_approx_dot_simple(arb_t res, const arb_t initial, int subtract,
         arf_neg(arb_midref(res), arb_midref(res));
 }
 
-void
-arb_approx_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len, slong prec)
+/* Adds the midpoint products x[i] y[i], 0 <= i < len, to the
+   fixed-point sum as in _arb_dot_sum_terms (see arb/dot.c). */
+static void
+_arb_approx_dot_sum_terms(mp_ptr sum, mp_ptr tmp, mp_size_t sn, slong sum_exp,
+    arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len)
 {
-    slong i, j, nonzero, padding, extend;
-    slong xexp, yexp, exp, max_exp, min_exp, sum_exp;
+    slong i, xexp, yexp, exp;
     int xnegative, ynegative;
-    mp_size_t xn, yn, sn, alloc;
+    mp_size_t xn, yn;
     flint_bitcnt_t shift;
     arb_srcptr xi, yi;
     arf_srcptr xm, ym;
     mp_limb_t serr;   /* Sum over arithmetic errors  - not used, but need dummy for calls */
-    mp_ptr tmp, sum;  /* Workspace */
-    ARF_ADD_TMP_DECL;
-
-    /* todo: fast fma and fmma (len=2) code */
-    if (len <= 1)
-    {
-        if (initial == NULL)
-        {
-            if (len <= 0)
-                arf_zero(arb_midref(res));
-            else
-            {
-                if (subtract)
-                    arf_neg_mul(arb_midref(res), arb_midref(x), arb_midref(y), prec, ARB_RND);
-                else
-                    arf_mul(arb_midref(res), arb_midref(x), arb_midref(y), prec, ARB_RND);
-            }
-            return;
-        }
-        else if (len <= 0)
-        {
-            arf_set_round(arb_midref(res), arb_midref(initial), prec, ARB_RND);
-            return;
-        }
-    }
-
-    /* Number of nonzero midpoint terms in sum. */
-    nonzero = 0;
-
-    /* Terms are bounded by 2^max_exp (with WORD_MIN = -infty) */
-    max_exp = WORD_MIN;
-
-    /* Used to reduce the precision. */
-    min_exp = WORD_MAX;
-
-    /* Account for the initial term. */
-    if (initial != NULL)
-    {
-        if (!ARF_IS_LAGOM(arb_midref(initial)))
-        {
-            arb_approx_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
-            return;
-        }
-
-        xm = arb_midref(initial);
-
-        if (!arf_is_special(xm))
-        {
-            max_exp = ARF_EXP(xm);
-            nonzero++;
 
-            if (prec > 2 * FLINT_BITS)
-                min_exp = ARF_EXP(xm) - ARF_SIZE(xm) * FLINT_BITS;
-        }
-    }
-
-    /* Determine maximum exponents for the main sum and the radius sum. */
-    for (i = 0; i < len; i++)
-    {
-        xi = x + i * xstep;
-        yi = y + i * ystep;
-
-        /* Fallback for huge exponents or non-finite values. */
-        if (!ARF_IS_LAGOM(arb_midref(xi)) || !ARF_IS_LAGOM(arb_midref(yi)))
-        {
-            arb_approx_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
-            return;
-        }
-
-        xm = arb_midref(xi);
-        ym = arb_midref(yi);
-
-        if (!arf_is_special(xm))
-        {
-            xexp = ARF_EXP(xm);
-
-            if (!arf_is_special(ym))
-            {
-                yexp = ARF_EXP(ym);
-
-                max_exp = FLINT_MAX(max_exp, xexp + yexp);
-                nonzero++;
-
-                if (prec > 2 * FLINT_BITS)
-                {
-                    slong bot;
-                    bot = (xexp + yexp) - (ARF_SIZE(xm) + ARF_SIZE(ym)) * FLINT_BITS;
-                    min_exp = FLINT_MIN(min_exp, bot);
-                }
-            }
-        }
-    }
-
-    /* The midpoint sum is zero. */
-    if (max_exp == WORD_MIN)
-    {
-        arf_zero(arb_midref(res));
-        return;
-    }
-    else
-    {
-        /* Reduce precision based on actual sizes. */
-        if (min_exp != WORD_MAX)
-            prec = FLINT_MIN(prec, max_exp - min_exp + MAG_BITS);
-
-        prec = FLINT_MAX(prec, 2);
-    }
-
-    /* Extend sum so that we can use two's complement addition. */
-    extend = FLINT_BIT_COUNT(nonzero) + 1;
-
-    /* Extra bits to improve accuracy (optional). */
-    padding = 4 + FLINT_BIT_COUNT(len);
-
-    /* Number of limbs. */
-    sn = (prec + extend + padding + FLINT_BITS - 1) / FLINT_BITS;
-
-    /* Avoid having to make a special case for sn = 1. */
-    sn = FLINT_MAX(sn, 2);
-
-    /* Exponent for the main sum. */
-    sum_exp = max_exp + extend;
-
-    /* We need sn + 1 limb for the sum (sn limbs + 1 dummy limb
-       for carry or borrow that avoids an extra branch). We need
-       2 * (sn + 2) limbs to store the product of two numbers
-       with up to (sn + 2) limbs, plus 1 extra limb for shifting
-       the product. */
-    alloc = (sn + 1) + 2 * (sn + 2) + 1;
-    ARF_ADD_TMP_ALLOC(sum, alloc)
-    tmp = sum + (sn + 1);
-
-    /* Set sum to 0 */
     serr = 0;
-    for (j = 0; j < sn + 1; j++)
-        sum[j] = 0;
-
-    if (initial != NULL)
-    {
-        xm = arb_midref(initial);
-
-        if (!arf_is_special(xm))
-        {
-            mp_srcptr xptr;
-
-            xexp = ARF_EXP(xm);
-            xn = ARF_SIZE(xm);
-            xnegative = ARF_SGNBIT(xm);
-
-            shift = sum_exp - xexp;
-
-            if (shift < sn * FLINT_BITS)
-            {
-                xptr = (xn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(xm) : ARF_PTR_D(xm);
-                _arb_dot_add_generic(sum, &serr, tmp, sn, xptr, xn, xnegative ^ subtract, shift);
-            }
-        }
-    }
 
     for (i = 0; i < len; i++)
     {
@@ -416,6 +263,249 @@ arb_approx_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong
             }
         }
     }
+}
+
+typedef struct
+{
+    mp_ptr sums;
+    mp_size_t sn;
+    slong sum_exp;
+    arb_srcptr x;
+    slong xstep;
+    arb_srcptr y;
+    slong ystep;
+    slong len;
+}
+dot_work_t;
+
+static void
+dot_worker(slong i, dot_work_t * work)
+{
+    slong start, n;
+    mp_size_t sn;
+    mp_ptr tmp;
+
+    sn = work->sn;
+    start = i * ARB_DOT_THREAD_CHUNK;
+    n = FLINT_MIN(ARB_DOT_THREAD_CHUNK, work->len - start);
+
+    tmp = flint_malloc(sizeof(mp_limb_t) * (2 * (sn + 2) + 1));
+
+    _arb_approx_dot_sum_terms(work->sums + i * (sn + 1), tmp, sn, work->sum_exp,
+        work->x + start * work->xstep, work->xstep,
+        work->y + start * work->ystep, work->ystep, n);
+
+    flint_free(tmp);
+}
+
+static void
+_arb_approx_dot_sum_terms_threaded(mp_ptr sum, mp_ptr tmp, mp_size_t sn, slong sum_exp,
+    arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len)
+{
+    dot_work_t work;
+    slong i, num;
+
+    num = (len + ARB_DOT_THREAD_CHUNK - 1) / ARB_DOT_THREAD_CHUNK;
+
+    if (num <= 1 || arb_flint_get_num_available_threads() <= 1)
+    {
+        _arb_approx_dot_sum_terms(sum, tmp, sn, sum_exp, x, xstep, y, ystep, len);
+        return;
+    }
+
+    work.sums = flint_calloc(num * (sn + 1), sizeof(mp_limb_t));
+    work.sn = sn;
+    work.sum_exp = sum_exp;
+    work.x = x;
+    work.xstep = xstep;
+    work.y = y;
+    work.ystep = ystep;
+    work.len = len;
+
+    flint_parallel_do((do_func_t) dot_worker, &work, num, -1, FLINT_PARALLEL_UNIFORM);
+
+    for (i = 0; i < num; i++)
+        mpn_add_n(sum, sum, work.sums + i * (sn + 1), sn);
+
+    flint_free(work.sums);
+}
+
+/* If threaded is set, the terms may be summed in parallel; this does
+   not change the result. */
+void
+_arb_approx_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len, slong prec, int threaded)
+{
+    slong i, j, nonzero, padding, extend;
+    slong xexp, yexp, exp, max_exp, min_exp, sum_exp;
+    int xnegative;
+    mp_size_t xn, sn, alloc;
+    flint_bitcnt_t shift;
+    arb_srcptr xi, yi;
+    arf_srcptr xm, ym;
+    mp_limb_t serr;   /* Sum over arithmetic errors  - not used, but need dummy for calls */
+    mp_ptr tmp, sum;  /* Workspace */
+    ARF_ADD_TMP_DECL;
+
+    /* todo: fast fma and fmma (len=2) code */
+    if (len <= 1)
+    {
+        if (initial == NULL)
+        {
+            if (len <= 0)
+                arf_zero(arb_midref(res));
+            else
+            {
+                if (subtract)
+                    arf_neg_mul(arb_midref(res), arb_midref(x), arb_midref(y), prec, ARB_RND);
+                else
+                    arf_mul(arb_midref(res), arb_midref(x), arb_midref(y), prec, ARB_RND);
+            }
+            return;
+        }
+        else if (len <= 0)
+        {
+            arf_set_round(arb_midref(res), arb_midref(initial), prec, ARB_RND);
+            return;
+        }
+    }
+
+    /* Number of nonzero midpoint terms in sum. */
+    nonzero = 0;
+
+    /* Terms are bounded by 2^max_exp (with WORD_MIN = -infty) */
+    max_exp = WORD_MIN;
+
+    /* Used to reduce the precision. */
+    min_exp = WORD_MAX;
+
+    /* Account for the initial term. */
+    if (initial != NULL)
+    {
+        if (!ARF_IS_LAGOM(arb_midref(initial)))
+        {
+            arb_approx_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
+            return;
+        }
+
+        xm = arb_midref(initial);
+
+        if (!arf_is_special(xm))
+        {
+            max_exp = ARF_EXP(xm);
+            nonzero++;
+
+            if (prec > 2 * FLINT_BITS)
+                min_exp = ARF_EXP(xm) - ARF_SIZE(xm) * FLINT_BITS;
+        }
+    }
+
+    /* Determine maximum exponents for the main sum and the radius sum. */
+    for (i = 0; i < len; i++)
+    {
+        xi = x + i * xstep;
+        yi = y + i * ystep;
+
+        /* Fallback for huge exponents or non-finite values. */
+        if (!ARF_IS_LAGOM(arb_midref(xi)) || !ARF_IS_LAGOM(arb_midref(yi)))
+        {
+            arb_approx_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
+            return;
+        }
+
+        xm = arb_midref(xi);
+        ym = arb_midref(yi);
+
+        if (!arf_is_special(xm))
+        {
+            xexp = ARF_EXP(xm);
+
+            if (!arf_is_special(ym))
+            {
+                yexp = ARF_EXP(ym);
+
+                max_exp = FLINT_MAX(max_exp, xexp + yexp);
+                nonzero++;
+
+                if (prec > 2 * FLINT_BITS)
+                {
+                    slong bot;
+                    bot = (xexp + yexp) - (ARF_SIZE(xm) + ARF_SIZE(ym)) * FLINT_BITS;
+                    min_exp = FLINT_MIN(min_exp, bot);
+                }
+            }
+        }
+    }
+
+    /* The midpoint sum is zero. */
+    if (max_exp == WORD_MIN)
+    {
+        arf_zero(arb_midref(res));
+        return;
+    }
+    else
+    {
+        /* Reduce precision based on actual sizes. */
+        if (min_exp != WORD_MAX)
+            prec = FLINT_MIN(prec, max_exp - min_exp + MAG_BITS);
+
+        prec = FLINT_MAX(prec, 2);
+    }
+
+    /* Extend sum so that we can use two's complement addition. */
+    extend = FLINT_BIT_COUNT(nonzero) + 1;
+
+    /* Extra bits to improve accuracy (optional). */
+    padding = 4 + FLINT_BIT_COUNT(len);
+
+    /* Number of limbs. */
+    sn = (prec + extend + padding + FLINT_BITS - 1) / FLINT_BITS;
+
+    /* Avoid having to make a special case for sn = 1. */
+    sn = FLINT_MAX(sn, 2);
+
+    /* Exponent for the main sum. */
+    sum_exp = max_exp + extend;
+
+    /* We need sn + 1 limb for the sum (sn limbs + 1 dummy limb
+       for carry or borrow that avoids an extra branch). We need
+       2 * (sn + 2) limbs to store the product of two numbers
+       with up to (sn + 2) limbs, plus 1 extra limb for shifting
+       the product. */
+    alloc = (sn + 1) + 2 * (sn + 2) + 1;
+    ARF_ADD_TMP_ALLOC(sum, alloc)
+    tmp = sum + (sn + 1);
+
+    /* Set sum to 0 */
+    serr = 0;
+    for (j = 0; j < sn + 1; j++)
+        sum[j] = 0;
+
+    if (initial != NULL)
+    {
+        xm = arb_midref(initial);
+
+        if (!arf_is_special(xm))
+        {
+            mp_srcptr xptr;
+
+            xexp = ARF_EXP(xm);
+            xn = ARF_SIZE(xm);
+            xnegative = ARF_SGNBIT(xm);
+
+            shift = sum_exp - xexp;
+
+            if (shift < sn * FLINT_BITS)
+            {
+                xptr = (xn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(xm) : ARF_PTR_D(xm);
+                _arb_dot_add_generic(sum, &serr, tmp, sn, xptr, xn, xnegative ^ subtract, shift);
+            }
+        }
+    }
+
+    if (threaded)
+        _arb_approx_dot_sum_terms_threaded(sum, tmp, sn, sum_exp, x, xstep, y, ystep, len);
+    else
+        _arb_approx_dot_sum_terms(sum, tmp, sn, sum_exp, x, xstep, y, ystep, len);
 
     xnegative = 0;
     if (sum[sn - 1] >= LIMB_TOP)
@@ -461,3 +551,9 @@ arb_approx_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong
 
     ARF_ADD_TMP_FREE(sum, alloc);
 }
+
+void
+arb_approx_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len, slong prec)
+{
+    _arb_approx_dot(res, initial, subtract, x, xstep, y, ystep, len, prec, 0);
+}
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "arb.h"
 #include "flint/longlong.h"
 
@@ -378,543 +379,665 @@ _arb_dot_add_generic(mp_ptr sum, mp_ptr serr, mp_ptr tmp, mp_size_t sn,
     }
 }
 
-void
-arb_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len, slong prec)
+/* Adds the terms x[i] y[i], 0 <= i < len, to the fixed-point sum
+   (sn limbs plus one dummy limb, with top at 2^sum_exp), to the
+   arithmetic error count serr and to the radius sum srad (in units of
+   2^(srad_exp - MAG_BITS)). Each term contributes a value which only
+   depends on the term and the alignment, and the sum is computed
+   modulo 2^(sn FLINT_BITS), so the terms can be split into groups
+   that are summed separately and then added. */
+static void
+_arb_dot_sum_terms(mp_ptr sum, mp_limb_t * serr_ptr, uint64_t * srad_ptr,
+    mp_ptr tmp, mp_size_t sn, slong sum_exp, slong srad_exp,
+    arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len)
 {
-    slong i, j, nonzero, padding, extend;
-    slong xexp, yexp, exp, max_exp, min_exp, sum_exp;
-    slong xrexp, yrexp, srad_exp, max_rad_exp;
-    int xnegative, ynegative, inexact;
-    mp_size_t xn, yn, sn, alloc;
+    slong i, xexp, yexp, exp, xrexp, yrexp;
+    int xnegative, ynegative;
+    mp_size_t xn, yn;
     flint_bitcnt_t shift;
     arb_srcptr xi, yi;
     arf_srcptr xm, ym;
     mag_srcptr xr, yr;
     mp_limb_t xtop, ytop;
     mp_limb_t xrad, yrad;
-    mp_limb_t serr;   /* Sum over arithmetic errors */
-    uint64_t srad;    /* Sum over propagated errors */
-    mp_ptr tmp, sum;  /* Workspace */
-    ARF_ADD_TMP_DECL;
-
-    /* todo: fast fma and fmma (len=2) code */
-    if (len <= 1)
-    {
-        if (initial == NULL)
-        {
-            if (len <= 0)
-                arb_zero(res);
-            else
-            {
-                arb_mul(res, x, y, prec);
-                if (subtract)
-                    arb_neg(res, res);
-            }
-            return;
-        }
-        else if (len <= 0)
-        {
-            arb_set_round(res, initial, prec);
-            return;
-        }
-    }
-
-    /* Number of nonzero midpoint terms in sum. */
-    nonzero = 0;
-
-    /* Terms are bounded by 2^max_exp (with WORD_MIN = -infty) */
-    max_exp = WORD_MIN;
-
-    /* Propagated error terms are bounded by 2^max_rad_exp */
-    max_rad_exp = WORD_MIN;
-
-    /* Used to reduce the precision. */
-    min_exp = WORD_MAX;
-
-    /* Account for the initial term. */
-    if (initial != NULL)
-    {
-        if (!ARB_IS_LAGOM(initial))
-        {
-            arb_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
-            return;
-        }
-
-        xm = arb_midref(initial);
-        xr = arb_radref(initial);
-
-        if (!arf_is_special(xm))
-        {
-            max_exp = ARF_EXP(xm);
-            nonzero++;
-
-            if (prec > 2 * FLINT_BITS)
-                min_exp = ARF_EXP(xm) - ARF_SIZE(xm) * FLINT_BITS;
-        }
+    mp_limb_t serr;
+    uint64_t srad;
 
-        if (!mag_is_special(xr))
-            max_rad_exp = MAG_EXP(xr);
-    }
+    serr = *serr_ptr;
+    srad = *srad_ptr;
 
-    /* Determine maximum exponents for the main sum and the radius sum. */
     for (i = 0; i < len; i++)
     {
         xi = x + i * xstep;
         yi = y + i * ystep;
-
-        /* Fallback for huge exponents or non-finite values. */
-        if (!ARB_IS_LAGOM(xi) || !ARB_IS_LAGOM(yi))
-        {
-            arb_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
-            return;
-        }
-
         xm = arb_midref(xi);
         ym = arb_midref(yi);
         xr = arb_radref(xi);
         yr = arb_radref(yi);
 
-        /* (xm+xr)(ym+yr) = xm ym + [xr ym + xm yr + xr yr] */
-        if (!arf_is_special(xm))
+        /* The midpoints of x[i] and y[i] are both nonzero. */
+        if (!arf_is_special(xm) && !arf_is_special(ym))
         {
             xexp = ARF_EXP(xm);
+            xn = ARF_SIZE(xm);
+            xnegative = ARF_SGNBIT(xm);
 
-            if (!arf_is_special(ym))
+            yexp = ARF_EXP(ym);
+            yn = ARF_SIZE(ym);
+            ynegative = ARF_SGNBIT(ym);
+
+            exp = xexp + yexp;
+            shift = sum_exp - exp;
+
+            if (shift >= sn * FLINT_BITS)
             {
-                yexp = ARF_EXP(ym);
+                /* We may yet need the top limbs for bounds. */
+                ARF_GET_TOP_LIMB(xtop, xm);
+                ARF_GET_TOP_LIMB(ytop, ym);
+                serr++;
+            }
+#if 0
+            else if (xn == 1 && yn == 1 && sn == 2 && shift < FLINT_BITS)  /* Fastest path. */
+            {
+                mp_limb_t hi, lo, out;
 
-                max_exp = FLINT_MAX(max_exp, xexp + yexp);
-                nonzero++;
+                xtop = ARF_NOPTR_D(xm)[0];
+                ytop = ARF_NOPTR_D(ym)[0];
 
-                if (prec > 2 * FLINT_BITS)
-                {
-                    slong bot;
-                    bot = (xexp + yexp) - (ARF_SIZE(xm) + ARF_SIZE(ym)) * FLINT_BITS;
-                    min_exp = FLINT_MIN(min_exp, bot);
-                }
+                umul_ppmm(hi, lo, xtop, ytop);
 
-                if (!mag_is_special(xr))
-                {
-                    xrexp = MAG_EXP(xr);
-                    max_rad_exp = FLINT_MAX(max_rad_exp, yexp + xrexp);
+                out = lo << (FLINT_BITS - shift);
+                lo = (lo >> shift) | (hi << (FLINT_BITS - shift));
+                hi = (hi >> shift);
+                serr += (out != 0);
 
-                    if (!mag_is_special(yr))
-                    {
-                        yrexp = MAG_EXP(yr);
-                        max_rad_exp = FLINT_MAX(max_rad_exp, xexp + yrexp);
-                        max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yrexp);
-                    }
-                }
+                if (xnegative ^ ynegative)
+                    sub_ddmmss(sum[1], sum[0], sum[1], sum[0], hi, lo);
                 else
-                {
-                    if (!mag_is_special(yr))
-                    {
-                        yrexp = MAG_EXP(yr);
-                        max_rad_exp = FLINT_MAX(max_rad_exp, xexp + yrexp);
-                    }
-                }
+                    add_ssaaaa(sum[1], sum[0], sum[1], sum[0], hi, lo);
             }
-            else  /* if y = 0, something can happen only if yr != 0 */
+            else if (xn == 2 && yn == 2 && shift < FLINT_BITS && sn <= 3)
             {
-                if (!mag_is_special(yr))
-                {
-                    yrexp = MAG_EXP(yr);
-                    max_rad_exp = FLINT_MAX(max_rad_exp, xexp + yrexp);
+                mp_limb_t x1, x0, y1, y0;
+                mp_limb_t u3, u2, u1, u0;
 
-                    if (!mag_is_special(xr))
-                    {
-                        xrexp = MAG_EXP(xr);
-                        max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yrexp);
-                    }
+                x0 = ARF_NOPTR_D(xm)[0];
+                x1 = ARF_NOPTR_D(xm)[1];
+                y0 = ARF_NOPTR_D(ym)[0];
+                y1 = ARF_NOPTR_D(ym)[1];
+
+                xtop = x1;
+                ytop = y1;
+
+                nn_mul_2x2(u3, u2, u1, u0, x1, x0, y1, y0);
+
+                u0 = (u0 != 0) || ((u1 << (FLINT_BITS - shift)) != 0);
+                u1 = (u1 >> shift) | (u2 << (FLINT_BITS - shift));
+                u2 = (u2 >> shift) | (u3 << (FLINT_BITS - shift));
+                u3 = (u3 >> shift);
+
+                if (sn == 2)
+                {
+                    serr += (u0 || (u1 != 0));
+                    if (xnegative ^ ynegative)
+                        sub_ddmmss(sum[1], sum[0], sum[1], sum[0], u3, u2);
+                    else
+                        add_ssaaaa(sum[1], sum[0], sum[1], sum[0], u3, u2);
+                }
+                else
+                {
+                    serr += u0;
+                    if (xnegative ^ ynegative)
+                        sub_dddmmmsss(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
+                    else
+                        add_sssaaaaaa(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
                 }
             }
-        }
-        else  /* if x = 0, something can happen only if xr != 0 */
-        {
-            if (!mag_is_special(xr))
+#endif
+            else if (xn <= 2 && yn <= 2 && sn <= 3)
             {
-                xrexp = MAG_EXP(xr);
+                mp_limb_t x1, x0, y1, y0;
+                mp_limb_t u3, u2, u1, u0;
 
-                if (!arf_is_special(ym))
+                if (xn == 1 && yn == 1)
                 {
-                    yexp = ARF_EXP(ym);
-                    max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yexp);
+                    xtop = ARF_NOPTR_D(xm)[0];
+                    ytop = ARF_NOPTR_D(ym)[0];
+                    umul_ppmm(u3, u2, xtop, ytop);
+                    u1 = u0 = 0;
                 }
-
-                if (!mag_is_special(yr))
+                else if (xn == 2 && yn == 2)
                 {
-                    yrexp = MAG_EXP(yr);
-                    max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yrexp);
+                    x0 = ARF_NOPTR_D(xm)[0];
+                    x1 = ARF_NOPTR_D(xm)[1];
+                    y0 = ARF_NOPTR_D(ym)[0];
+                    y1 = ARF_NOPTR_D(ym)[1];
+                    xtop = x1;
+                    ytop = y1;
+                    nn_mul_2x2(u3, u2, u1, u0, x1, x0, y1, y0);
+                }
+                else if (xn == 1)
+                {
+                    x0 = ARF_NOPTR_D(xm)[0];
+                    y0 = ARF_NOPTR_D(ym)[0];
+                    y1 = ARF_NOPTR_D(ym)[1];
+                    xtop = x0;
+                    ytop = y1;
+                    nn_mul_2x1(u3, u2, u1, y1, y0, x0);
+                    u0 = 0;
+                }
+                else
+                {
+                    x0 = ARF_NOPTR_D(xm)[0];
+                    x1 = ARF_NOPTR_D(xm)[1];
+                    y0 = ARF_NOPTR_D(ym)[0];
+                    xtop = x1;
+                    ytop = y0;
+                    nn_mul_2x1(u3, u2, u1, x1, x0, y0);
+                    u0 = 0;
                 }
-            }
-        }
-    }
-
-    /* The midpoint sum is zero. */
-    if (max_exp == WORD_MIN)
-    {
-        /* The sum is exactly zero. */
-        if (max_rad_exp == WORD_MIN)
-        {
-            arb_zero(res);
-            return;
-        }
-
-        prec = 2;
-    }
-    else
-    {
-        /* Reduce precision based on errors. */
-        if (max_rad_exp != WORD_MIN)
-            prec = FLINT_MIN(prec, max_exp - max_rad_exp + MAG_BITS);
-
-        /* Reduce precision based on actual sizes. */
-        if (min_exp != WORD_MAX)
-            prec = FLINT_MIN(prec, max_exp - min_exp + MAG_BITS);
 
-        prec = FLINT_MAX(prec, 2);
-    }
-
-    /* Extend sum so that we can use two's complement addition. */
-    extend = FLINT_BIT_COUNT(nonzero) + 1;
-
-    /* Extra bits to improve accuracy (optional). */
-    padding = 4 + FLINT_BIT_COUNT(len);
+                if (sn == 2)
+                {
+                    if (shift < FLINT_BITS)
+                    {
+                        serr += ((u2 << (FLINT_BITS - shift)) != 0) || (u1 != 0) || (u0 != 0);
+                        u2 = (u2 >> shift) | (u3 << (FLINT_BITS - shift));
+                        u3 = (u3 >> shift);
+                    }
+                    else if (shift == FLINT_BITS)
+                    {
+                        serr += (u2 != 0) || (u1 != 0) || (u0 != 0);
+                        u2 = u3;
+                        u3 = 0;
+                    }
+                    else /* FLINT_BITS < shift < 2 * FLINT_BITS */
+                    {
+                        serr += ((u3 << (2 * FLINT_BITS - shift)) != 0) || (u2 != 0) || (u1 != 0) || (u0 != 0);
+                        u2 = (u3 >> (shift - FLINT_BITS));
+                        u3 = 0;
+                    }
 
-    /* Number of limbs. */
-    sn = (prec + extend + padding + FLINT_BITS - 1) / FLINT_BITS;
+                    if (xnegative ^ ynegative)
+                        sub_ddmmss(sum[1], sum[0], sum[1], sum[0], u3, u2);
+                    else
+                        add_ssaaaa(sum[1], sum[0], sum[1], sum[0], u3, u2);
+                }
+                else if (sn == 3)
+                {
+                    if (shift < FLINT_BITS)
+                    {
+                        serr += ((u1 << (FLINT_BITS - shift)) != 0) || (u0 != 0);
+                        u1 = (u1 >> shift) | (u2 << (FLINT_BITS - shift));
+                        u2 = (u2 >> shift) | (u3 << (FLINT_BITS - shift));
+                        u3 = (u3 >> shift);
+                    }
+                    else if (shift == FLINT_BITS)
+                    {
+                        serr += (u1 != 0) || (u0 != 0);
+                        u1 = u2;
+                        u2 = u3;
+                        u3 = 0;
+                    }
+                    else if (shift < 2 * FLINT_BITS)
+                    {
+                        serr += ((u2 << (2 * FLINT_BITS - shift)) != 0) || (u1 != 0) || (u0 != 0);
+                        u1 = (u3 << (2 * FLINT_BITS - shift)) | (u2 >> (shift - FLINT_BITS));
+                        u2 = (u3 >> (shift - FLINT_BITS));
+                        u3 = 0;
+                    }
+                    else if (shift == 2 * FLINT_BITS)
+                    {
+                        serr += (u2 != 0) || (u1 != 0) || (u0 != 0);
+                        u1 = u3;
+                        u2 = 0;
+                        u3 = 0;
+                    }
+                    else  /* 2 * FLINT_BITS < shift < 3 * FLINT_BITS */
+                    {
+                        serr += ((u3 << (3 * FLINT_BITS - shift)) != 0) || (u2 != 0) || (u1 != 0) || (u0 != 0);
+                        u1 = (u3 >> (shift - 2 * FLINT_BITS));
+                        u2 = 0;
+                        u3 = 0;
+                    }
 
-    /* Avoid having to make a special case for sn = 1. */
-    sn = FLINT_MAX(sn, 2);
+                    if (xnegative ^ ynegative)
+                        sub_dddmmmsss(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
+                    else
+                        add_sssaaaaaa(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
+                }
+            }
+            else
+            {
+                mp_srcptr xptr, yptr;
 
-    /* Exponent for the main sum. */
-    sum_exp = max_exp + extend;
+                xptr = (xn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(xm) : ARF_PTR_D(xm);
+                yptr = (yn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(ym) : ARF_PTR_D(ym);
 
-    /* We need sn + 1 limb for the sum (sn limbs + 1 dummy limb
-       for carry or borrow that avoids an extra branch). We need
-       2 * (sn + 2) limbs to store the product of two numbers
-       with up to (sn + 2) limbs, plus 1 extra limb for shifting
-       the product. */
-    alloc = (sn + 1) + 2 * (sn + 2) + 1;
-    ARF_ADD_TMP_ALLOC(sum, alloc)
-    tmp = sum + (sn + 1);
+                xtop = xptr[xn - 1];
+                ytop = yptr[yn - 1];
 
-    /* Sum of propagated errors. */
-    srad_exp = max_rad_exp;
-    srad = 0;
+                _arb_dot_addmul_generic(sum, &serr, tmp, sn, xptr, xn, yptr, yn, xnegative ^ ynegative, shift);
+            }
 
-    /* Set sum to 0 */
-    serr = 0;
-    for (j = 0; j < sn + 1; j++)
-        sum[j] = 0;
+            xrad = MAG_MAN(xr);
+            yrad = MAG_MAN(yr);
 
-    if (initial != NULL)
-    {
-        xm = arb_midref(initial);
-        xr = arb_radref(initial);
+            if (xrad != 0 && yrad != 0)
+            {
+                xrexp = MAG_EXP(xr);
+                yrexp = MAG_EXP(yr);
 
-        if (!arf_is_special(xm))
+                RAD_ADDMUL(srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
+                RAD_ADDMUL(srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
+                RAD_ADDMUL(srad, srad_exp, xrad, yrad, xrexp + yrexp);
+            }
+            else if (xrad != 0)
+            {
+                xrexp = MAG_EXP(xr);
+                RAD_ADDMUL(srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
+            }
+            else if (yrad != 0)
+            {
+                yrexp = MAG_EXP(yr);
+                RAD_ADDMUL(srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
+            }
+        }
+        else
         {
-            mp_srcptr xptr;
+            xrad = MAG_MAN(xr);
+            yrad = MAG_MAN(yr);
 
             xexp = ARF_EXP(xm);
-            xn = ARF_SIZE(xm);
-            xnegative = ARF_SGNBIT(xm);
+            yexp = ARF_EXP(ym);
 
-            shift = sum_exp - xexp;
+            xrexp = MAG_EXP(xr);
+            yrexp = MAG_EXP(yr);
 
-            if (shift >= sn * FLINT_BITS)
+            /* (xm+xr)(ym+yr) = xm ym + [xm yr + ym xr + xr yr] */
+            if (yrad && !arf_is_special(xm))
             {
-                serr++;
+                ARF_GET_TOP_LIMB(xtop, xm);
+                RAD_ADDMUL(srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
             }
-            else
+
+            if (xrad && !arf_is_special(ym))
             {
-                xptr = (xn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(xm) : ARF_PTR_D(xm);
-                _arb_dot_add_generic(sum, &serr, tmp, sn, xptr, xn, xnegative ^ subtract, shift);
+                ARF_GET_TOP_LIMB(ytop, ym);
+                RAD_ADDMUL(srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
             }
-        }
-
-        if (!mag_is_special(xr))
-        {
-            xrad = MAG_MAN(xr);
-            xrexp = MAG_EXP(xr);
 
-            shift = srad_exp - xrexp;
-            if (shift < 64)
-                srad += (xrad >> shift) + 1;
-            else
-                srad++;
+            if (xrad && yrad)
+            {
+                RAD_ADDMUL(srad, srad_exp, xrad, yrad, xrexp + yrexp);
+            }
         }
     }
 
-    for (i = 0; i < len; i++)
+    *serr_ptr = serr;
+    *srad_ptr = srad;
+}
+
+typedef struct
+{
+    mp_ptr sums;
+    mp_limb_t * serr;
+    uint64_t * srad;
+    mp_size_t sn;
+    slong sum_exp;
+    slong srad_exp;
+    arb_srcptr x;
+    slong xstep;
+    arb_srcptr y;
+    slong ystep;
+    slong len;
+}
+dot_work_t;
+
+static void
+dot_worker(slong i, dot_work_t * work)
+{
+    slong start, n;
+    mp_size_t sn;
+    mp_ptr tmp;
+
+    sn = work->sn;
+    start = i * ARB_DOT_THREAD_CHUNK;
+    n = FLINT_MIN(ARB_DOT_THREAD_CHUNK, work->len - start);
+
+    tmp = flint_malloc(sizeof(mp_limb_t) * (2 * (sn + 2) + 1));
+
+    _arb_dot_sum_terms(work->sums + i * (sn + 1), work->serr + i, work->srad + i,
+        tmp, sn, work->sum_exp, work->srad_exp,
+        work->x + start * work->xstep, work->xstep,
+        work->y + start * work->ystep, work->ystep, n);
+
+    flint_free(tmp);
+}
+
+/* Sums chunks of ARB_DOT_THREAD_CHUNK terms in parallel, each into its
+   own fixed-point sum with the global alignment, and adds the chunk
+   sums exactly. The result is identical to that of _arb_dot_sum_terms. */
+static void
+_arb_dot_sum_terms_threaded(mp_ptr sum, mp_limb_t * serr, uint64_t * srad,
+    mp_ptr tmp, mp_size_t sn, slong sum_exp, slong srad_exp,
+    arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len)
+{
+    dot_work_t work;
+    slong i, num;
+
+    num = (len + ARB_DOT_THREAD_CHUNK - 1) / ARB_DOT_THREAD_CHUNK;
+
+    if (num <= 1 || arb_flint_get_num_available_threads() <= 1)
     {
-        xi = x + i * xstep;
-        yi = y + i * ystep;
-        xm = arb_midref(xi);
-        ym = arb_midref(yi);
-        xr = arb_radref(xi);
-        yr = arb_radref(yi);
+        _arb_dot_sum_terms(sum, serr, srad, tmp, sn, sum_exp, srad_exp,
+            x, xstep, y, ystep, len);
+        return;
+    }
 
-        /* The midpoints of x[i] and y[i] are both nonzero. */
-        if (!arf_is_special(xm) && !arf_is_special(ym))
-        {
-            xexp = ARF_EXP(xm);
-            xn = ARF_SIZE(xm);
-            xnegative = ARF_SGNBIT(xm);
+    work.sums = flint_calloc(num * (sn + 1), sizeof(mp_limb_t));
+    work.serr = flint_calloc(num, sizeof(mp_limb_t));
+    work.srad = flint_calloc(num, sizeof(uint64_t));
+    work.sn = sn;
+    work.sum_exp = sum_exp;
+    work.srad_exp = srad_exp;
+    work.x = x;
+    work.xstep = xstep;
+    work.y = y;
+    work.ystep = ystep;
+    work.len = len;
+
+    flint_parallel_do((do_func_t) dot_worker, &work, num, -1, FLINT_PARALLEL_UNIFORM);
+
+    for (i = 0; i < num; i++)
+    {
+        mpn_add_n(sum, sum, work.sums + i * (sn + 1), sn);
+        *serr += work.serr[i];
+        *srad += work.srad[i];
+    }
 
-            yexp = ARF_EXP(ym);
-            yn = ARF_SIZE(ym);
-            ynegative = ARF_SGNBIT(ym);
+    flint_free(work.sums);
+    flint_free(work.serr);
+    flint_free(work.srad);
+}
 
-            exp = xexp + yexp;
-            shift = sum_exp - exp;
+/* If threaded is set, the terms may be summed in parallel; this does
+   not change the result. */
+void
+_arb_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len, slong prec, int threaded)
+{
+    slong i, j, nonzero, padding, extend;
+    slong xexp, yexp, exp, max_exp, min_exp, sum_exp;
+    slong xrexp, yrexp, srad_exp, max_rad_exp;
+    int xnegative, inexact;
+    mp_size_t xn, sn, alloc;
+    flint_bitcnt_t shift;
+    arb_srcptr xi, yi;
+    arf_srcptr xm, ym;
+    mag_srcptr xr, yr;
+    mp_limb_t xrad;
+    mp_limb_t serr;   /* Sum over arithmetic errors */
+    uint64_t srad;    /* Sum over propagated errors */
+    mp_ptr tmp, sum;  /* Workspace */
+    ARF_ADD_TMP_DECL;
 
-            if (shift >= sn * FLINT_BITS)
+    /* todo: fast fma and fmma (len=2) code */
+    if (len <= 1)
+    {
+        if (initial == NULL)
+        {
+            if (len <= 0)
+                arb_zero(res);
+            else
             {
-                /* We may yet need the top limbs for bounds. */
-                ARF_GET_TOP_LIMB(xtop, xm);
-                ARF_GET_TOP_LIMB(ytop, ym);
-                serr++;
+                arb_mul(res, x, y, prec);
+                if (subtract)
+                    arb_neg(res, res);
             }
-#if 0
-            else if (xn == 1 && yn == 1 && sn == 2 && shift < FLINT_BITS)  /* Fastest path. */
-            {
-                mp_limb_t hi, lo, out;
+            return;
+        }
+        else if (len <= 0)
+        {
+            arb_set_round(res, initial, prec);
+            return;
+        }
+    }
 
-                xtop = ARF_NOPTR_D(xm)[0];
-                ytop = ARF_NOPTR_D(ym)[0];
+    /* Number of nonzero midpoint terms in sum. */
+    nonzero = 0;
 
-                umul_ppmm(hi, lo, xtop, ytop);
+    /* Terms are bounded by 2^max_exp (with WORD_MIN = -infty) */
+    max_exp = WORD_MIN;
 
-                out = lo << (FLINT_BITS - shift);
-                lo = (lo >> shift) | (hi << (FLINT_BITS - shift));
-                hi = (hi >> shift);
-                serr += (out != 0);
+    /* Propagated error terms are bounded by 2^max_rad_exp */
+    max_rad_exp = WORD_MIN;
 
-                if (xnegative ^ ynegative)
-                    sub_ddmmss(sum[1], sum[0], sum[1], sum[0], hi, lo);
-                else
-                    add_ssaaaa(sum[1], sum[0], sum[1], sum[0], hi, lo);
-            }
-            else if (xn == 2 && yn == 2 && shift < FLINT_BITS && sn <= 3)
-            {
-                mp_limb_t x1, x0, y1, y0;
-                mp_limb_t u3, u2, u1, u0;
+    /* Used to reduce the precision. */
+    min_exp = WORD_MAX;
 
-                x0 = ARF_NOPTR_D(xm)[0];
-                x1 = ARF_NOPTR_D(xm)[1];
-                y0 = ARF_NOPTR_D(ym)[0];
-                y1 = ARF_NOPTR_D(ym)[1];
+    /* Account for the initial term. */
+    if (initial != NULL)
+    {
+        if (!ARB_IS_LAGOM(initial))
+        {
+            arb_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
+            return;
+        }
 
-                xtop = x1;
-                ytop = y1;
+        xm = arb_midref(initial);
+        xr = arb_radref(initial);
 
-                nn_mul_2x2(u3, u2, u1, u0, x1, x0, y1, y0);
+        if (!arf_is_special(xm))
+        {
+            max_exp = ARF_EXP(xm);
+            nonzero++;
 
-                u0 = (u0 != 0) || ((u1 << (FLINT_BITS - shift)) != 0);
-                u1 = (u1 >> shift) | (u2 << (FLINT_BITS - shift));
-                u2 = (u2 >> shift) | (u3 << (FLINT_BITS - shift));
-                u3 = (u3 >> shift);
+            if (prec > 2 * FLINT_BITS)
+                min_exp = ARF_EXP(xm) - ARF_SIZE(xm) * FLINT_BITS;
+        }
 
-                if (sn == 2)
-                {
-                    serr += (u0 || (u1 != 0));
-                    if (xnegative ^ ynegative)
-                        sub_ddmmss(sum[1], sum[0], sum[1], sum[0], u3, u2);
-                    else
-                        add_ssaaaa(sum[1], sum[0], sum[1], sum[0], u3, u2);
-                }
-                else
-                {
-                    serr += u0;
-                    if (xnegative ^ ynegative)
-                        sub_dddmmmsss(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
-                    else
-                        add_sssaaaaaa(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
-                }
-            }
-#endif
-            else if (xn <= 2 && yn <= 2 && sn <= 3)
-            {
-                mp_limb_t x1, x0, y1, y0;
-                mp_limb_t u3, u2, u1, u0;
+        if (!mag_is_special(xr))
+            max_rad_exp = MAG_EXP(xr);
+    }
 
-                if (xn == 1 && yn == 1)
-                {
-                    xtop = ARF_NOPTR_D(xm)[0];
-                    ytop = ARF_NOPTR_D(ym)[0];
-                    umul_ppmm(u3, u2, xtop, ytop);
-                    u1 = u0 = 0;
-                }
-                else if (xn == 2 && yn == 2)
-                {
-                    x0 = ARF_NOPTR_D(xm)[0];
-                    x1 = ARF_NOPTR_D(xm)[1];
-                    y0 = ARF_NOPTR_D(ym)[0];
-                    y1 = ARF_NOPTR_D(ym)[1];
-                    xtop = x1;
-                    ytop = y1;
-                    nn_mul_2x2(u3, u2, u1, u0, x1, x0, y1, y0);
-                }
-                else if (xn == 1)
-                {
-                    x0 = ARF_NOPTR_D(xm)[0];
-                    y0 = ARF_NOPTR_D(ym)[0];
-                    y1 = ARF_NOPTR_D(ym)[1];
-                    xtop = x0;
-                    ytop = y1;
-                    nn_mul_2x1(u3, u2, u1, y1, y0, x0);
-                    u0 = 0;
-                }
-                else
+    /* Determine maximum exponents for the main sum and the radius sum. */
+    for (i = 0; i < len; i++)
+    {
+        xi = x + i * xstep;
+        yi = y + i * ystep;
+
+        /* Fallback for huge exponents or non-finite values. */
+        if (!ARB_IS_LAGOM(xi) || !ARB_IS_LAGOM(yi))
+        {
+            arb_dot_simple(res, initial, subtract, x, xstep, y, ystep, len, prec);
+            return;
+        }
+
+        xm = arb_midref(xi);
+        ym = arb_midref(yi);
+        xr = arb_radref(xi);
+        yr = arb_radref(yi);
+
+        /* (xm+xr)(ym+yr) = xm ym + [xr ym + xm yr + xr yr] */
+        if (!arf_is_special(xm))
+        {
+            xexp = ARF_EXP(xm);
+
+            if (!arf_is_special(ym))
+            {
+                yexp = ARF_EXP(ym);
+
+                max_exp = FLINT_MAX(max_exp, xexp + yexp);
+                nonzero++;
+
+                if (prec > 2 * FLINT_BITS)
                 {
-                    x0 = ARF_NOPTR_D(xm)[0];
-                    x1 = ARF_NOPTR_D(xm)[1];
-                    y0 = ARF_NOPTR_D(ym)[0];
-                    xtop = x1;
-                    ytop = y0;
-                    nn_mul_2x1(u3, u2, u1, x1, x0, y0);
-                    u0 = 0;
+                    slong bot;
+                    bot = (xexp + yexp) - (ARF_SIZE(xm) + ARF_SIZE(ym)) * FLINT_BITS;
+                    min_exp = FLINT_MIN(min_exp, bot);
                 }
 
-                if (sn == 2)
+                if (!mag_is_special(xr))
                 {
-                    if (shift < FLINT_BITS)
-                    {
-                        serr += ((u2 << (FLINT_BITS - shift)) != 0) || (u1 != 0) || (u0 != 0);
-                        u2 = (u2 >> shift) | (u3 << (FLINT_BITS - shift));
-                        u3 = (u3 >> shift);
-                    }
-                    else if (shift == FLINT_BITS)
-                    {
-                        serr += (u2 != 0) || (u1 != 0) || (u0 != 0);
-                        u2 = u3;
-                        u3 = 0;
-                    }
-                    else /* FLINT_BITS < shift < 2 * FLINT_BITS */
+                    xrexp = MAG_EXP(xr);
+                    max_rad_exp = FLINT_MAX(max_rad_exp, yexp + xrexp);
+
+                    if (!mag_is_special(yr))
                     {
-                        serr += ((u3 << (2 * FLINT_BITS - shift)) != 0) || (u2 != 0) || (u1 != 0) || (u0 != 0);
-                        u2 = (u3 >> (shift - FLINT_BITS));
-                        u3 = 0;
+                        yrexp = MAG_EXP(yr);
+                        max_rad_exp = FLINT_MAX(max_rad_exp, xexp + yrexp);
+                        max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yrexp);
                     }
-
-                    if (xnegative ^ ynegative)
-                        sub_ddmmss(sum[1], sum[0], sum[1], sum[0], u3, u2);
-                    else
-                        add_ssaaaa(sum[1], sum[0], sum[1], sum[0], u3, u2);
                 }
-                else if (sn == 3)
+                else
                 {
-                    if (shift < FLINT_BITS)
-                    {
-                        serr += ((u1 << (FLINT_BITS - shift)) != 0) || (u0 != 0);
-                        u1 = (u1 >> shift) | (u2 << (FLINT_BITS - shift));
-                        u2 = (u2 >> shift) | (u3 << (FLINT_BITS - shift));
-                        u3 = (u3 >> shift);
-                    }
-                    else if (shift == FLINT_BITS)
-                    {
-                        serr += (u1 != 0) || (u0 != 0);
-                        u1 = u2;
-                        u2 = u3;
-                        u3 = 0;
-                    }
-                    else if (shift < 2 * FLINT_BITS)
-                    {
-                        serr += ((u2 << (2 * FLINT_BITS - shift)) != 0) || (u1 != 0) || (u0 != 0);
-                        u1 = (u3 << (2 * FLINT_BITS - shift)) | (u2 >> (shift - FLINT_BITS));
-                        u2 = (u3 >> (shift - FLINT_BITS));
-                        u3 = 0;
-                    }
-                    else if (shift == 2 * FLINT_BITS)
+                    if (!mag_is_special(yr))
                     {
-                        serr += (u2 != 0) || (u1 != 0) || (u0 != 0);
-                        u1 = u3;
-                        u2 = 0;
-                        u3 = 0;
+                        yrexp = MAG_EXP(yr);
+                        max_rad_exp = FLINT_MAX(max_rad_exp, xexp + yrexp);
                     }
-                    else  /* 2 * FLINT_BITS < shift < 3 * FLINT_BITS */
+                }
+            }
+            else  /* if y = 0, something can happen only if yr != 0 */
+            {
+                if (!mag_is_special(yr))
+                {
+                    yrexp = MAG_EXP(yr);
+                    max_rad_exp = FLINT_MAX(max_rad_exp, xexp + yrexp);
+
+                    if (!mag_is_special(xr))
                     {
-                        serr += ((u3 << (3 * FLINT_BITS - shift)) != 0) || (u2 != 0) || (u1 != 0) || (u0 != 0);
-                        u1 = (u3 >> (shift - 2 * FLINT_BITS));
-                        u2 = 0;
-                        u3 = 0;
+                        xrexp = MAG_EXP(xr);
+                        max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yrexp);
                     }
-
-                    if (xnegative ^ ynegative)
-                        sub_dddmmmsss(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
-                    else
-                        add_sssaaaaaa(sum[2], sum[1], sum[0], sum[2], sum[1], sum[0], u3, u2, u1);
                 }
             }
-            else
+        }
+        else  /* if x = 0, something can happen only if xr != 0 */
+        {
+            if (!mag_is_special(xr))
             {
-                mp_srcptr xptr, yptr;
-
-                xptr = (xn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(xm) : ARF_PTR_D(xm);
-                yptr = (yn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(ym) : ARF_PTR_D(ym);
+                xrexp = MAG_EXP(xr);
 
-                xtop = xptr[xn - 1];
-                ytop = yptr[yn - 1];
+                if (!arf_is_special(ym))
+                {
+                    yexp = ARF_EXP(ym);
+                    max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yexp);
+                }
 
-                _arb_dot_addmul_generic(sum, &serr, tmp, sn, xptr, xn, yptr, yn, xnegative ^ ynegative, shift);
+                if (!mag_is_special(yr))
+                {
+                    yrexp = MAG_EXP(yr);
+                    max_rad_exp = FLINT_MAX(max_rad_exp, xrexp + yrexp);
+                }
             }
+        }
+    }
 
-            xrad = MAG_MAN(xr);
-            yrad = MAG_MAN(yr);
+    /* The midpoint sum is zero. */
+    if (max_exp == WORD_MIN)
+    {
+        /* The sum is exactly zero. */
+        if (max_rad_exp == WORD_MIN)
+        {
+            arb_zero(res);
+            return;
+        }
 
-            if (xrad != 0 && yrad != 0)
-            {
-                xrexp = MAG_EXP(xr);
-                yrexp = MAG_EXP(yr);
+        prec = 2;
+    }
+    else
+    {
+        /* Reduce precision based on errors. */
+        if (max_rad_exp != WORD_MIN)
+            prec = FLINT_MIN(prec, max_exp - max_rad_exp + MAG_BITS);
 
-                RAD_ADDMUL(srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
-                RAD_ADDMUL(srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
-                RAD_ADDMUL(srad, srad_exp, xrad, yrad, xrexp + yrexp);
-            }
-            else if (xrad != 0)
-            {
-                xrexp = MAG_EXP(xr);
-                RAD_ADDMUL(srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
-            }
-            else if (yrad != 0)
-            {
-                yrexp = MAG_EXP(yr);
-                RAD_ADDMUL(srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
-            }
-        }
-        else
+        /* Reduce precision based on actual sizes. */
+        if (min_exp != WORD_MAX)
+            prec = FLINT_MIN(prec, max_exp - min_exp + MAG_BITS);
+
+        prec = FLINT_MAX(prec, 2);
+    }
+
+    /* Extend sum so that we can use two's complement addition. */
+    extend = FLINT_BIT_COUNT(nonzero) + 1;
+
+    /* Extra bits to improve accuracy (optional). */
+    padding = 4 + FLINT_BIT_COUNT(len);
+
+    /* Number of limbs. */
+    sn = (prec + extend + padding + FLINT_BITS - 1) / FLINT_BITS;
+
+    /* Avoid having to make a special case for sn = 1. */
+    sn = FLINT_MAX(sn, 2);
+
+    /* Exponent for the main sum. */
+    sum_exp = max_exp + extend;
+
+    /* We need sn + 1 limb for the sum (sn limbs + 1 dummy limb
+       for carry or borrow that avoids an extra branch). We need
+       2 * (sn + 2) limbs to store the product of two numbers
+       with up to (sn + 2) limbs, plus 1 extra limb for shifting
+       the product. */
+    alloc = (sn + 1) + 2 * (sn + 2) + 1;
+    ARF_ADD_TMP_ALLOC(sum, alloc)
+    tmp = sum + (sn + 1);
+
+    /* Sum of propagated errors. */
+    srad_exp = max_rad_exp;
+    srad = 0;
+
+    /* Set sum to 0 */
+    serr = 0;
+    for (j = 0; j < sn + 1; j++)
+        sum[j] = 0;
+
+    if (initial != NULL)
+    {
+        xm = arb_midref(initial);
+        xr = arb_radref(initial);
+
+        if (!arf_is_special(xm))
         {
-            xrad = MAG_MAN(xr);
-            yrad = MAG_MAN(yr);
+            mp_srcptr xptr;
 
             xexp = ARF_EXP(xm);
-            yexp = ARF_EXP(ym);
+            xn = ARF_SIZE(xm);
+            xnegative = ARF_SGNBIT(xm);
 
-            xrexp = MAG_EXP(xr);
-            yrexp = MAG_EXP(yr);
+            shift = sum_exp - xexp;
 
-            /* (xm+xr)(ym+yr) = xm ym + [xm yr + ym xr + xr yr] */
-            if (yrad && !arf_is_special(xm))
+            if (shift >= sn * FLINT_BITS)
             {
-                ARF_GET_TOP_LIMB(xtop, xm);
-                RAD_ADDMUL(srad, srad_exp, (xtop >> (FLINT_BITS - MAG_BITS)) + 1, yrad, xexp + yrexp);
+                serr++;
             }
-
-            if (xrad && !arf_is_special(ym))
+            else
             {
-                ARF_GET_TOP_LIMB(ytop, ym);
-                RAD_ADDMUL(srad, srad_exp, (ytop >> (FLINT_BITS - MAG_BITS)) + 1, xrad, yexp + xrexp);
+                xptr = (xn <= ARF_NOPTR_LIMBS) ? ARF_NOPTR_D(xm) : ARF_PTR_D(xm);
+                _arb_dot_add_generic(sum, &serr, tmp, sn, xptr, xn, xnegative ^ subtract, shift);
             }
+        }
 
-            if (xrad && yrad)
-            {
-                RAD_ADDMUL(srad, srad_exp, xrad, yrad, xrexp + yrexp);
-            }
+        if (!mag_is_special(xr))
+        {
+            xrad = MAG_MAN(xr);
+            xrexp = MAG_EXP(xr);
+
+            shift = srad_exp - xrexp;
+            if (shift < 64)
+                srad += (xrad >> shift) + 1;
+            else
+                srad++;
         }
     }
 
+    if (threaded)
+        _arb_dot_sum_terms_threaded(sum, &serr, &srad, tmp, sn, sum_exp, srad_exp,
+            x, xstep, y, ystep, len);
+    else
+        _arb_dot_sum_terms(sum, &serr, &srad, tmp, sn, sum_exp, srad_exp,
+            x, xstep, y, ystep, len);
+
     xnegative = 0;
     if (sum[sn - 1] >= LIMB_TOP)
     {
@@ -985,3 +1108,9 @@ arb_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep,
 
     ARF_ADD_TMP_FREE(sum, alloc);
 }
+
+void
+arb_dot(arb_t res, const arb_t initial, int subtract, arb_srcptr x, slong xstep, arb_srcptr y, slong ystep, slong len, slong prec)
+{
+    _arb_dot(res, initial, subtract, x, xstep, y, ystep, len, prec, 0);
+}
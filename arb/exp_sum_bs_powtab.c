@@ -268,11 +268,11 @@ bsplit2(fmpz_t T, fmpz_t Q, flint_bitcnt_t * Qexp,
 
     prec_hint = 2 * (b - a) * FLINT_MAX(r, 1);
 
-    if (prec_hint < 30000)
+    if (prec_hint < arb_tune_get(ARB_TUNE_EXP_SUM_BS_THREADS_2))
         max_threads = 1;
-    else if (prec_hint < 1000000)
+    else if (prec_hint < arb_tune_get(ARB_TUNE_EXP_SUM_BS_THREADS_4))
         max_threads = FLINT_MIN(2, max_threads);
-    else if (prec_hint < 5000000)
+    else if (prec_hint < arb_tune_get(ARB_TUNE_EXP_SUM_BS_THREADS_8))
         max_threads = FLINT_MIN(4, max_threads);
     else
         max_threads = FLINT_MIN(8, max_threads);
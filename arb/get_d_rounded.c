@@ -0,0 +1,41 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb.h"
+
+int
+arb_get_d_rounded(double * res, const arb_t x)
+{
+    arf_t t;
+    double a, b;
+
+    *res = arf_get_d(arb_midref(x), ARF_RND_NEAR);
+
+    if (arf_is_nan(arb_midref(x)))
+        return 0;
+
+    if (mag_is_zero(arb_radref(x)))
+        return 1;
+
+    if (!arb_is_finite(x))
+        return 0;
+
+    /* Rounding to nearest is monotone, so it suffices to check that
+       both endpoints (rounded outward) round to the same double. */
+    arf_init(t);
+    arb_get_lbound_arf(t, x, 2 * FLINT_BITS);
+    a = arf_get_d(t, ARF_RND_NEAR);
+    arb_get_ubound_arf(t, x, 2 * FLINT_BITS);
+    b = arf_get_d(t, ARF_RND_NEAR);
+    arf_clear(t);
+
+    return a == b;
+}
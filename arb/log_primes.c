@@ -13,6 +13,10 @@
 #include "flint/thread_support.h"
 #include "arb.h"
 
+#if FLINT_USES_PTHREAD
+#include <pthread.h>
+#endif
+
 #define HAVE_64_BIT (FLINT_BITS == 64)
 
 /* one coefficient doesn't fit in 64 bits */
@@ -463,6 +467,111 @@ arb_log_primes_vec_bsplit(arb_ptr res, slong n, slong prec)
     flint_free(primes);
 }
 
+/*
+    The caches below are thread-local. Entries computed by binary splitting
+    beyond the static tables are also published in a process-wide snapshot,
+    so that other threads (for example the workers of a vector function)
+    can copy them instead of computing them again. The snapshot is only
+    accessed while holding its lock, and threads only read their own copies.
+
+    FLINT runs cleanup functions per thread, so the snapshot cannot simply
+    be registered for cleanup by whichever thread publishes it first.
+    Instead, each thread that touches the snapshot holds a reference to it,
+    which is dropped by that thread's cleanup function; the snapshot is
+    freed when the last reference goes away.
+
+    The snapshot only ever grows, and a thread copies it at whatever
+    precision it has reached, so the precision of the cached entries
+    depends on the history of calls in the process.
+*/
+
+typedef struct
+{
+    arb_ptr vec;
+    slong len;
+    slong prec;
+    slong users;
+}
+shared_cache_struct;
+
+static int
+shared_cache_get(arb_ptr res, slong * res_prec, shared_cache_struct * S,
+    slong prec)
+{
+    int found = 0;
+
+    if (S->prec >= prec)
+    {
+        _arb_vec_set(res, S->vec, S->len);
+        *res_prec = S->prec;
+        found = 1;
+    }
+
+    return found;
+}
+
+static void
+shared_cache_put(shared_cache_struct * S, arb_srcptr vec, slong prec)
+{
+    if (S->prec < prec)
+    {
+        if (S->vec == NULL)
+            S->vec = _arb_vec_init(S->len);
+
+        _arb_vec_set(S->vec, vec, S->len);
+        S->prec = prec;
+    }
+}
+
+static void
+shared_cache_clear(shared_cache_struct * S)
+{
+    if (S->vec != NULL)
+    {
+        _arb_vec_clear(S->vec, S->len);
+        S->vec = NULL;
+    }
+
+    S->prec = 0;
+}
+
+/* The caller holds the lock; *attached is the thread-local reference flag. */
+static void
+shared_cache_attach(shared_cache_struct * S, int * attached)
+{
+    if (!*attached)
+    {
+        S->users++;
+        *attached = 1;
+    }
+}
+
+static void
+shared_cache_detach(shared_cache_struct * S, int * attached)
+{
+    if (*attached)
+    {
+        S->users--;
+        if (S->users == 0)
+            shared_cache_clear(S);
+        *attached = 0;
+    }
+}
+
+#if FLINT_USES_PTHREAD
+#define SHARED_LOCK(lock) pthread_mutex_lock(&(lock))
+#define SHARED_UNLOCK(lock) pthread_mutex_unlock(&(lock))
+#else
+#define SHARED_LOCK(lock)
+#define SHARED_UNLOCK(lock)
+#endif
+
+#if FLINT_USES_PTHREAD
+static pthread_mutex_t _arb_log_p_shared_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+static shared_cache_struct _arb_log_p_shared = { NULL, ARB_LOG_PRIME_CACHE_NUM, 0, 0 };
+FLINT_TLS_PREFIX int _arb_log_p_shared_attached = 0;
+
 FLINT_TLS_PREFIX arb_struct _arb_log_p_cache[ARB_LOG_PRIME_CACHE_NUM];
 FLINT_TLS_PREFIX slong _arb_log_p_cache_prec = 0;
 
@@ -472,6 +581,10 @@ void _arb_log_p_cleanup(void)
     for (i = 0; i < ARB_LOG_PRIME_CACHE_NUM; i++)
         arb_clear(_arb_log_p_cache + i);
     _arb_log_p_cache_prec = 0;
+
+    SHARED_LOCK(_arb_log_p_shared_lock);
+    shared_cache_detach(&_arb_log_p_shared, &_arb_log_p_shared_attached);
+    SHARED_UNLOCK(_arb_log_p_shared_lock);
 }
 
 arb_srcptr _arb_log_p_cache_vec(void)
@@ -521,9 +634,23 @@ void _arb_log_p_ensure_cached(slong prec)
         }
         else
         {
+            int found;
+
             prec = FLINT_MAX(prec, _arb_log_p_cache_prec * 1.25);
 
-            arb_log_primes_vec_bsplit(_arb_log_p_cache, ARB_LOG_PRIME_CACHE_NUM, prec + 32);
+            SHARED_LOCK(_arb_log_p_shared_lock);
+            shared_cache_attach(&_arb_log_p_shared, &_arb_log_p_shared_attached);
+            found = shared_cache_get(_arb_log_p_cache, &prec, &_arb_log_p_shared, prec);
+            SHARED_UNLOCK(_arb_log_p_shared_lock);
+
+            if (!found)
+            {
+                arb_log_primes_vec_bsplit(_arb_log_p_cache, ARB_LOG_PRIME_CACHE_NUM, prec + 32);
+
+                SHARED_LOCK(_arb_log_p_shared_lock);
+                shared_cache_put(&_arb_log_p_shared, _arb_log_p_cache, prec);
+                SHARED_UNLOCK(_arb_log_p_shared_lock);
+            }
         }
 
         _arb_log_p_cache_prec = prec;
@@ -684,6 +811,12 @@ arb_atan_gauss_primes_vec_bsplit(arb_ptr res, slong n, slong prec)
     fmpz_clear(q);
 }
 
+#if FLINT_USES_PTHREAD
+static pthread_mutex_t _arb_atan_gauss_p_shared_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+static shared_cache_struct _arb_atan_gauss_p_shared = { NULL, ARB_ATAN_GAUSS_PRIME_CACHE_NUM, 0, 0 };
+FLINT_TLS_PREFIX int _arb_atan_gauss_p_shared_attached = 0;
+
 FLINT_TLS_PREFIX arb_struct _arb_atan_gauss_p_cache[ARB_ATAN_GAUSS_PRIME_CACHE_NUM];
 FLINT_TLS_PREFIX slong _arb_atan_gauss_p_cache_prec = 0;
 
@@ -693,6 +826,10 @@ void _arb_atan_gauss_p_cleanup(void)
     for (i = 0; i < ARB_ATAN_GAUSS_PRIME_CACHE_NUM; i++)
         arb_clear(_arb_atan_gauss_p_cache + i);
     _arb_atan_gauss_p_cache_prec = 0;
+
+    SHARED_LOCK(_arb_atan_gauss_p_shared_lock);
+    shared_cache_detach(&_arb_atan_gauss_p_shared, &_arb_atan_gauss_p_shared_attached);
+    SHARED_UNLOCK(_arb_atan_gauss_p_shared_lock);
 }
 
 arb_srcptr _arb_atan_gauss_p_cache_vec(void)
@@ -745,10 +882,24 @@ void _arb_atan_gauss_p_ensure_cached(slong prec)
         }
         else
         {
+            int found;
+
             prec = FLINT_MAX(prec, _arb_atan_gauss_p_cache_prec * 1.25);
 
-            arb_atan_gauss_primes_vec_bsplit(_arb_atan_gauss_p_cache, ARB_ATAN_GAUSS_PRIME_CACHE_NUM, prec + 32);
-            _arb_vec_scalar_mul_2exp_si(_arb_atan_gauss_p_cache, _arb_atan_gauss_p_cache, ARB_ATAN_GAUSS_PRIME_CACHE_NUM, 1);
+            SHARED_LOCK(_arb_atan_gauss_p_shared_lock);
+            shared_cache_attach(&_arb_atan_gauss_p_shared, &_arb_atan_gauss_p_shared_attached);
+            found = shared_cache_get(_arb_atan_gauss_p_cache, &prec, &_arb_atan_gauss_p_shared, prec);
+            SHARED_UNLOCK(_arb_atan_gauss_p_shared_lock);
+
+            if (!found)
+            {
+                arb_atan_gauss_primes_vec_bsplit(_arb_atan_gauss_p_cache, ARB_ATAN_GAUSS_PRIME_CACHE_NUM, prec + 32);
+                _arb_vec_scalar_mul_2exp_si(_arb_atan_gauss_p_cache, _arb_atan_gauss_p_cache, ARB_ATAN_GAUSS_PRIME_CACHE_NUM, 1);
+
+                SHARED_LOCK(_arb_atan_gauss_p_shared_lock);
+                shared_cache_put(&_arb_atan_gauss_p_shared, _arb_atan_gauss_p_cache, prec);
+                SHARED_UNLOCK(_arb_atan_gauss_p_shared_lock);
+            }
         }
 
         _arb_atan_gauss_p_cache_prec = prec;
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "arb.h"
 
 #define TERMINATOR -32768
@@ -303,19 +304,117 @@ _arb_log_reduce_fixed(slong * rel, const short * d, const double * epsilon, cons
     flint_free(new_rel);
 }
 
+/* Powers p^e that occur for more than one argument in a batch. The keys
+   e * n + i (for the i-th prime) are sorted; the values are stored with
+   a stride of one fmpz (integer primes) or two fmpz (Gaussian primes). */
+typedef struct
+{
+    slong * keys;
+    fmpz * vals;
+    slong num;
+    slong n;
+}
+rel_pow_cache_struct;
+
+typedef rel_pow_cache_struct rel_pow_cache_t[1];
+
+static int
+slong_cmp(const void * a, const void * b)
+{
+    slong x = *((const slong *) a);
+    slong y = *((const slong *) b);
+    return (x > y) - (x < y);
+}
+
+/* Finds the exponents of primes 1, ..., n - 1 that are repeated in the
+   given relations and allocates the cache. */
+static void
+rel_pow_cache_init(rel_pow_cache_t cache, const slong * rels,
+    slong len, slong n, slong stride)
+{
+    slong i, j, k, num;
+    slong * keys;
+    ulong e;
+
+    keys = flint_malloc(sizeof(slong) * FLINT_MAX(len * (n - 1), 1));
+
+    num = 0;
+    for (k = 0; k < len; k++)
+    {
+        for (i = 1; i < n; i++)
+        {
+            e = FLINT_ABS(rels[k * n + i]);
+
+            if (e >= 2)
+                keys[num++] = e * n + i;
+        }
+    }
+
+    qsort(keys, num, sizeof(slong), slong_cmp);
+
+    /* keep one copy of each repeated key */
+    for (i = j = 0; i < num; )
+    {
+        for (k = i + 1; k < num && keys[k] == keys[i]; k++) ;
+
+        if (k - i >= 2)
+            keys[j++] = keys[i];
+
+        i = k;
+    }
+
+    cache->keys = keys;
+    cache->num = j;
+    cache->n = n;
+    cache->vals = _fmpz_vec_init(stride * FLINT_MAX(j, 1));
+}
+
 static void
-rel_product(fmpz_t p, fmpz_t q, const short * primes, const slong * rel, slong len)
+rel_pow_cache_clear(rel_pow_cache_t cache, slong stride)
+{
+    _fmpz_vec_clear(cache->vals, stride * FLINT_MAX(cache->num, 1));
+    flint_free(cache->keys);
+}
+
+static const fmpz *
+rel_pow_cache_lookup(const rel_pow_cache_struct * cache, slong i, ulong e,
+    slong stride)
+{
+    slong key, * ptr;
+
+    if (cache == NULL || cache->num == 0)
+        return NULL;
+
+    key = e * cache->n + i;
+    ptr = bsearch(&key, cache->keys, cache->num, sizeof(slong), slong_cmp);
+
+    if (ptr == NULL)
+        return NULL;
+
+    return cache->vals + stride * (ptr - cache->keys);
+}
+
+/* The primes are indexed from offset in the cache. */
+static void
+rel_product(fmpz_t p, fmpz_t q, const short * primes, const slong * rel, slong len,
+    const rel_pow_cache_struct * cache, slong offset)
 {
     slong i;
 
     if (len <= 4)
     {
+        const fmpz * c;
         fmpz_t r;
         fmpz_init(r);
 
         for (i = 0; i < len; i++)
         {
-            fmpz_ui_pow_ui(r, primes[i], FLINT_ABS(rel[i]));
+            c = rel_pow_cache_lookup(cache, offset + i, FLINT_ABS(rel[i]), 1);
+
+            if (c != NULL)
+                fmpz_set(r, c);
+            else
+                fmpz_ui_pow_ui(r, primes[i], FLINT_ABS(rel[i]));
 
             if (rel[i] >= 0)
                 fmpz_mul(p, p, r);
@@ -332,8 +431,9 @@ rel_product(fmpz_t p, fmpz_t q, const short * primes, const slong * rel, slong l
         fmpz_init_set_ui(p2, 1);
         fmpz_init_set_ui(q2, 1);
 
-        rel_product(p, q, primes, rel, len / 2);
-        rel_product(p2, q2, primes + len / 2, rel + len / 2, len - len / 2);
+        rel_product(p, q, primes, rel, len / 2, cache, offset);
+        rel_product(p2, q2, primes + len / 2, rel + len / 2, len - len / 2,
+            cache, offset + len / 2);
 
         fmpz_mul(p, p, p2);
         fmpz_mul(q, q, q2);
@@ -343,20 +443,26 @@ rel_product(fmpz_t p, fmpz_t q, const short * primes, const slong * rel, slong l
     }
 }
 
-/* todo: error propagation */
-void
-_arb_exp_arf_precomp(arb_t res, const arf_t x, slong prec, int minus_one,
-    slong num_logs, arb_srcptr logs, const short * primes,
-    const float * weights,
-    const short * log_rel_d,
-    const double * epsilon, const double * epsilon_inv, double max_weight)
+static slong
+_arb_log_reduce_wp(slong prec)
+{
+    if (prec <= 10000)
+        return 256;
+    else if (prec <= 100000)
+        return 512;
+    else
+        return 768;
+}
+
+/* Given the relation rel, computes the final result. */
+static void
+_arb_exp_arf_precomp_finish(arb_t res, const arf_t x, slong prec, int minus_one,
+    slong num_logs, arb_srcptr logs, const short * primes, const slong * rel,
+    const rel_pow_cache_struct * cache)
 {
     arb_t t;
-    fmpz_t p, r, q;
+    fmpz_t p, q;
     slong wp;
-    slong * rel;
-    slong i;
-    fmpz * alpha;
     slong mag;
     mag_t err, err2;
 
@@ -364,28 +470,6 @@ _arb_exp_arf_precomp(arb_t res, const arf_t x, slong prec, int minus_one,
 
     arb_init(t);
 
-    rel = flint_malloc(num_logs * sizeof(slong));
-
-    alpha = _fmpz_vec_init(num_logs);
-    fmpz_init(r);
-
-    if (prec <= 10000)
-        wp = 256;
-    else if (prec <= 100000)
-        wp = 512;
-    else
-        wp = 768;
-
-    for (i = 0; i < num_logs; i++)
-        arf_get_fmpz_fixed_si(alpha + i, arb_midref(logs + i), -wp);
-
-    arf_get_fmpz_fixed_si(r, x, -wp);
-    _arb_log_reduce_fixed(rel, log_rel_d, epsilon, epsilon_inv,
-        alpha, weights, num_logs, r, wp, max_weight);
-
-    fmpz_clear(r);
-    _fmpz_vec_clear(alpha, num_logs);
-
     wp = prec + 5 + 2 * FLINT_BIT_COUNT(prec);
     if (minus_one && mag < 0)
         wp += (-mag);
@@ -410,7 +494,7 @@ _arb_exp_arf_precomp(arb_t res, const arf_t x, slong prec, int minus_one,
 
     fmpz_one(p);
     fmpz_one(q);
-    rel_product(p, q, primes + 1, rel + 1, num_logs - 1);
+    rel_product(p, q, primes + 1, rel + 1, num_logs - 1, cache, 1);
 
     arb_mul_fmpz(res, res, p, wp);
     arb_div_fmpz(res, res, q, wp);
@@ -421,13 +505,48 @@ _arb_exp_arf_precomp(arb_t res, const arf_t x, slong prec, int minus_one,
     else
         arb_set_round(res, res, prec);
 
-    flint_free(rel);
-
     fmpz_clear(p);
     fmpz_clear(q);
     arb_clear(t);
 }
 
+/* todo: error propagation */
+void
+_arb_exp_arf_precomp(arb_t res, const arf_t x, slong prec, int minus_one,
+    slong num_logs, arb_srcptr logs, const short * primes,
+    const float * weights,
+    const short * log_rel_d,
+    const double * epsilon, const double * epsilon_inv, double max_weight)
+{
+    fmpz_t r;
+    slong wp;
+    slong * rel;
+    slong i;
+    fmpz * alpha;
+
+    rel = flint_malloc(num_logs * sizeof(slong));
+
+    alpha = _fmpz_vec_init(num_logs);
+    fmpz_init(r);
+
+    wp = _arb_log_reduce_wp(prec);
+
+    for (i = 0; i < num_logs; i++)
+        arf_get_fmpz_fixed_si(alpha + i, arb_midref(logs + i), -wp);
+
+    arf_get_fmpz_fixed_si(r, x, -wp);
+    _arb_log_reduce_fixed(rel, log_rel_d, epsilon, epsilon_inv,
+        alpha, weights, num_logs, r, wp, max_weight);
+
+    fmpz_clear(r);
+    _fmpz_vec_clear(alpha, num_logs);
+
+    _arb_exp_arf_precomp_finish(res, x, prec, minus_one,
+        num_logs, logs, primes, rel, NULL);
+
+    flint_free(rel);
+}
+
 void arb_exp_arf_huge(arb_t z, const arf_t x, slong mag, slong prec, int minus_one);
 
 void
@@ -737,19 +856,31 @@ static const float small_gaussian_prime_weights[] = {
 #include "acb.h"
 
 static void
-gaussian_rel_product(fmpzi_t p, fmpzi_t q, const char * primes, const slong * rel, slong len)
+gaussian_rel_product(fmpzi_t p, fmpzi_t q, const char * primes, const slong * rel, slong len,
+    const rel_pow_cache_struct * cache, slong offset)
 {
     slong i;
 
     if (len <= 4)
     {
+        const fmpz * c;
         fmpzi_t r;
         fmpzi_init(r);
 
         for (i = 0; i < len; i++)
         {
-            fmpzi_set_si_si(r, primes[2 * i], primes[2 * i + 1]);
-            fmpzi_pow_ui(r, r, FLINT_ABS(rel[i]));
+            c = rel_pow_cache_lookup(cache, offset + i, FLINT_ABS(rel[i]), 2);
+
+            if (c != NULL)
+            {
+                fmpz_set(fmpzi_realref(r), c);
+                fmpz_set(fmpzi_imagref(r), c + 1);
+            }
+            else
+            {
+                fmpzi_set_si_si(r, primes[2 * i], primes[2 * i + 1]);
+                fmpzi_pow_ui(r, r, FLINT_ABS(rel[i]));
+            }
 
             if (rel[i] >= 0)
                 fmpzi_mul(p, p, r);
@@ -769,8 +900,9 @@ gaussian_rel_product(fmpzi_t p, fmpzi_t q, const char * primes, const slong * re
         fmpzi_one(p2);
         fmpzi_one(q2);
 
-        gaussian_rel_product(p, q, primes, rel, len / 2);
-        gaussian_rel_product(p2, q2, primes + 2 * (len / 2), rel + len / 2, len - len / 2);
+        gaussian_rel_product(p, q, primes, rel, len / 2, cache, offset);
+        gaussian_rel_product(p2, q2, primes + 2 * (len / 2), rel + len / 2, len - len / 2,
+            cache, offset + len / 2);
 
         fmpzi_mul(p, p, p2);
         fmpzi_mul(q, q, q2);
@@ -780,55 +912,19 @@ gaussian_rel_product(fmpzi_t p, fmpzi_t q, const char * primes, const slong * re
     }
 }
 
-void
-_arb_sin_cos_arf_precomp(arb_t res1, arb_t res2, const arf_t x, slong prec,
-    slong num_logs, arb_srcptr logs, const char * primes,
-    const float * weights,
-    const short * log_rel_d,
-    const double * epsilon, const double * epsilon_inv, double max_weight)
+/* Given the relation rel, computes the final result. */
+static void
+_arb_sin_cos_arf_precomp_finish(arb_t res1, arb_t res2, const arf_t x, slong prec,
+    slong num_logs, arb_srcptr logs, const slong * rel,
+    const rel_pow_cache_struct * cache)
 {
     arb_t t;
     acb_t u, v;
     slong wp;
-    slong * rel;
-    slong i;
-    fmpz * alpha;
-    fmpz_t r;
     slong mag;
 
     arb_init(t);
 
-    rel = flint_malloc(num_logs * sizeof(slong));
-
-    alpha = _fmpz_vec_init(num_logs);
-    fmpz_init(r);
-
-    if (prec <= 10000)
-        wp = 256;
-    else if (prec <= 100000)
-        wp = 512;
-    else
-        wp = 768;
-
-    for (i = 0; i < num_logs; i++)
-        arf_get_fmpz_fixed_si(alpha + i, arb_midref(logs + i), -wp);
-
-    arf_get_fmpz_fixed_si(r, x, -wp);
-    _arb_log_reduce_fixed(rel, log_rel_d, epsilon, epsilon_inv,
-        alpha, weights, num_logs, r, wp, max_weight);
-
-/*
-    {
-        slong i;
-        for (i = 0; i < num_logs; i++)
-            printf("%ld ", rel[i]);
-        printf("\n");
-    }
-*/
-
-    fmpz_clear(r);
-    _fmpz_vec_clear(alpha, num_logs);
-
     wp = prec + 5 + 2 * FLINT_BIT_COUNT(prec);
 
     mag = arf_abs_bound_lt_2exp_si(x);
@@ -857,7 +953,7 @@ _arb_sin_cos_arf_precomp(arb_t res1, arb_t res2, const arf_t x, slong prec,
         fmpzi_one(p);
         fmpzi_one(q);
 
-        gaussian_rel_product(p, q, small_gaussian_primes + 2, rel + 1, num_logs - 1);
+        gaussian_rel_product(p, q, small_gaussian_primes + 2, rel + 1, num_logs - 1, cache, 1);
 
         fmpzi_conj(r, p);
         fmpzi_conj(s, q);
@@ -894,13 +990,55 @@ _arb_sin_cos_arf_precomp(arb_t res1, arb_t res2, const arf_t x, slong prec,
     if (res2 != NULL)
         arb_set_round(res2, acb_realref(u), prec);
 
-    flint_free(rel);
-
     arb_clear(t);
     acb_clear(u);
     acb_clear(v);
 }
 
+void
+_arb_sin_cos_arf_precomp(arb_t res1, arb_t res2, const arf_t x, slong prec,
+    slong num_logs, arb_srcptr logs, const char * primes,
+    const float * weights,
+    const short * log_rel_d,
+    const double * epsilon, const double * epsilon_inv, double max_weight)
+{
+    slong wp;
+    slong * rel;
+    slong i;
+    fmpz * alpha;
+    fmpz_t r;
+
+    rel = flint_malloc(num_logs * sizeof(slong));
+
+    alpha = _fmpz_vec_init(num_logs);
+    fmpz_init(r);
+
+    wp = _arb_log_reduce_wp(prec);
+
+    for (i = 0; i < num_logs; i++)
+        arf_get_fmpz_fixed_si(alpha + i, arb_midref(logs + i), -wp);
+
+    arf_get_fmpz_fixed_si(r, x, -wp);
+    _arb_log_reduce_fixed(rel, log_rel_d, epsilon, epsilon_inv,
+        alpha, weights, num_logs, r, wp, max_weight);
+
+/*
+    {
+        slong i;
+        for (i = 0; i < num_logs; i++)
+            printf("%ld ", rel[i]);
+        printf("\n");
+    }
+*/
+
+    fmpz_clear(r);
+    _fmpz_vec_clear(alpha, num_logs);
+
+    _arb_sin_cos_arf_precomp_finish(res1, res2, x, prec, num_logs, logs, rel, NULL);
+
+    flint_free(rel);
+}
+
 void
 arb_sin_cos_arf_atan_reduction(arb_t res1, arb_t res2, const arf_t x, slong prec)
 {
@@ -935,3 +1073,247 @@ arb_sin_cos_arf_atan_reduction(arb_t res1, arb_t res2, const arf_t x, slong prec
         atan_rel_d,
         atan_rel_epsilon, atan_rel_epsilon_inv, 0.5 * prec);
 }
+
+/* Batched evaluation: the relations for all arguments are computed first,
+   after which prime powers occurring in several relations are computed
+   once and shared. */
+
+typedef struct
+{
+    arb_ptr res1;
+    arb_ptr res2;
+    arf_srcptr x;
+    const char * reduce;
+    slong * rels;
+    const fmpz * alpha;
+    slong alpha_prec;
+    arb_srcptr logs;
+    slong num_logs;
+    slong prec;
+    int minus_one;
+    int trig;
+    const rel_pow_cache_struct * cache;
+}
+reduce_vec_work_t;
+
+static void
+reduce_vec_rel_worker(slong k, reduce_vec_work_t * work)
+{
+    fmpz_t r;
+
+    if (!work->reduce[k])
+        return;
+
+    fmpz_init(r);
+    arf_get_fmpz_fixed_si(r, work->x + k, -work->alpha_prec);
+
+    if (work->trig)
+        _arb_log_reduce_fixed(work->rels + k * work->num_logs, atan_rel_d,
+            atan_rel_epsilon, atan_rel_epsilon_inv, work->alpha,
+            small_gaussian_prime_weights, work->num_logs, r,
+            work->alpha_prec, 0.5 * work->prec);
+    else
+        _arb_log_reduce_fixed(work->rels + k * work->num_logs, log_rel_d,
+            log_rel_epsilon, log_rel_epsilon_inv, work->alpha,
+            log_weights, work->num_logs, r,
+            work->alpha_prec, work->prec);
+
+    fmpz_clear(r);
+}
+
+/* Arguments that are not reduced use the scalar fallback. This must
+   be done before the pointer to the prime table is fetched, since the
+   fallback may resize the table. */
+static void
+reduce_vec_fallback_worker(slong k, reduce_vec_work_t * work)
+{
+    arb_ptr res1, res2;
+
+    if (work->reduce[k])
+        return;
+
+    res1 = (work->res1 == NULL) ? NULL : work->res1 + k;
+    res2 = (work->res2 == NULL) ? NULL : work->res2 + k;
+
+    if (work->trig)
+        arb_sin_cos_arf_atan_reduction(res1, res2, work->x + k, work->prec);
+    else
+        arb_exp_arf_log_reduction(res1, work->x + k, work->prec, work->minus_one);
+}
+
+static void
+reduce_vec_finish_worker(slong k, reduce_vec_work_t * work)
+{
+    arb_ptr res1, res2;
+
+    if (!work->reduce[k])
+        return;
+
+    res1 = (work->res1 == NULL) ? NULL : work->res1 + k;
+    res2 = (work->res2 == NULL) ? NULL : work->res2 + k;
+
+    if (work->trig)
+        _arb_sin_cos_arf_precomp_finish(res1, res2, work->x + k, work->prec,
+            work->num_logs, work->logs, work->rels + k * work->num_logs,
+            work->cache);
+    else
+        _arb_exp_arf_precomp_finish(res1, work->x + k, work->prec,
+            work->minus_one, work->num_logs, work->logs, small_primes,
+            work->rels + k * work->num_logs, work->cache);
+}
+
+static void
+reduce_vec_parallel_do(do_func_t f, reduce_vec_work_t * work, slong len)
+{
+    slong k;
+
+    if (len >= ARB_VEC_THREAD_MIN_LEN && arb_flint_get_num_available_threads() > 1)
+    {
+        flint_parallel_do(f, work, len, -1, FLINT_PARALLEL_STRIDED);
+    }
+    else
+    {
+        for (k = 0; k < len; k++)
+            f(k, work);
+    }
+}
+
+static void
+_arb_reduce_vec(arb_ptr res1, arb_ptr res2, arf_srcptr x, slong len,
+    slong prec, int minus_one, int trig)
+{
+    reduce_vec_work_t work;
+    rel_pow_cache_t cache;
+    char * reduce;
+    slong * rels;
+    fmpz * alpha;
+    slong i, j, k, n, e, mag, wp, max_wp, stride;
+    fmpzi_t t;
+
+    if (len <= 0)
+        return;
+
+    n = trig ? ARB_ATAN_GAUSS_PRIME_CACHE_NUM : ARB_LOG_PRIME_CACHE_NUM;
+    stride = trig ? 2 : 1;
+
+    /* Decide which arguments use the reduction; the same conditions
+       as in the scalar functions. */
+    reduce = flint_malloc(len);
+    max_wp = 0;
+
+    for (k = 0; k < len; k++)
+    {
+        mag = arf_abs_bound_lt_2exp_si(x + k);
+
+        reduce[k] = !(mag < -prec / 16 || mag < -768 || arf_bits(x + k) < prec / 128)
+            && !((FLINT_BITS == 32 && mag > 20) || (FLINT_BITS == 64 && mag > 40));
+
+        if (reduce[k])
+        {
+            wp = prec + 5 + 2 * FLINT_BIT_COUNT(prec);
+
+            if (trig)
+            {
+                if (mag > 0)
+                    wp += mag;
+            }
+            else
+            {
+                wp += FLINT_BITS;
+                if (minus_one && mag < 0)
+                    wp += (-mag);
+                else if (mag > 0)
+                    wp += mag;
+            }
+
+            max_wp = FLINT_MAX(max_wp, wp);
+        }
+    }
+
+    work.res1 = res1;
+    work.res2 = res2;
+    work.x = x;
+    work.reduce = reduce;
+    work.num_logs = n;
+    work.prec = prec;
+    work.minus_one = minus_one;
+    work.trig = trig;
+    work.cache = NULL;
+
+    reduce_vec_parallel_do((do_func_t) reduce_vec_fallback_worker, &work, len);
+
+    if (max_wp == 0)
+    {
+        flint_free(reduce);
+        return;
+    }
+
+    if (trig)
+    {
+        _arb_atan_gauss_p_ensure_cached(max_wp);
+        work.logs = _arb_atan_gauss_p_cache_vec();
+    }
+    else
+    {
+        _arb_log_p_ensure_cached(max_wp);
+        work.logs = _arb_log_p_cache_vec();
+    }
+
+    work.alpha_prec = _arb_log_reduce_wp(prec);
+    alpha = _fmpz_vec_init(n);
+    for (i = 0; i < n; i++)
+        arf_get_fmpz_fixed_si(alpha + i, arb_midref(work.logs + i), -work.alpha_prec);
+    work.alpha = alpha;
+
+    rels = flint_calloc(len * n, sizeof(slong));
+    work.rels = rels;
+
+    reduce_vec_parallel_do((do_func_t) reduce_vec_rel_worker, &work, len);
+
+    /* Precompute the shared prime powers. */
+    rel_pow_cache_init(cache, rels, len, n, stride);
+
+    fmpzi_init(t);
+
+    for (j = 0; j < cache->num; j++)
+    {
+        i = cache->keys[j] % n;
+        e = cache->keys[j] / n;
+
+        if (trig)
+        {
+            fmpzi_set_si_si(t, small_gaussian_primes[2 * i], small_gaussian_primes[2 * i + 1]);
+            fmpzi_pow_ui(t, t, e);
+            fmpz_swap(cache->vals + 2 * j, fmpzi_realref(t));
+            fmpz_swap(cache->vals + 2 * j + 1, fmpzi_imagref(t));
+        }
+        else
+        {
+            fmpz_ui_pow_ui(cache->vals + j, small_primes[i], e);
+        }
+    }
+
+    fmpzi_clear(t);
+
+    work.cache = cache;
+    reduce_vec_parallel_do((do_func_t) reduce_vec_finish_worker, &work, len);
+
+    rel_pow_cache_clear(cache, stride);
+    _fmpz_vec_clear(alpha, n);
+    flint_free(rels);
+    flint_free(reduce);
+}
+
+void
+arb_exp_arf_log_reduction_vec(arb_ptr res, arf_srcptr x, slong len,
+    slong prec, int minus_one)
+{
+    _arb_reduce_vec(res, NULL, x, len, prec, minus_one, 0);
+}
+
+void
+arb_sin_cos_arf_atan_reduction_vec(arb_ptr res1, arb_ptr res2,
+    arf_srcptr x, slong len, slong prec)
+{
+    _arb_reduce_vec(res1, res2, x, len, prec, 0, 1);
+}
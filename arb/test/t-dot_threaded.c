@@ -0,0 +1,107 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("dot_threaded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 30 * arb_test_multiplier(); iter++)
+    {
+        arb_ptr x, y;
+        arb_t s, r1, r2, r3;
+        slong i, len, prec, xstep, ystep;
+        int subtract, initial;
+
+        len = n_randint(state, 4 * ARB_DOT_THREAD_CHUNK);
+        prec = 2 + n_randint(state, 300);
+        subtract = n_randint(state, 2);
+        initial = n_randint(state, 2);
+        xstep = n_randint(state, 2) ? 1 : -1;
+        ystep = n_randint(state, 2) ? 1 : -1;
+
+        x = _arb_vec_init(len);
+        y = _arb_vec_init(len);
+        arb_init(s);
+        arb_init(r1);
+        arb_init(r2);
+        arb_init(r3);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_randtest(x + i, state, 1 + n_randint(state, 200), 10);
+            arb_randtest(y + i, state, 1 + n_randint(state, 200), 10);
+        }
+
+        arb_randtest(s, state, 200, 10);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        arb_dot_threaded(r1, initial ? s : NULL, subtract,
+            xstep == 1 ? x : x + len - 1, xstep,
+            ystep == 1 ? y : y + len - 1, ystep, len, prec);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        arb_dot_threaded(r2, initial ? s : NULL, subtract,
+            xstep == 1 ? x : x + len - 1, xstep,
+            ystep == 1 ? y : y + len - 1, ystep, len, prec);
+
+        arb_dot(r3, initial ? s : NULL, subtract,
+            xstep == 1 ? x : x + len - 1, xstep,
+            ystep == 1 ? y : y + len - 1, ystep, len, prec);
+
+        if (!arb_equal(r1, r2) || !arb_equal(r1, r3))
+        {
+            flint_printf("FAIL\n\n");
+            flint_printf("len = %wd, prec = %wd\n\n", len, prec);
+            flint_printf("r1 = "); arb_printd(r1, 30); flint_printf("\n\n");
+            flint_printf("r2 = "); arb_printd(r2, 30); flint_printf("\n\n");
+            flint_printf("r3 = "); arb_printd(r3, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        /* approximate version */
+        flint_set_num_threads(1 + n_randint(state, 4));
+        arb_approx_dot_threaded(r1, initial ? s : NULL, subtract, x, 1, y, 1, len, prec);
+        flint_set_num_threads(1 + n_randint(state, 4));
+        arb_approx_dot_threaded(r2, initial ? s : NULL, subtract, x, 1, y, 1, len, prec);
+        arb_approx_dot(r3, initial ? s : NULL, subtract, x, 1, y, 1, len, prec);
+
+        if (!arf_equal(arb_midref(r1), arb_midref(r2)) ||
+            !arf_equal(arb_midref(r1), arb_midref(r3)))
+        {
+            flint_printf("FAIL (approx)\n\n");
+            flint_printf("len = %wd, prec = %wd\n\n", len, prec);
+            flint_printf("r1 = "); arb_printd(r1, 30); flint_printf("\n\n");
+            flint_printf("r2 = "); arb_printd(r2, 30); flint_printf("\n\n");
+            flint_printf("r3 = "); arb_printd(r3, 30); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        _arb_vec_clear(x, len);
+        _arb_vec_clear(y, len);
+        arb_clear(s);
+        arb_clear(r1);
+        arb_clear(r2);
+        arb_clear(r3);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
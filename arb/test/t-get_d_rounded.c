@@ -0,0 +1,84 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("get_d_rounded....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100000 * arb_test_multiplier(); iter++)
+    {
+        arb_t x;
+        arf_t t;
+        double d, a, b;
+        int ok;
+
+        arb_init(x);
+        arf_init(t);
+
+        if (n_randint(state, 2))
+        {
+            /* a double with a tiny radius always succeeds */
+            arf_randtest(t, state, 53, 7);
+            d = arf_get_d(t, ARF_RND_DOWN);
+
+            arb_set_d(x, d);
+            if (d != 0.0)
+                mag_set_ui_2exp_si(arb_radref(x), 1, arf_abs_bound_lt_2exp_si(arb_midref(x)) - 60 - n_randint(state, 100));
+
+            if (!arb_get_d_rounded(&a, x) || a != d)
+            {
+                flint_printf("FAIL (double)\n\n");
+                flint_printf("x = "); arb_printd(x, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+        else
+        {
+            arb_randtest(x, state, 1 + n_randint(state, 200), 1 + n_randint(state, 12));
+
+            ok = arb_get_d_rounded(&d, x);
+
+            if (ok && arb_is_finite(x))
+            {
+                arf_set_mag(t, arb_radref(x));
+                arf_sub(t, arb_midref(x), t, ARF_PREC_EXACT, ARF_RND_DOWN);
+                a = arf_get_d(t, ARF_RND_NEAR);
+                arf_set_mag(t, arb_radref(x));
+                arf_add(t, arb_midref(x), t, ARF_PREC_EXACT, ARF_RND_DOWN);
+                b = arf_get_d(t, ARF_RND_NEAR);
+
+                if (a != d || b != d)
+                {
+                    flint_printf("FAIL (endpoints)\n\n");
+                    flint_printf("x = "); arb_printd(x, 30); flint_printf("\n\n");
+                    flint_printf("d = %.17g, a = %.17g, b = %.17g\n\n", d, a, b);
+                    flint_abort();
+                }
+            }
+        }
+
+        arb_clear(x);
+        arf_clear(t);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("log_reduction_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100 * arb_test_multiplier(); iter++)
+    {
+        arb_ptr r1, r2, s1, s2;
+        arf_ptr x;
+        slong i, len, prec;
+        int minus_one;
+
+        len = n_randint(state, 40);
+        prec = 2 + n_randint(state, 6000);
+        minus_one = n_randint(state, 2);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        x = _arf_vec_init(len);
+        r1 = _arb_vec_init(len);
+        r2 = _arb_vec_init(len);
+        s1 = _arb_vec_init(len);
+        s2 = _arb_vec_init(len);
+
+        for (i = 0; i < len; i++)
+        {
+            if (i > 0 && n_randint(state, 4) == 0)
+                arf_set(x + i, x + n_randint(state, i));
+            else if (n_randint(state, 4) == 0)
+                arf_randtest(x + i, state, prec, 1 + n_randint(state, 5));
+            else
+                arf_randtest(x + i, state, prec, 4);
+        }
+
+        arb_exp_arf_log_reduction_vec(r1, x, len, prec, minus_one);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_exp_arf_generic(s1 + i, x + i, prec, minus_one);
+
+            if (!arb_overlaps(r1 + i, s1 + i))
+            {
+                flint_printf("FAIL (exp)\n\n");
+                flint_printf("prec = %wd, minus_one = %d, i = %wd\n\n", prec, minus_one, i);
+                flint_printf("x = "); arf_printd(x + i, 50); flint_printf("\n\n");
+                flint_printf("r = "); arb_printd(r1 + i, 50); flint_printf("\n\n");
+                flint_printf("s = "); arb_printd(s1 + i, 50); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        arb_sin_cos_arf_atan_reduction_vec(r1, r2, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_sin_cos_arf_generic(s1 + i, s2 + i, x + i, prec);
+
+            if (!arb_overlaps(r1 + i, s1 + i) || !arb_overlaps(r2 + i, s2 + i))
+            {
+                flint_printf("FAIL (sin_cos)\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_printf("x = "); arf_printd(x + i, 50); flint_printf("\n\n");
+                flint_printf("r1 = "); arb_printd(r1 + i, 50); flint_printf("\n\n");
+                flint_printf("s1 = "); arb_printd(s1 + i, 50); flint_printf("\n\n");
+                flint_printf("r2 = "); arb_printd(r2 + i, 50); flint_printf("\n\n");
+                flint_printf("s2 = "); arb_printd(s2 + i, 50); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        /* only one output */
+        arb_sin_cos_arf_atan_reduction_vec(NULL, s2, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!arb_overlaps(r2 + i, s2 + i))
+            {
+                flint_printf("FAIL (cos)\n\n");
+                flint_printf("prec = %wd, i = %wd\n\n", prec, i);
+                flint_abort();
+            }
+        }
+
+        _arf_vec_clear(x, len);
+        _arb_vec_clear(r1, len);
+        _arb_vec_clear(r2, len);
+        _arb_vec_clear(s1, len);
+        _arb_vec_clear(s2, len);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
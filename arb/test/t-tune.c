@@ -0,0 +1,185 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+#include <unistd.h>
+#endif
+#include "arb.h"
+
+int main()
+{
+    flint_rand_t state;
+    slong iter, i;
+
+    flint_printf("tune....");
+    fflush(stdout);
+    flint_randinit(state);
+
+    /* discard any values loaded from ARB_TUNE_FILE */
+    arb_tune_reset();
+
+    for (i = 0; i < ARB_TUNE_NUM; i++)
+    {
+        if (arb_tune_get(i) != arb_tune_default(i) ||
+            arb_tune_lookup(arb_tune_name(i)) != i)
+        {
+            flint_printf("FAIL (defaults)\n\n");
+            flint_printf("i = %wd\n\n", i);
+            flint_abort();
+        }
+    }
+
+    if (arb_tune_lookup("no_such_parameter") != -1 ||
+        arb_tune_set(ARB_TUNE_NUM, 0) ||
+        arb_tune_set(ARB_TUNE_LOG_NEWTON_PREC, ARB_LOG_TAB2_PREC + 1) ||
+        arb_tune_set(ARB_TUNE_ATAN_NEWTON_PREC, 0) ||
+        arb_tune_set(ARB_TUNE_POLY_MULLOW_BLOCK_BETA, 800) ||
+        arb_tune_set(ARB_TUNE_DFT_CONVOL_DFT_CUTOFF, 17) ||
+        arb_tune_set(ARB_TUNE_DFT_BLUESTEIN_ADDSEQ_MIN_LEN, 7))
+    {
+        flint_printf("FAIL (range)\n\n");
+        flint_abort();
+    }
+
+    /* the results must be correct for any admissible parameters */
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        arb_t x, y, a, b, c, d;
+        slong prec;
+
+        arb_init(x);
+        arb_init(y);
+        arb_init(a);
+        arb_init(b);
+        arb_init(c);
+        arb_init(d);
+
+        prec = 2 + n_randint(state, 6000);
+        arb_randtest(x, state, 1 + n_randint(state, 6000), 1 + n_randint(state, 4));
+
+        arb_tune_reset();
+        arb_exp(a, x, prec);
+        arb_log(b, x, prec);
+        arb_atan(c, x, prec);
+        arb_sin(d, x, prec);
+
+        for (i = 0; i < ARB_TUNE_NUM; i++)
+            arb_tune_set(i, 256 + n_randint(state, 6000));
+
+        arb_exp(y, x, prec);
+        if (!arb_overlaps(a, y))
+        {
+            flint_printf("FAIL (exp)\n\n");
+            flint_abort();
+        }
+
+        arb_log(y, x, prec);
+        if (!arb_overlaps(b, y))
+        {
+            flint_printf("FAIL (log)\n\n");
+            flint_abort();
+        }
+
+        arb_atan(y, x, prec);
+        if (!arb_overlaps(c, y))
+        {
+            flint_printf("FAIL (atan)\n\n");
+            flint_abort();
+        }
+
+        arb_sin(y, x, prec);
+        if (!arb_overlaps(d, y))
+        {
+            flint_printf("FAIL (sin)\n\n");
+            flint_abort();
+        }
+
+        arb_clear(x);
+        arb_clear(y);
+        arb_clear(a);
+        arb_clear(b);
+        arb_clear(c);
+        arb_clear(d);
+    }
+
+/* assume mkstemp() is unavailable on windows */
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+
+    for (iter = 0; iter < 100 * arb_test_multiplier(); iter++)
+    {
+        char filename[] = "/tmp/arb_tune_XXXXXX";
+        slong values[ARB_TUNE_NUM];
+        FILE * fp;
+        int fd;
+
+        fd = mkstemp(filename);
+        if (fd == -1)
+        {
+            flint_printf("FAIL (creating temporary file)\n\n");
+            flint_abort();
+        }
+        close(fd);
+
+        arb_tune_reset();
+        for (i = 0; i < ARB_TUNE_NUM; i++)
+            arb_tune_set(i, n_randint(state, 10000));
+        for (i = 0; i < ARB_TUNE_NUM; i++)
+            values[i] = arb_tune_get(i);
+
+        if (!arb_tune_save(filename))
+        {
+            flint_printf("FAIL (save)\n\n");
+            flint_abort();
+        }
+
+        arb_tune_reset();
+
+        if (!arb_tune_load(filename))
+        {
+            flint_printf("FAIL (load)\n\n");
+            flint_abort();
+        }
+
+        for (i = 0; i < ARB_TUNE_NUM; i++)
+        {
+            if (arb_tune_get(i) != values[i])
+            {
+                flint_printf("FAIL (round trip)\n\n");
+                flint_printf("i = %wd\n\n", i);
+                flint_abort();
+            }
+        }
+
+        /* invalid lines are reported, valid lines still applied */
+        fp = fopen(filename, "w");
+        fprintf(fp, "# comment\n\nlog_newton_prec 1000\nno_such_parameter 1\n");
+        fclose(fp);
+
+        if (arb_tune_load(filename) ||
+            arb_tune_get(ARB_TUNE_LOG_NEWTON_PREC) != 1000)
+        {
+            flint_printf("FAIL (invalid file)\n\n");
+            flint_abort();
+        }
+
+        remove(filename);
+    }
+
+#endif
+
+    arb_tune_reset();
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
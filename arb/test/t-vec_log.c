@@ -0,0 +1,83 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("vec_log....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        arb_ptr x, y;
+        arb_t z;
+        slong i, len, prec;
+
+        len = n_randint(state, 100);
+        prec = 2 + n_randint(state, 1000);
+
+        if (n_randint(state, 10) == 0)
+            prec = 2 + n_randint(state, 15000);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        x = _arb_vec_init(len);
+        y = _arb_vec_init(len);
+        arb_init(z);
+
+        for (i = 0; i < len; i++)
+            arb_randtest(x + i, state, 1 + n_randint(state, 1000), 1 + n_randint(state, 10));
+
+        _arb_vec_log(y, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            arb_log(z, x + i, prec);
+
+            if (!arb_equal(y + i, z))
+            {
+                flint_printf("FAIL\n\n");
+                flint_printf("len = %wd, i = %wd, prec = %wd\n\n", len, i, prec);
+                flint_printf("x = "); arb_printd(x + i, 30); flint_printf("\n\n");
+                flint_printf("y = "); arb_printd(y + i, 30); flint_printf("\n\n");
+                flint_printf("z = "); arb_printd(z, 30); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        /* aliasing */
+        _arb_vec_log(x, x, len, prec);
+
+        for (i = 0; i < len; i++)
+        {
+            if (!arb_equal(x + i, y + i))
+            {
+                flint_printf("FAIL (aliasing)\n\n");
+                flint_abort();
+            }
+        }
+
+        _arb_vec_clear(x, len);
+        _arb_vec_clear(y, len);
+        arb_clear(z);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -22,7 +22,7 @@ int main()
 
     for (iter = 0; iter < 100 * arb_test_multiplier(); iter++)
     {
-        arb_ptr r;
+        arb_ptr r, r2;
         ulong n;
         slong i, num, step;
         mpfr_t s;
@@ -33,12 +33,28 @@ int main()
         step = 1 + n_randint(state, 5);
 
         r = _arb_vec_init(num);
+        r2 = _arb_vec_init(num);
         mpfr_init2(s, prec + 100);
 
         do { n = n_randint(state, 1 << n_randint(state, 10)); } while (n < 2);
 
+        flint_set_num_threads(1 + n_randint(state, 3));
         arb_zeta_ui_vec_borwein(r, n, num, step, prec);
 
+        /* the result must not depend on the number of threads */
+        flint_set_num_threads(1);
+        arb_zeta_ui_vec_borwein(r2, n, num, step, prec);
+
+        for (i = 0; i < num; i++)
+        {
+            if (!arb_equal(r + i, r2 + i))
+            {
+                flint_printf("FAIL: threads\n\n");
+                flint_printf("n = %wu, i = %wd, step = %wd, prec = %wd\n\n", n, i, step, prec);
+                flint_abort();
+            }
+        }
+
         for (i = 0; i < num; i++)
         {
             mpfr_zeta_ui(s, n + i * step, MPFR_RNDN);
@@ -64,6 +80,7 @@ int main()
         }
 
         _arb_vec_clear(r, num);
+        _arb_vec_clear(r2, num);
         mpfr_clear(s);
     }
 
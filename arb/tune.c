@@ -0,0 +1,285 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arb_poly.h"
+
+typedef struct
+{
+    const char * name;
+    slong value;
+    slong min;
+    slong max;
+}
+arb_tune_param_struct;
+
+/* Default values. These initialize both arb_tune_params and
+   arb_tune_tab, so that they only need to be changed here. */
+#define DEFAULT_EXP_LOG_REDUCTION_PREC          2240
+#define DEFAULT_LOG_NEWTON_PREC                 2800
+#define DEFAULT_ATAN_NEWTON_PREC                3400
+#define DEFAULT_SIN_COS_ATAN_REDUCTION_PREC     2600
+#define DEFAULT_POLY_MULLOW_BLOCK_ALPHA         300
+#define DEFAULT_POLY_MULLOW_BLOCK_BETA          512
+#define DEFAULT_EXP_SUM_BS_THREADS_2            30000
+#define DEFAULT_EXP_SUM_BS_THREADS_4            1000000
+#define DEFAULT_EXP_SUM_BS_THREADS_8            5000000
+#define DEFAULT_MAT_MUL_BLOCK_CUTOFF_1          60
+#define DEFAULT_MAT_MUL_BLOCK_CUTOFF_2          50
+#define DEFAULT_MAT_MUL_BLOCK_CUTOFF_3          40
+#define DEFAULT_MAT_MUL_THREAD_MIN              100000
+#define DEFAULT_DFT_BLUESTEIN_MIN_LEN           100
+#define DEFAULT_DFT_BLUESTEIN_ADDSEQ_MIN_LEN    30
+#define DEFAULT_DFT_CONVOL_DFT_CUTOFF           11
+#define DEFAULT_POLY_MULLOW_FFT_MIN_LEN         1000
+#define DEFAULT_POLY_MULLOW_FFT_MAX_PREC        (4 * FLINT_BITS)
+#define DEFAULT_POLY_MULMID_NTT_MIN_LEN         500
+
+/* Admissible ranges. The lower bounds on the Newton cutoffs keep
+   arb_log_newton and arb_atan_newton from recursing into themselves;
+   above ARB_LOG_TAB2_PREC, logarithms use Newton iteration regardless
+   of the cutoff. The mullow_block parameter alpha is stored in
+   hundredths. The DFT convolution cutoff is compared with the four
+   leading bits of the length, so values above 16 are meaningless. */
+static const arb_tune_param_struct arb_tune_params[ARB_TUNE_NUM] =
+{
+    { "exp_log_reduction_prec",         DEFAULT_EXP_LOG_REDUCTION_PREC,         256,  WORD_MAX },
+    { "log_newton_prec",                DEFAULT_LOG_NEWTON_PREC,                256,  ARB_LOG_TAB2_PREC },
+    { "atan_newton_prec",               DEFAULT_ATAN_NEWTON_PREC,               256,  WORD_MAX },
+    { "sin_cos_atan_reduction_prec",    DEFAULT_SIN_COS_ATAN_REDUCTION_PREC,    256,  WORD_MAX },
+    { "poly_mullow_block_alpha",        DEFAULT_POLY_MULLOW_BLOCK_ALPHA,        100,  1000 },
+    { "poly_mullow_block_beta",         DEFAULT_POLY_MULLOW_BLOCK_BETA,         0,    ARB_POLY_DOUBLE_BLOCK_MAX_HEIGHT },
+    { "exp_sum_bs_threads_2",           DEFAULT_EXP_SUM_BS_THREADS_2,           0,    WORD_MAX },
+    { "exp_sum_bs_threads_4",           DEFAULT_EXP_SUM_BS_THREADS_4,           0,    WORD_MAX },
+    { "exp_sum_bs_threads_8",           DEFAULT_EXP_SUM_BS_THREADS_8,           0,    WORD_MAX },
+    { "mat_mul_block_cutoff_1",         DEFAULT_MAT_MUL_BLOCK_CUTOFF_1,         0,    WORD_MAX },
+    { "mat_mul_block_cutoff_2",         DEFAULT_MAT_MUL_BLOCK_CUTOFF_2,         0,    WORD_MAX },
+    { "mat_mul_block_cutoff_3",         DEFAULT_MAT_MUL_BLOCK_CUTOFF_3,         0,    WORD_MAX },
+    { "mat_mul_thread_min",             DEFAULT_MAT_MUL_THREAD_MIN,             0,    WORD_MAX },
+    { "dft_bluestein_min_len",          DEFAULT_DFT_BLUESTEIN_MIN_LEN,          2,    WORD_MAX },
+    { "dft_bluestein_addseq_min_len",   DEFAULT_DFT_BLUESTEIN_ADDSEQ_MIN_LEN,   8,    WORD_MAX },
+    { "dft_convol_dft_cutoff",          DEFAULT_DFT_CONVOL_DFT_CUTOFF,          0,    16 },
+    { "poly_mullow_fft_min_len",        DEFAULT_POLY_MULLOW_FFT_MIN_LEN,        0,    WORD_MAX },
+    { "poly_mullow_fft_max_prec",       DEFAULT_POLY_MULLOW_FFT_MAX_PREC,       0,    WORD_MAX },
+    { "poly_mulmid_ntt_min_len",        DEFAULT_POLY_MULMID_NTT_MIN_LEN,        0,    WORD_MAX },
+};
+
+slong arb_tune_tab[ARB_TUNE_NUM] =
+{
+    DEFAULT_EXP_LOG_REDUCTION_PREC,
+    DEFAULT_LOG_NEWTON_PREC,
+    DEFAULT_ATAN_NEWTON_PREC,
+    DEFAULT_SIN_COS_ATAN_REDUCTION_PREC,
+    DEFAULT_POLY_MULLOW_BLOCK_ALPHA,
+    DEFAULT_POLY_MULLOW_BLOCK_BETA,
+    DEFAULT_EXP_SUM_BS_THREADS_2,
+    DEFAULT_EXP_SUM_BS_THREADS_4,
+    DEFAULT_EXP_SUM_BS_THREADS_8,
+    DEFAULT_MAT_MUL_BLOCK_CUTOFF_1,
+    DEFAULT_MAT_MUL_BLOCK_CUTOFF_2,
+    DEFAULT_MAT_MUL_BLOCK_CUTOFF_3,
+    DEFAULT_MAT_MUL_THREAD_MIN,
+    DEFAULT_DFT_BLUESTEIN_MIN_LEN,
+    DEFAULT_DFT_BLUESTEIN_ADDSEQ_MIN_LEN,
+    DEFAULT_DFT_CONVOL_DFT_CUTOFF,
+    DEFAULT_POLY_MULLOW_FFT_MIN_LEN,
+    DEFAULT_POLY_MULLOW_FFT_MAX_PREC,
+    DEFAULT_POLY_MULMID_NTT_MIN_LEN,
+};
+
+slong
+arb_tune_default(slong i)
+{
+    if (i < 0 || i >= ARB_TUNE_NUM)
+    {
+        flint_printf("arb_tune_default: invalid parameter index\n");
+        flint_abort();
+    }
+
+    return arb_tune_params[i].value;
+}
+
+const char *
+arb_tune_name(slong i)
+{
+    if (i < 0 || i >= ARB_TUNE_NUM)
+    {
+        flint_printf("arb_tune_name: invalid parameter index\n");
+        flint_abort();
+    }
+
+    return arb_tune_params[i].name;
+}
+
+slong
+arb_tune_lookup(const char * name)
+{
+    slong i;
+
+    for (i = 0; i < ARB_TUNE_NUM; i++)
+        if (strcmp(name, arb_tune_params[i].name) == 0)
+            return i;
+
+    return -1;
+}
+
+int
+arb_tune_set(slong i, slong value)
+{
+    slong alpha, beta;
+
+    if (i < 0 || i >= ARB_TUNE_NUM)
+        return 0;
+
+    if (value < arb_tune_params[i].min || value > arb_tune_params[i].max)
+        return 0;
+
+    if (i == ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA ||
+        i == ARB_TUNE_POLY_MULLOW_BLOCK_BETA)
+    {
+        alpha = arb_tune_tab[ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA];
+        beta = arb_tune_tab[ARB_TUNE_POLY_MULLOW_BLOCK_BETA];
+
+        if (i == ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA)
+            alpha = value;
+        else
+            beta = value;
+
+        if (alpha * MAG_BITS / 100 + beta >= ARB_POLY_DOUBLE_BLOCK_MAX_HEIGHT)
+            return 0;
+    }
+
+    arb_tune_tab[i] = value;
+    return 1;
+}
+
+void
+arb_tune_reset(void)
+{
+    slong i;
+
+    for (i = 0; i < ARB_TUNE_NUM; i++)
+        arb_tune_tab[i] = arb_tune_params[i].value;
+}
+
+/* Each line has the form "name value"; everything after a '#' is
+   ignored. Valid lines are applied even if other lines are invalid.
+   Since alpha and beta for mullow_block are constrained jointly, alpha
+   is held at its minimum while reading and set at the end. */
+int
+arb_tune_load(const char * filename)
+{
+    FILE * fp;
+    char line[256], name[128];
+    char * c;
+    long long value;
+    slong i, alpha, old_alpha, old_beta;
+    int success;
+
+    fp = fopen(filename, "r");
+
+    if (fp == NULL)
+        return 0;
+
+    success = 1;
+
+    old_alpha = alpha = arb_tune_tab[ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA];
+    old_beta = arb_tune_tab[ARB_TUNE_POLY_MULLOW_BLOCK_BETA];
+    arb_tune_tab[ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA] =
+        arb_tune_params[ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA].min;
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        c = strchr(line, '#');
+        if (c != NULL)
+            *c = '\0';
+
+        c = line;
+        while (*c == ' ' || *c == '\t' || *c == '\r' || *c == '\n')
+            c++;
+        if (*c == '\0')
+            continue;
+
+        if (sscanf(c, "%127s %lld", name, &value) != 2)
+        {
+            success = 0;
+            continue;
+        }
+
+        i = arb_tune_lookup(name);
+
+        if (i < 0 || value < WORD_MIN || value > WORD_MAX)
+            success = 0;
+        else if (i == ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA)
+            alpha = value;
+        else if (!arb_tune_set(i, (slong) value))
+            success = 0;
+    }
+
+    fclose(fp);
+
+    if (!arb_tune_set(ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA, alpha))
+    {
+        arb_tune_tab[ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA] = old_alpha;
+        arb_tune_tab[ARB_TUNE_POLY_MULLOW_BLOCK_BETA] = old_beta;
+        success = 0;
+    }
+
+    return success;
+}
+
+void
+arb_tune_load_env(void)
+{
+    const char * filename;
+
+    filename = getenv("ARB_TUNE_FILE");
+
+    if (filename != NULL && filename[0] != '\0')
+        arb_tune_load(filename);
+}
+
+int
+arb_tune_save(const char * filename)
+{
+    FILE * fp;
+    slong i;
+    int success;
+
+    fp = fopen(filename, "w");
+
+    if (fp == NULL)
+        return 0;
+
+    success = (fprintf(fp, "# Arb tuning parameters\n") >= 0);
+
+    for (i = 0; i < ARB_TUNE_NUM; i++)
+        success = success && (fprintf(fp, "%s %lld\n",
+            arb_tune_params[i].name, (long long) arb_tune_tab[i]) >= 0);
+
+    if (fclose(fp) != 0)
+        success = 0;
+
+    return success;
+}
+
+#if defined(__GNUC__)
+
+/* Load the file named by ARB_TUNE_FILE when the library is loaded. */
+static void __attribute__((constructor))
+arb_tune_init(void)
+{
+    arb_tune_load_env();
+}
+
+#endif
@@ -0,0 +1,53 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb.h"
+
+int
+_arb_vec_get_d_rounded(double * res, arb_srcptr vec, slong len,
+    arb_get_d_func_t func, void * param, slong prec, slong maxprec)
+{
+    arb_t t;
+    slong i, wp;
+    int success, ok;
+
+    success = 1;
+
+    for (i = 0; i < len; i++)
+    {
+        if (arb_get_d_rounded(res + i, vec + i))
+            continue;
+
+        ok = 0;
+
+        if (func != NULL)
+        {
+            arb_init(t);
+
+            for (wp = 2 * FLINT_MAX(prec, 32); wp <= maxprec; wp *= 2)
+            {
+                func(t, i, param, wp);
+
+                if (arb_get_d_rounded(res + i, t))
+                {
+                    ok = 1;
+                    break;
+                }
+            }
+
+            arb_clear(t);
+        }
+
+        success = success && ok;
+    }
+
+    return success;
+}
@@ -0,0 +1,50 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/thread_support.h"
+#include "arb.h"
+
+typedef struct
+{
+    arb_ptr res;
+    arb_srcptr x;
+    slong prec;
+}
+work_t;
+
+static void
+worker(slong i, work_t * work)
+{
+    arb_log(work->res + i, work->x + i, work->prec);
+}
+
+void
+_arb_vec_log(arb_ptr res, arb_srcptr x, slong len, slong prec)
+{
+    slong i;
+
+    if (len >= ARB_VEC_THREAD_MIN_LEN && prec < ARB_VEC_THREAD_MAX_PREC &&
+        arb_flint_get_num_available_threads() > 1)
+    {
+        work_t work;
+
+        work.res = res;
+        work.x = x;
+        work.prec = prec;
+
+        flint_parallel_do((do_func_t) worker, &work, len, -1, FLINT_PARALLEL_UNIFORM);
+    }
+    else
+    {
+        for (i = 0; i < len; i++)
+            arb_log(res + i, x + i, prec);
+    }
+}
@@ -9,18 +9,74 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "arb.h"
 
 /* With parameter n, the error is bounded by 3/(3+sqrt(8))^n */
 #define ERROR_A 1.5849625007211561815 /* log2(3) */
 #define ERROR_B 2.5431066063272239453 /* log2(3+sqrt(8)) */
 
+/* Maximum total size in bits of the coefficient table d_1, ..., d_n
+   stored for the threaded version. */
+#define BORWEIN_TABLE_MAX_BITS (WORD(1) << 28)
+
 void mag_borwein_error(mag_t err, slong n);
 
+typedef struct
+{
+    fmpz * zeta;
+    const fmpz * d;
+    slong n;
+    ulong start;
+    ulong step;
+    slong num;
+    slong num_chunks;
+}
+borwein_work_t;
+
+/* Adds the terms for s = start + step * j, j0 <= j < j1. Since
+   repeated truncating divisions give the same result as a single
+   one, this gives the same output as the serial loop. */
+static void
+borwein_worker(slong i, void * _work)
+{
+    borwein_work_t * work = (borwein_work_t *) _work;
+    slong j, j0, j1, k;
+    fmpz_t t, u;
+
+    j0 = (i * work->num) / work->num_chunks;
+    j1 = ((i + 1) * work->num) / work->num_chunks;
+
+    if (j0 >= j1)
+        return;
+
+    fmpz_init(t);
+    fmpz_init(u);
+
+    for (k = work->n; k > 0; k--)
+    {
+        fmpz_ui_pow_ui(u, k, work->start + work->step * j0);
+        fmpz_tdiv_q(t, work->d + k, u);
+        if (k % 2 == 0)
+            fmpz_neg(t, t);
+        fmpz_add(work->zeta + j0, work->zeta + j0, t);
+
+        fmpz_ui_pow_ui(u, k, work->step);
+        for (j = j0 + 1; j < j1; j++)
+        {
+            fmpz_tdiv_q(t, t, u);
+            fmpz_add(work->zeta + j, work->zeta + j, t);
+        }
+    }
+
+    fmpz_clear(t);
+    fmpz_clear(u);
+}
+
 void
 arb_zeta_ui_vec_borwein(arb_ptr z, ulong start, slong num, ulong step, slong prec)
 {
-    slong j, k, s, n, wp;
+    slong j, k, s, n, wp, num_threads;
     fmpz_t c, d, t, u;
     fmpz * zeta;
     mag_t err;
@@ -41,27 +97,61 @@ arb_zeta_ui_vec_borwein(arb_ptr z, ulong start, slong num, ulong step, slong pre
     fmpz_mul_2exp(c, c, 2 * n - 1);
     fmpz_set(d, c);
 
-    for (k = n; k > 0; k--)
+    num_threads = arb_flint_get_num_available_threads();
+
+    if (num >= 2 && num_threads > 1 && n * (double) wp <= BORWEIN_TABLE_MAX_BITS)
     {
-        /* divide by first k^s */
-        fmpz_ui_pow_ui(u, k, start);
-        fmpz_tdiv_q(t, d, u);
-        if (k % 2 == 0)
-            fmpz_neg(t, t);
-        fmpz_add(zeta, zeta, t);
+        borwein_work_t work;
+        fmpz * D;
+
+        /* the coefficients d_k are shared by all workers */
+        D = _fmpz_vec_init(n + 1);
 
-        /* remaining k^s */
-        fmpz_ui_pow_ui(u, k, step);
-        for (j = 1; j < num; j++)
+        for (k = n; k > 0; k--)
         {
-            fmpz_tdiv_q(t, t, u);
-            fmpz_add(zeta + j, zeta + j, t);
+            fmpz_set(D + k, d);
+            fmpz_mul2_uiui(c, c, k, 2 * k - 1);
+            fmpz_divexact2_uiui(c, c, 2 * (n - k + 1), n + k - 1);
+            fmpz_add(d, d, c);
         }
 
-        /* hypergeometric recurrence */
-        fmpz_mul2_uiui(c, c, k, 2 * k - 1);
-        fmpz_divexact2_uiui(c, c, 2 * (n - k + 1), n + k - 1);
-        fmpz_add(d, d, c);
+        work.zeta = zeta;
+        work.d = D;
+        work.n = n;
+        work.start = start;
+        work.step = step;
+        work.num = num;
+        work.num_chunks = FLINT_MIN(num, num_threads);
+
+        flint_parallel_do((do_func_t) borwein_worker, &work,
+            work.num_chunks, -1, FLINT_PARALLEL_UNIFORM);
+
+        _fmpz_vec_clear(D, n + 1);
+    }
+    else
+    {
+        for (k = n; k > 0; k--)
+        {
+            /* divide by first k^s */
+            fmpz_ui_pow_ui(u, k, start);
+            fmpz_tdiv_q(t, d, u);
+            if (k % 2 == 0)
+                fmpz_neg(t, t);
+            fmpz_add(zeta, zeta, t);
+
+            /* remaining k^s */
+            fmpz_ui_pow_ui(u, k, step);
+            for (j = 1; j < num; j++)
+            {
+                fmpz_tdiv_q(t, t, u);
+                fmpz_add(zeta + j, zeta + j, t);
+            }
+
+            /* hypergeometric recurrence */
+            fmpz_mul2_uiui(c, c, k, 2 * k - 1);
+            fmpz_divexact2_uiui(c, c, 2 * (n - k + 1), n + k - 1);
+            fmpz_add(d, d, c);
+        }
     }
 
     mag_init(err);
@@ -9,14 +9,51 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "arb.h"
 
-void
-arb_zeta_ui_vec_even(arb_ptr x, ulong start, slong num, slong prec)
+typedef struct
+{
+    arb_ptr x;
+    ulong start;
+    slong prec;
+}
+zeta_work_t;
+
+static void
+zeta_worker(slong i, void * _work)
+{
+    zeta_work_t * work = (zeta_work_t *) _work;
+    arb_zeta_ui(work->x + i, work->start + 2 * i, work->prec);
+}
+
+/* the values are independent; the output does not depend on
+   the number of threads */
+static void
+_arb_zeta_ui_vec_step2(arb_ptr x, ulong start, slong num, slong prec)
 {
     slong i;
 
-    for (i = 0; i < num; i++)
-        arb_zeta_ui(x + i, start + 2 * i, prec);
+    if (num >= 2 && arb_flint_get_num_available_threads() > 1)
+    {
+        zeta_work_t work;
+
+        work.x = x;
+        work.start = start;
+        work.prec = prec;
+
+        flint_parallel_do((do_func_t) zeta_worker, &work, num, -1, FLINT_PARALLEL_STRIDED);
+    }
+    else
+    {
+        for (i = 0; i < num; i++)
+            arb_zeta_ui(x + i, start + 2 * i, prec);
+    }
+}
+
+void
+arb_zeta_ui_vec_even(arb_ptr x, ulong start, slong num, slong prec)
+{
+    _arb_zeta_ui_vec_step2(x, start, num, prec);
 }
 
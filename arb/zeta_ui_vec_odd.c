@@ -9,12 +9,52 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "arb.h"
 
+typedef struct
+{
+    arb_ptr x;
+    ulong start;
+    slong prec;
+}
+zeta_work_t;
+
+static void
+zeta_worker(slong i, void * _work)
+{
+    zeta_work_t * work = (zeta_work_t *) _work;
+    arb_zeta_ui(work->x + i, work->start + 2 * i, work->prec);
+}
+
+/* the values are independent; the output does not depend on
+   the number of threads */
+static void
+_arb_zeta_ui_vec_step2(arb_ptr x, ulong start, slong num, slong prec)
+{
+    slong i;
+
+    if (num >= 2 && arb_flint_get_num_available_threads() > 1)
+    {
+        zeta_work_t work;
+
+        work.x = x;
+        work.start = start;
+        work.prec = prec;
+
+        flint_parallel_do((do_func_t) zeta_worker, &work, num, -1, FLINT_PARALLEL_STRIDED);
+    }
+    else
+    {
+        for (i = 0; i < num; i++)
+            arb_zeta_ui(x + i, start + 2 * i, prec);
+    }
+}
+
 void
 arb_zeta_ui_vec_odd(arb_ptr x, ulong start, slong num, slong prec)
 {
-    slong i, num_borwein;
+    slong num_borwein;
     ulong cutoff;
 
     cutoff = 40 + 0.3 * prec;
@@ -28,7 +68,7 @@ arb_zeta_ui_vec_odd(arb_ptr x, ulong start, slong num, slong prec)
         num_borwein = 0;
 
     arb_zeta_ui_vec_borwein(x, start, num_borwein, 2, prec);
-    for (i = num_borwein; i < num; i++)
-        arb_zeta_ui(x + i, start + 2 * i, prec);
+    _arb_zeta_ui_vec_step2(x + num_borwein,
+        start + 2 * num_borwein, num - num_borwein, prec);
 }
 
@@ -41,6 +41,7 @@ void arb_hypgeom_gamma_stirling_sum_improved(arb_t s, const arb_t z, slong N, sl
 
 #define ARB_HYPGEOM_GAMMA_TAB_NUM 536
 #define ARB_HYPGEOM_GAMMA_TAB_PREC 3456
+#define ARB_HYPGEOM_GAMMA_TAB_EXT_PREC (8 * ARB_HYPGEOM_GAMMA_TAB_PREC)
 
 typedef struct
 {
@@ -52,6 +53,7 @@ typedef struct
 
 ARB_DLL extern arb_hypgeom_gamma_coeff_t arb_hypgeom_gamma_coeffs[ARB_HYPGEOM_GAMMA_TAB_NUM];
 int _arb_hypgeom_gamma_coeff_shallow(arf_t c, mag_t err, slong i, slong prec);
+arb_srcptr _arb_hypgeom_gamma_coeffs_ext(slong * len, slong prec);
 
 void arb_hypgeom_gamma_stirling(arb_t res, const arb_t x, int reciprocal, slong prec);
 int arb_hypgeom_gamma_taylor(arb_t res, const arb_t x, int reciprocal, slong prec);
@@ -129,6 +131,7 @@ void arb_hypgeom_li_series(arb_poly_t g, const arb_poly_t h, int offset, slong l
 void arb_hypgeom_bessel_j(arb_t res, const arb_t nu, const arb_t z, slong prec);
 void arb_hypgeom_bessel_y(arb_t res, const arb_t nu, const arb_t z, slong prec);
 void arb_hypgeom_bessel_jy(arb_t res1, arb_t res2, const arb_t nu, const arb_t z, slong prec);
+void arb_hypgeom_bessel_j_vec(arb_ptr res, const arb_t nu, const arb_t z, slong len, slong prec);
 void arb_hypgeom_bessel_i(arb_t res, const arb_t nu, const arb_t z, slong prec);
 void arb_hypgeom_bessel_k(arb_t res, const arb_t nu, const arb_t z, slong prec);
 
@@ -183,8 +186,11 @@ void arb_hypgeom_legendre_p_ui_asymp(arb_t res, arb_t res2, ulong n, const arb_t
 void arb_hypgeom_legendre_p_ui_one(arb_t res, arb_t res2, ulong n, const arb_t x, slong K, slong prec);
 void arb_hypgeom_legendre_p_ui_zero(arb_t res, arb_t res2, ulong n, const arb_t x, slong K, slong prec);
 void arb_hypgeom_legendre_p_ui(arb_t res, arb_t res_prime, ulong n, const arb_t x, slong prec);
+void arb_hypgeom_legendre_p_ui_vec(arb_ptr res, ulong len, const arb_t x, slong prec);
 
 void arb_hypgeom_legendre_p_ui_root(arb_t res, arb_t weight, ulong n, ulong k, slong prec);
+void _arb_hypgeom_legendre_p_ui_roots_vec(arb_ptr res, arb_ptr weights, ulong n, slong prec);
+void arb_hypgeom_legendre_p_ui_roots_vec(arb_ptr res, arb_ptr weights, ulong n, slong prec);
 
 void arb_hypgeom_central_bin_ui(arb_t res, ulong n, slong prec);
 
@@ -0,0 +1,82 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+
+/* Guard bits for the ball recurrence; when a value has lost more than this,
+   it is recomputed directly. */
+#define REC_GUARD_BITS 64
+
+void
+arb_hypgeom_bessel_j_vec(arb_ptr res, const arb_t nu, const arb_t z, slong len, slong prec)
+{
+    arb_t m, zinv, t;
+    slong k, wp, goal;
+
+    if (len <= 0)
+        return;
+
+    arb_init(m);
+    arb_init(zinv);
+    arb_init(t);
+
+    wp = prec + REC_GUARD_BITS;
+
+    if (len <= 2 || !arb_is_finite(z) || arb_contains_zero(z))
+    {
+        for (k = 0; k < len; k++)
+        {
+            arb_add_ui(m, nu, k, wp);
+            arb_hypgeom_bessel_j(res + k, m, z, prec);
+        }
+    }
+    else
+    {
+        goal = FLINT_MIN(arb_rel_accuracy_bits(nu), arb_rel_accuracy_bits(z));
+        goal = FLINT_MIN(prec, goal) + 2;
+
+        /* J_{nu+k} is the minimal solution of the recurrence for large k,
+           so we start from the highest orders and recurse downwards,
+           which is stable there. In the oscillatory region k < |z|,
+           the ball radii grow and the recurrence is restarted from a
+           direct evaluation whenever a value falls below the target
+           accuracy. */
+        arb_add_ui(m, nu, len - 1, wp);
+        arb_hypgeom_bessel_j(res + len - 1, m, z, wp);
+        arb_sub_ui(m, m, 1, wp);
+        arb_hypgeom_bessel_j(res + len - 2, m, z, wp);
+
+        arb_inv(zinv, z, wp);
+
+        for (k = len - 3; k >= 0; k--)
+        {
+            /* J_{m-1}(z) = (2m/z) J_m(z) - J_{m+1}(z), m = nu + k + 1 */
+            arb_add_ui(m, nu, k + 1, wp);
+            arb_mul_2exp_si(m, m, 1);
+            arb_mul(t, m, zinv, wp);
+            arb_mul(t, t, res + k + 1, wp);
+            arb_sub(res + k, t, res + k + 2, wp);
+
+            if (arb_rel_accuracy_bits(res + k) < goal)
+            {
+                arb_add_ui(m, nu, k, wp);
+                arb_hypgeom_bessel_j(res + k, m, z, wp);
+            }
+        }
+
+        for (k = 0; k < len; k++)
+            arb_set_round(res + k, res + k, prec);
+    }
+
+    arb_clear(m);
+    arb_clear(zinv);
+    arb_clear(t);
+}
@@ -0,0 +1,211 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/thread_support.h"
+#include "arb_hypgeom.h"
+
+#if FLINT_USES_PTHREAD
+#include <pthread.h>
+#endif
+
+/*
+  Taylor coefficients of 1/gamma(1+x) for precisions beyond the static
+  table. The coefficients are generated at the levels
+  2^k * ARB_HYPGEOM_GAMMA_TAB_PREC. The highest level computed so far is
+  kept in a cache shared between threads (so each level is only built once)
+  and every thread works with a private copy of the level it needs.
+
+  A thread's copy can be at a higher level than that thread requested if
+  another thread already built it, so the level a thread ends up using
+  depends on the order of earlier calls.
+
+  The shared table counts the threads holding a private copy. Each thread
+  releases its count from its own cleanup function (FLINT keeps one cleanup
+  list per thread), and the release of the last count frees the table,
+  whichever thread it was built on.
+*/
+
+typedef struct
+{
+    arb_ptr vec;
+    slong len;
+    slong prec;
+    slong users;
+}
+gamma_ext_struct;
+
+#if FLINT_USES_PTHREAD
+#define SHARED_LOCK(lock) pthread_mutex_lock(&(lock))
+#define SHARED_UNLOCK(lock) pthread_mutex_unlock(&(lock))
+static pthread_mutex_t _arb_hypgeom_gamma_ext_shared_lock = PTHREAD_MUTEX_INITIALIZER;
+#else
+#define SHARED_LOCK(lock)
+#define SHARED_UNLOCK(lock)
+#endif
+
+static gamma_ext_struct _arb_hypgeom_gamma_ext_shared = { NULL, 0, 0, 0 };
+
+FLINT_TLS_PREFIX gamma_ext_struct _arb_hypgeom_gamma_ext_cache = { NULL, 0, 0, 0 };
+
+static void
+gamma_ext_clear(gamma_ext_struct * S)
+{
+    if (S->vec != NULL)
+        _arb_vec_clear(S->vec, S->len);
+
+    S->vec = NULL;
+    S->len = 0;
+    S->prec = 0;
+}
+
+static void
+gamma_ext_set(gamma_ext_struct * S, const gamma_ext_struct * T)
+{
+    if (S->len != T->len)
+    {
+        gamma_ext_clear(S);
+        S->vec = _arb_vec_init(T->len);
+        S->len = T->len;
+    }
+
+    _arb_vec_set(S->vec, T->vec, T->len);
+    S->prec = T->prec;
+}
+
+static void
+_arb_hypgeom_gamma_ext_cleanup(void)
+{
+    gamma_ext_struct * S = &_arb_hypgeom_gamma_ext_shared;
+
+    gamma_ext_clear(&_arb_hypgeom_gamma_ext_cache);
+
+    SHARED_LOCK(_arb_hypgeom_gamma_ext_shared_lock);
+    S->users--;
+    if (S->users == 0)
+        gamma_ext_clear(S);
+    SHARED_UNLOCK(_arb_hypgeom_gamma_ext_shared_lock);
+}
+
+/* Computes enough coefficients for arb_hypgeom_gamma_taylor at any working
+   precision up to prec, i.e. with a tail term c_n u^n < 2^-prec
+   for |u| <= 1/2, each correct to prec + 64 bits relative to 1. */
+static void
+gamma_ext_compute(gamma_ext_struct * S, slong prec)
+{
+    arb_struct f[2];
+    arb_ptr v;
+    slong i, len, extra, p;
+    int ok;
+
+    arb_init(f);
+    arb_init(f + 1);
+    arb_one(f);
+    arb_one(f + 1);
+
+    /* about 6.4 bits per term at the top of the static table, and the
+       number of bits per term grows with the index */
+    len = prec / 6 + 16;
+    extra = 64;
+
+    while (1)
+    {
+        v = _arb_vec_init(len);
+        _arb_poly_rgamma_series(v, f, 2, len, prec + 2 * len + extra);
+
+        ok = 1;
+
+        for (i = 1; i < len && ok; i++)
+        {
+            p = prec + ARF_EXP(arb_midref(v + i)) - i / 2 + 64;
+            p = FLINT_MIN(FLINT_MAX(p, 64), prec + 64);
+            if (arb_rel_accuracy_bits(v + i) < p + 2)
+                ok = 0;
+        }
+
+        if (!ok)
+        {
+            _arb_vec_clear(v, len);
+            extra *= 2;
+            continue;
+        }
+
+        if (ARF_EXP(arb_midref(v + len - 1)) - (len - 1) + 16 > -prec)
+        {
+            _arb_vec_clear(v, len);
+            len += len / 4;
+            continue;
+        }
+
+        break;
+    }
+
+    /* Only the precision used by the Taylor series is stored: the term of
+       index i is needed to about prec + exp(c_i) - i bits. */
+    for (i = 1; i < len; i++)
+    {
+        p = prec + ARF_EXP(arb_midref(v + i)) - i / 2 + 64;
+        p = FLINT_MIN(FLINT_MAX(p, 64), prec + 64);
+        arb_set_round(v + i, v + i, p);
+    }
+
+    gamma_ext_clear(S);
+    S->vec = v;
+    S->len = len;
+    S->prec = prec;
+
+    arb_clear(f);
+    arb_clear(f + 1);
+}
+
+arb_srcptr
+_arb_hypgeom_gamma_coeffs_ext(slong * len, slong prec)
+{
+    gamma_ext_struct * T = &_arb_hypgeom_gamma_ext_cache;
+
+    if (prec > ARB_HYPGEOM_GAMMA_TAB_EXT_PREC)
+    {
+        flint_printf("_arb_hypgeom_gamma_coeffs_ext: prec too large\n");
+        flint_abort();
+    }
+
+    if (T->prec < prec)
+    {
+        gamma_ext_struct * S = &_arb_hypgeom_gamma_ext_shared;
+        slong level;
+        int attach;
+
+        level = 2 * ARB_HYPGEOM_GAMMA_TAB_PREC;
+        while (level < prec)
+            level *= 2;
+
+        attach = (T->vec == NULL);
+
+        if (attach)
+            flint_register_cleanup_function(_arb_hypgeom_gamma_ext_cleanup);
+
+        /* holding the lock while computing makes other threads wait
+           for the table instead of building their own */
+        SHARED_LOCK(_arb_hypgeom_gamma_ext_shared_lock);
+
+        if (attach)
+            S->users++;
+
+        if (S->prec < level)
+            gamma_ext_compute(S, level);
+
+        gamma_ext_set(T, S);
+
+        SHARED_UNLOCK(_arb_hypgeom_gamma_ext_shared_lock);
+    }
+
+    *len = T->len;
+    return T->vec;
+}
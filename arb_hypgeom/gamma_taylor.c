@@ -239,6 +239,42 @@ void arb_set_interval_d_fast(arb_t res, double a, double b, slong prec)
 
 int _arf_increment_fast(arf_t x, slong prec);
 
+/* Like _arb_hypgeom_gamma_coeff_shallow, but reading from the runtime
+   table of coefficients (stored with enough precision for any term_prec). */
+static void
+_arb_hypgeom_gamma_coeff_ext_shallow(arf_t c, arb_srcptr tab, slong i, slong prec)
+{
+    mp_srcptr xp;
+    mp_size_t xn, term_limbs;
+    arf_srcptr x = arb_midref(tab + i);
+
+    ARF_GET_MPN_READONLY(xp, xn, x);
+
+    term_limbs = (prec + FLINT_BITS - 1) / FLINT_BITS;
+
+    if (term_limbs >= xn)
+    {
+        *c = *x;
+        return;
+    }
+
+    ARF_EXP(c) = ARF_EXP(x);
+    ARF_XSIZE(c) = ARF_MAKE_XSIZE(term_limbs, ARF_SGNBIT(x));
+
+    if (term_limbs == 1)
+    {
+        ARF_NOPTR_D(c)[0] = xp[xn - 1];
+    }
+    else if (term_limbs == 2)
+    {
+        ARF_NOPTR_D(c)[0] = xp[xn - 2];
+        ARF_NOPTR_D(c)[1] = xp[xn - 1];
+    }
+    else
+    {
+        ARF_PTR_D(c) = (mp_ptr) xp + xn - term_limbs;
+    }
+}
 
 
 /* Try to compute gamma(x) using Taylor series. Returns 1 on success, 0 on
@@ -247,9 +283,11 @@ int
 arb_hypgeom_gamma_taylor(arb_t res, const arb_t x, int reciprocal, slong prec)
 {
     double dx, dxerr, log2u, ds, du;
-    slong i, n, wp, r, tail_bound, rad_exp, mid_exp;
+    slong i, n, wp, r, tail_bound, rad_exp, mid_exp, tab_len;
     arf_t s, u, v;
-    short term_prec[ARB_HYPGEOM_GAMMA_TAB_NUM];
+    short term_prec_tab[ARB_HYPGEOM_GAMMA_TAB_NUM];
+    short * term_prec;
+    arb_srcptr ext;
     int success;
 
 #if DEBUG
@@ -507,8 +545,23 @@ arb_hypgeom_gamma_taylor(arb_t res, const arb_t x, int reciprocal, slong prec)
 
     wp = prec + 6 + FLINT_BIT_COUNT(FLINT_ABS(r));
 
+    ext = NULL;
+    tab_len = ARB_HYPGEOM_GAMMA_TAB_NUM;
+    term_prec = term_prec_tab;
+
     if (wp > ARB_HYPGEOM_GAMMA_TAB_PREC)
-        return 0;
+    {
+        /* The runtime coefficients are rounded to a few limbs more than
+           any term precision before being truncated; one more guard bit
+           accounts for this. */
+        wp++;
+
+        if (wp > ARB_HYPGEOM_GAMMA_TAB_EXT_PREC)
+            return 0;
+
+        ext = _arb_hypgeom_gamma_coeffs_ext(&tab_len, wp);
+        term_prec = flint_malloc(sizeof(short) * tab_len);
+    }
 
     success = 0;
 
@@ -531,9 +584,12 @@ arb_hypgeom_gamma_taylor(arb_t res, const arb_t x, int reciprocal, slong prec)
     term_prec[0] = wp;
     n = 0;
 
-    for (i = 1; i < ARB_HYPGEOM_GAMMA_TAB_NUM; i++)
+    for (i = 1; i < tab_len; i++)
     {
-        tail_bound = arb_hypgeom_gamma_coeffs[i].exp + i * log2u + 5;
+        if (ext != NULL)
+            tail_bound = ARF_EXP(arb_midref(ext + i)) + i * log2u + 5;
+        else
+            tail_bound = arb_hypgeom_gamma_coeffs[i].exp + i * log2u + 5;
 
         if (tail_bound <= -wp)
         {
@@ -582,7 +638,11 @@ arb_hypgeom_gamma_taylor(arb_t res, const arb_t x, int reciprocal, slong prec)
         flint_printf("add term %wd with precision %wd\n", i, term_prec[i]);
 #endif
 
-        if (!_arb_hypgeom_gamma_coeff_shallow(c, NULL, i, term_prec[i]))
+        if (ext != NULL)
+        {
+            _arb_hypgeom_gamma_coeff_ext_shallow(c, ext, i, term_prec[i]);
+        }
+        else if (!_arb_hypgeom_gamma_coeff_shallow(c, NULL, i, term_prec[i]))
         {
             flint_printf("arb_hypgeom_gamma_taylor: prec = %wd, du = %g, log2u = %d, term_prec[%wd] = %wd",
                 prec, du, log2u, i, term_prec[i]);
@@ -683,6 +743,9 @@ arb_hypgeom_gamma_taylor(arb_t res, const arb_t x, int reciprocal, slong prec)
 #endif
 
 cleanup:
+    if (ext != NULL)
+        flint_free(term_prec);
+
     arf_clear(s);
     arf_clear(u);
     arf_clear(v);
@@ -0,0 +1,75 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/thread_support.h"
+#include "arb_hypgeom.h"
+
+typedef struct
+{
+    arb_ptr res;
+    arb_ptr weights;
+    ulong n;
+    slong prec;
+}
+roots_work_t;
+
+static void
+roots_worker(slong k, roots_work_t * work)
+{
+    arb_hypgeom_legendre_p_ui_root(work->res + k,
+        (work->weights == NULL) ? NULL : work->weights + k,
+        work->n, k, work->prec);
+}
+
+void
+_arb_hypgeom_legendre_p_ui_roots_vec(arb_ptr res, arb_ptr weights, ulong n, slong prec)
+{
+    roots_work_t work;
+    slong k, len;
+
+    len = (n + 1) / 2;
+
+    if (arb_flint_get_num_available_threads() > 1 && len > 1)
+    {
+        work.res = res;
+        work.weights = weights;
+        work.n = n;
+        work.prec = prec;
+
+        /* the cost is not uniform in k (roots close to 1 use a different
+           expansion), so interleave the indices between threads */
+        flint_parallel_do((do_func_t) roots_worker, &work, len, -1, FLINT_PARALLEL_STRIDED);
+    }
+    else
+    {
+        for (k = 0; k < len; k++)
+            arb_hypgeom_legendre_p_ui_root(res + k,
+                (weights == NULL) ? NULL : weights + k, n, k, prec);
+    }
+}
+
+void
+arb_hypgeom_legendre_p_ui_roots_vec(arb_ptr res, arb_ptr weights, ulong n, slong prec)
+{
+    slong k;
+
+    if (n == 0)
+        return;
+
+    _arb_hypgeom_legendre_p_ui_roots_vec(res, weights, n, prec);
+
+    for (k = (n + 1) / 2; k < n; k++)
+    {
+        arb_neg(res + k, res + n - 1 - k);
+        if (weights != NULL)
+            arb_set(weights + k, weights + n - 1 - k);
+    }
+}
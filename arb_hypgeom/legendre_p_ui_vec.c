@@ -0,0 +1,171 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+
+/* Guard bits for the ball recurrence; when a value has lost more than this,
+   it is recomputed directly. */
+#define REC_GUARD_BITS 64
+
+/* Forward recurrence in ball arithmetic (used for |x| >= 1 where P_n(x)
+   is dominant), restarting from direct evaluations when accuracy is lost. */
+static void
+_arb_hypgeom_legendre_p_ui_vec_ball(arb_ptr res, ulong len, const arb_t x, slong prec)
+{
+    arb_t t;
+    ulong k;
+    slong wp, goal;
+
+    arb_init(t);
+
+    wp = prec + REC_GUARD_BITS;
+    goal = FLINT_MIN(prec, arb_rel_accuracy_bits(x)) + 2;
+
+    arb_one(res);
+    if (len > 1)
+        arb_set(res + 1, x);
+
+    for (k = 1; k + 1 < len; k++)
+    {
+        /* (k+1) P_{k+1} = (2k+1) x P_k - k P_{k-1} */
+        arb_mul(t, res + k, x, wp);
+        arb_mul_ui(t, t, 2 * k + 1, wp);
+        arb_submul_ui(t, res + k - 1, k, wp);
+        arb_div_ui(res + k + 1, t, k + 1, wp);
+
+        if (arb_rel_accuracy_bits(res + k + 1) < goal)
+            arb_hypgeom_legendre_p_ui(res + k + 1, NULL, k + 1, x, wp);
+    }
+
+    for (k = 0; k < len; k++)
+        arb_set_round(res + k, res + k, prec);
+
+    arb_clear(t);
+}
+
+void
+arb_hypgeom_legendre_p_ui_vec(arb_ptr res, ulong len, const arb_t x, slong prec)
+{
+    slong wp;
+    ulong k, den;
+    mp_limb_t denlo, denhi;
+    mpz_t p0, p1, xx, tt;
+    fmpz_t fxx;
+    int error;
+    arb_t x2sub1;
+    mag_t err1, err2, xrad;
+
+    if (len == 0)
+        return;
+
+    if (!arb_is_finite(x) || len - 1 > (UWORD(1) << (FLINT_BITS / 2 - 1)))
+    {
+        arb_one(res);
+        for (k = 1; k < len; k++)
+            arb_hypgeom_legendre_p_ui(res + k, NULL, k, x, prec);
+        return;
+    }
+
+    mag_init(xrad);
+
+    arb_get_mag(xrad, x);
+    /* the fixed-point error analysis assumes |x| < 1 */
+    if (mag_cmp_2exp_si(xrad, 0) >= 0)
+    {
+        _arb_hypgeom_legendre_p_ui_vec_ball(res, len, x, prec);
+        mag_clear(xrad);
+        return;
+    }
+
+    mpz_init(p0);
+    mpz_init(p1);
+    mpz_init(xx);
+    mpz_init(tt);
+    fmpz_init(fxx);
+    arb_init(x2sub1);
+    mag_init(err1);
+    mag_init(err2);
+
+    /* The same fixed-point recurrence as arb_hypgeom_legendre_p_ui_rec,
+       reading off every term. The rounding error in P_k is bounded
+       by (k+1)(k+2) ulp. */
+    wp = -arf_abs_bound_lt_2exp_si(arb_midref(x));
+    wp = FLINT_MAX(wp, 0);
+    wp = FLINT_MIN(wp, prec);
+    wp += prec + 2 * FLINT_BIT_COUNT(len + 1);
+
+    arb_mul(x2sub1, x, x, ARF_PREC_EXACT);
+    arb_neg(x2sub1, x2sub1);
+    arb_add_ui(x2sub1, x2sub1, 1, wp);
+
+    error = arf_get_fmpz_fixed_si(fxx, arb_midref(x), -wp);
+    fmpz_get_mpz(xx, fxx);
+
+    mag_set(xrad, arb_radref(x));
+    if (error)
+        mag_add_ui_2exp_si(xrad, xrad, 1, -wp);
+
+    mpz_set_ui(p0, 1);
+    mpz_mul_2exp(p0, p0, wp);
+    mpz_set(p1, xx);
+
+    arb_one(res);
+
+    den = 1;
+    for (k = 1; k < len; k++)
+    {
+        /* p1 = den P_k */
+        flint_mpz_tdiv_q_ui(tt, p1, den);
+        arf_set_mpz(arb_midref(res + k), tt);
+        arf_mul_2exp_si(arb_midref(res + k), arb_midref(res + k), -wp);
+        mag_set_ui_2exp_si(arb_radref(res + k), (k + 1) * (k + 2), -wp);
+
+        if (!mag_is_zero(xrad))
+        {
+            arb_hypgeom_legendre_p_ui_deriv_bound(err1, err2, k, x, x2sub1);
+            mag_mul(err1, err1, xrad);
+            mag_add(arb_radref(res + k), arb_radref(res + k), err1);
+        }
+
+        arb_set_round(res + k, res + k, prec);
+
+        if (k + 1 == len)
+            break;
+
+        mpz_mul(tt, p1, xx);
+        mpz_tdiv_q_2exp(tt, tt, wp);
+        flint_mpz_mul_ui(p0, p0, k*k);
+        mpz_neg(p0, p0);
+        flint_mpz_addmul_ui(p0, tt, 2 * k + 1);
+        mpz_swap(p0, p1);
+        umul_ppmm(denhi, denlo, den, k + 1);
+        if (denhi != 0)
+        {
+            flint_mpz_tdiv_q_ui(p0, p0, den);
+            flint_mpz_tdiv_q_ui(p1, p1, den);
+            den = k + 1;
+        }
+        else
+        {
+            den = denlo;
+        }
+    }
+
+    mpz_clear(p0);
+    mpz_clear(p1);
+    mpz_clear(xx);
+    mpz_clear(tt);
+    fmpz_clear(fxx);
+    arb_clear(x2sub1);
+    mag_clear(err1);
+    mag_clear(err2);
+    mag_clear(xrad);
+}
@@ -0,0 +1,78 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("bessel_j_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 300 * arb_test_multiplier(); iter++)
+    {
+        arb_ptr v;
+        arb_t nu, z, m, y;
+        slong len, k, prec;
+
+        len = n_randint(state, 100);
+        prec = 2 + n_randint(state, 300);
+
+        v = _arb_vec_init(len);
+        arb_init(nu);
+        arb_init(z);
+        arb_init(m);
+        arb_init(y);
+
+        if (n_randint(state, 2))
+            arb_set_si(nu, (slong) n_randint(state, 20) - 10);
+        else
+            arb_randtest(nu, state, 2 + n_randint(state, 100), 4);
+
+        arb_randtest(z, state, 2 + n_randint(state, 300), 6);
+        if (n_randint(state, 2))
+            mag_zero(arb_radref(z));
+
+        arb_hypgeom_bessel_j_vec(v, nu, z, len, prec);
+
+        for (k = 0; k < len; k++)
+        {
+            arb_add_ui(m, nu, k, prec + 64);
+            arb_hypgeom_bessel_j(y, m, z, prec);
+
+            if (!arb_overlaps(y, v + k))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("len = %wd, k = %wd, prec = %wd\n\n", len, k, prec);
+                flint_printf("nu = "); arb_printn(nu, 50, 0); flint_printf("\n\n");
+                flint_printf("z = "); arb_printn(z, 50, 0); flint_printf("\n\n");
+                flint_printf("y = "); arb_printn(y, 50, 0); flint_printf("\n\n");
+                flint_printf("v = "); arb_printn(v + k, 50, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _arb_vec_clear(v, len);
+        arb_clear(nu);
+        arb_clear(z);
+        arb_clear(m);
+        arb_clear(y);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
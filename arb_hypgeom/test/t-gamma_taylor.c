@@ -156,6 +156,55 @@ int main()
         arb_clear(b);
     }
 
+    /* precisions using the runtime coefficient table */
+    for (iter = 0; iter < 100 * arb_test_multiplier(); iter++)
+    {
+        arb_t x, s1, s2;
+        slong prec;
+        int reciprocal;
+
+        prec = ARB_HYPGEOM_GAMMA_TAB_PREC + n_randint(state, 2 * ARB_HYPGEOM_GAMMA_TAB_PREC);
+        if (n_randint(state, 10) == 0)
+            prec += n_randint(state, 4 * ARB_HYPGEOM_GAMMA_TAB_PREC);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        arb_init(x);
+        arb_init(s1);
+        arb_init(s2);
+
+        arb_randtest(x, state, prec, 4);
+        reciprocal = n_randint(state, 2);
+
+        if (arb_hypgeom_gamma_taylor(s1, x, reciprocal, prec))
+        {
+            arb_hypgeom_gamma_stirling(s2, x, reciprocal, prec);
+
+            if (!arb_overlaps(s1, s2))
+            {
+                flint_printf("FAIL (high precision)\n\n");
+                flint_printf("prec = %wd\n\n", prec);
+                flint_printf("x = "); arb_printn(x, 100, 0); flint_printf("\n\n");
+                flint_printf("s1 = "); arb_printn(s1, 100, 0); flint_printf("\n\n");
+                flint_printf("s2 = "); arb_printn(s2, 100, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+
+            if (arb_is_exact(x) && arb_is_positive(x) &&
+                arb_rel_accuracy_bits(s1) < prec - 16)
+            {
+                flint_printf("FAIL (accuracy)\n\n");
+                flint_printf("prec = %wd, acc = %wd\n\n", prec, arb_rel_accuracy_bits(s1));
+                flint_printf("x = "); arb_printn(x, 100, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        arb_clear(x);
+        arb_clear(s1);
+        arb_clear(s2);
+    }
+
     flint_randclear(state);
     flint_cleanup();
     flint_printf("PASS\n");
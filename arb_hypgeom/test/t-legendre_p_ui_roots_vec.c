@@ -0,0 +1,89 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("legendre_p_ui_roots_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 200 * arb_test_multiplier(); iter++)
+    {
+        ulong n, k;
+        slong prec;
+        arb_ptr roots, weights;
+        arb_t x, w, s;
+        int with_weights;
+
+        if (n_randint(state, 10) == 0)
+            n = n_randint(state, 3000);
+        else
+            n = n_randint(state, 100);
+
+        prec = 2 + n_randint(state, 300);
+        with_weights = n_randint(state, 4) != 0;
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        roots = _arb_vec_init(n);
+        weights = _arb_vec_init(n);
+        arb_init(x);
+        arb_init(w);
+        arb_init(s);
+
+        arb_hypgeom_legendre_p_ui_roots_vec(roots,
+            with_weights ? weights : NULL, n, prec);
+
+        for (k = 0; k < n; k++)
+        {
+            arb_hypgeom_legendre_p_ui_root(x, w, n, k, prec);
+
+            if (!arb_equal(x, roots + k) ||
+                (with_weights && !arb_equal(w, weights + k)))
+            {
+                flint_printf("FAIL: compare with single root\n\n");
+                flint_printf("n = %wu, k = %wu, prec = %wd\n\n", n, k, prec);
+                flint_printf("x = "); arb_printn(x, 30, 0); flint_printf("\n\n");
+                flint_printf("root = "); arb_printn(roots + k, 30, 0); flint_printf("\n\n");
+                flint_printf("w = "); arb_printn(w, 30, 0); flint_printf("\n\n");
+                flint_printf("weight = "); arb_printn(weights + k, 30, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+
+            arb_add(s, s, w, prec);
+        }
+
+        if (n != 0 && !arb_contains_si(s, 2))
+        {
+            flint_printf("FAIL: sum of weights\n\n");
+            flint_printf("n = %wu, prec = %wd\n\n", n, prec);
+            flint_printf("s = "); arb_printn(s, 30, 0); flint_printf("\n\n");
+            flint_abort();
+        }
+
+        _arb_vec_clear(roots, n);
+        _arb_vec_clear(weights, n);
+        arb_clear(x);
+        arb_clear(w);
+        arb_clear(s);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,68 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("legendre_p_ui_vec....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        arb_ptr v;
+        arb_t x, y;
+        ulong len, k;
+        slong prec;
+
+        len = n_randint(state, 300);
+        prec = 2 + n_randint(state, 300);
+
+        v = _arb_vec_init(len);
+        arb_init(x);
+        arb_init(y);
+
+        arb_randtest(x, state, 2 + n_randint(state, 300), 1 + n_randint(state, 3));
+        if (n_randint(state, 2))
+            mag_zero(arb_radref(x));
+
+        arb_hypgeom_legendre_p_ui_vec(v, len, x, prec);
+
+        for (k = 0; k < len; k++)
+        {
+            arb_hypgeom_legendre_p_ui(y, NULL, k, x, prec);
+
+            if (!arb_overlaps(y, v + k))
+            {
+                flint_printf("FAIL: overlap\n\n");
+                flint_printf("len = %wu, k = %wu, prec = %wd\n\n", len, k, prec);
+                flint_printf("x = "); arb_printn(x, 50, 0); flint_printf("\n\n");
+                flint_printf("y = "); arb_printn(y, 50, 0); flint_printf("\n\n");
+                flint_printf("v = "); arb_printn(v + k, 50, 0); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        _arb_vec_clear(v, len);
+        arb_clear(x);
+        arb_clear(y);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -94,6 +94,11 @@ void arb_mat_set_round_fmpz_mat(arb_mat_t dest, const fmpz_mat_t src, slong prec
 
 void arb_mat_set_fmpq_mat(arb_mat_t dest, const fmpq_mat_t src, slong prec);
 
+typedef void (*arb_mat_get_d_func_t)(arb_t res, slong i, slong j, void * param, slong prec);
+
+int arb_mat_get_d_accurate(double * res, const arb_mat_t A,
+    arb_mat_get_d_func_t func, void * param, slong prec, slong maxprec);
+
 /* Random generation */
 
 void arb_mat_randtest(arb_mat_t mat, flint_rand_t state, slong prec, slong mag_bits);
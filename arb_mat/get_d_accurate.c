@@ -0,0 +1,54 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_mat.h"
+
+typedef struct
+{
+    arb_mat_get_d_func_t func;
+    void * param;
+    slong row;
+}
+row_param_t;
+
+static void
+row_func(arb_t res, slong j, void * param, slong prec)
+{
+    row_param_t * p = param;
+
+    p->func(res, p->row, j, p->param, prec);
+}
+
+int
+arb_mat_get_d_accurate(double * res, const arb_mat_t A,
+    arb_mat_get_d_func_t func, void * param, slong prec, slong maxprec)
+{
+    row_param_t p;
+    slong i, c;
+    int success;
+
+    c = arb_mat_ncols(A);
+    success = 1;
+
+    p.func = func;
+    p.param = param;
+
+    for (i = 0; i < arb_mat_nrows(A); i++)
+    {
+        p.row = i;
+
+        if (!_arb_vec_get_d_rounded(res + i * c, arb_mat_entry(A, i, 0), c,
+                (func == NULL) ? NULL : row_func, &p, prec, maxprec))
+            success = 0;
+    }
+
+    return success;
+}
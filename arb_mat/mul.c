@@ -18,11 +18,11 @@ arb_mat_mul(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
 
     /* todo: detect small-integer matrices */
     if (prec <= 2 * FLINT_BITS)
-        cutoff = 60;
+        cutoff = arb_tune_get(ARB_TUNE_MAT_MUL_BLOCK_CUTOFF_1);
     else if (prec <= 8 * FLINT_BITS)
-        cutoff = 50;
+        cutoff = arb_tune_get(ARB_TUNE_MAT_MUL_BLOCK_CUTOFF_2);
     else
-        cutoff = 40;
+        cutoff = arb_tune_get(ARB_TUNE_MAT_MUL_BLOCK_CUTOFF_3);
 
     if (arb_mat_nrows(A) <= cutoff || arb_mat_ncols(A) <= cutoff ||
         arb_mat_ncols(B) <= cutoff)
@@ -31,7 +31,7 @@ arb_mat_mul(arb_mat_t C, const arb_mat_t A, const arb_mat_t B, slong prec)
             ((double) arb_mat_nrows(A) *
              (double) arb_mat_nrows(B) *
              (double) arb_mat_ncols(B) *
-             (double) prec > 100000))
+             (double) prec > arb_tune_get(ARB_TUNE_MAT_MUL_THREAD_MIN)))
         {
             arb_mat_mul_threaded(C, A, B, prec);
         }
@@ -0,0 +1,100 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_mat.h"
+
+/* entry (i, j) is log(i + 2 j + 2) / 3 */
+static void
+entry(arb_t res, slong i, slong j, void * param, slong prec)
+{
+    arb_set_si(res, i + 2 * j + 2);
+    arb_log(res, res, prec);
+    arb_div_ui(res, res, 3, prec);
+    (*((slong *) param))++;
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("get_d_accurate....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        arb_mat_t A;
+        arb_t t;
+        double * d;
+        double e;
+        slong i, j, r, c, prec, calls;
+        int ok;
+
+        r = n_randint(state, 6);
+        c = n_randint(state, 6);
+        prec = 2 + n_randint(state, 40);
+
+        arb_mat_init(A, r, c);
+        arb_init(t);
+        d = flint_malloc(sizeof(double) * FLINT_MAX(r * c, 1));
+
+        calls = 0;
+        for (i = 0; i < r; i++)
+            for (j = 0; j < c; j++)
+                entry(arb_mat_entry(A, i, j), i, j, &calls, prec);
+
+        /* without recomputation, the low precision entries are not enough */
+        calls = 0;
+        ok = arb_mat_get_d_accurate(d, A, NULL, NULL, prec, 1000);
+
+        if ((r * c != 0 && ok) || calls != 0)
+        {
+            flint_printf("FAIL (no callback)\n\n");
+            flint_abort();
+        }
+
+        ok = arb_mat_get_d_accurate(d, A, entry, &calls, prec, 1000);
+
+        if (!ok || (r * c != 0 && calls == 0))
+        {
+            flint_printf("FAIL (callback)\n\n");
+            flint_printf("r = %wd, c = %wd, prec = %wd\n\n", r, c, prec);
+            flint_abort();
+        }
+
+        for (i = 0; i < r; i++)
+        {
+            for (j = 0; j < c; j++)
+            {
+                entry(t, i, j, &calls, 500);
+
+                if (!arb_get_d_rounded(&e, t) || e != d[i * c + j])
+                {
+                    flint_printf("FAIL (value)\n\n");
+                    flint_printf("i = %wd, j = %wd\n\n", i, j);
+                    flint_printf("%.17g %.17g\n\n", e, d[i * c + j]);
+                    flint_abort();
+                }
+            }
+        }
+
+        arb_mat_clear(A);
+        arb_clear(t);
+        flint_free(d);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
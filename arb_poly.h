@@ -165,6 +165,9 @@ void arb_poly_set_si(arb_poly_t poly, slong c);
 
 int arb_poly_get_unique_fmpz_poly(fmpz_poly_t res, const arb_poly_t src);
 
+int arb_poly_get_d_accurate(double * res, const arb_poly_t poly,
+    arb_get_d_func_t func, void * param, slong prec, slong maxprec);
+
 /* Comparisons */
 
 int arb_poly_contains(const arb_poly_t poly1, const arb_poly_t poly2);
@@ -272,6 +275,14 @@ void arb_poly_mullow_classical(arb_poly_t res, const arb_poly_t poly1,
                                             const arb_poly_t poly2,
                                                 slong n, slong prec);
 
+/* Maximum height in bits of the blocks in _arb_poly_mullow_block for
+   which doubles are used for error bounding. Since the dynamic exponent
+   range of doubles is about +/- 1024, this must be less than about 1024
+   (to allow the product of two numbers). This must also account for
+   adding MAG_BITS bits. arb_tune_set restricts the block height
+   parameters accordingly. */
+#define ARB_POLY_DOUBLE_BLOCK_MAX_HEIGHT 800
+
 void _arb_poly_mullow_block(arb_ptr C,
     arb_srcptr A, slong lenA,
     arb_srcptr B, slong lenB, slong n, slong prec);
@@ -279,6 +290,58 @@ void _arb_poly_mullow_block(arb_ptr C,
 void arb_poly_mullow_block(arb_poly_t res, const arb_poly_t poly1,
               const arb_poly_t poly2, slong len, slong prec);
 
+void _arb_poly_mullow_fft(arb_ptr C,
+    arb_srcptr A, slong lenA,
+    arb_srcptr B, slong lenB, slong n, slong prec);
+
+void arb_poly_mullow_fft(arb_poly_t res, const arb_poly_t poly1,
+              const arb_poly_t poly2, slong len, slong prec);
+
+/* exact integer products using number-theoretic transforms */
+
+#if FLINT64
+#define ARB_POLY_NTT_MAX_DEPTH 40
+#else
+#define ARB_POLY_NTT_MAX_DEPTH 16
+#endif
+
+typedef struct
+{
+    slong len;
+    slong bits;
+    slong depth;
+    slong num_primes;
+    mp_ptr primes;
+    mp_ptr roots;
+    mp_ptr data;
+    fmpz * poly;
+    fmpz_comb_t comb;
+}
+arb_poly_ntt_struct;
+
+typedef arb_poly_ntt_struct arb_poly_ntt_t[1];
+
+void arb_poly_ntt_init(arb_poly_ntt_t T, const fmpz * poly, slong len,
+    slong bits, slong n);
+
+void arb_poly_ntt_clear(arb_poly_ntt_t T);
+
+void _arb_poly_ntt_mulmid(fmpz * res, const fmpz * poly, slong len,
+    slong lo, slong hi, const arb_poly_ntt_t T);
+
+void _arb_poly_ntt_mullow(fmpz * res, const fmpz * poly, slong len,
+    slong n, const arb_poly_ntt_t T);
+
+void _arb_poly_fmpz_mulmid_ntt(fmpz * res, const fmpz * poly1, slong len1,
+    const fmpz * poly2, slong len2, slong lo, slong hi);
+
+#define ARB_POLY_MUL_CLASSICAL 0
+#define ARB_POLY_MUL_BLOCK 1
+#define ARB_POLY_MUL_FFT 2
+
+int _arb_poly_mul_algorithm(arb_srcptr poly1, slong len1,
+    arb_srcptr poly2, slong len2, slong n, slong prec);
+
 void _arb_poly_mullow(arb_ptr C,
     arb_srcptr A, slong lenA,
     arb_srcptr B, slong lenB, slong n, slong prec);
@@ -286,6 +349,42 @@ void _arb_poly_mullow(arb_ptr C,
 void arb_poly_mullow(arb_poly_t res, const arb_poly_t poly1,
               const arb_poly_t poly2, slong len, slong prec);
 
+void _arb_poly_mulmid_classical(arb_ptr res,
+    arb_srcptr poly1, slong len1,
+    arb_srcptr poly2, slong len2, slong lo, slong hi, slong prec);
+
+void arb_poly_mulmid_classical(arb_poly_t res, const arb_poly_t poly1,
+    const arb_poly_t poly2, slong lo, slong hi, slong prec);
+
+void _arb_poly_mulmid_block(arb_ptr res,
+    arb_srcptr poly1, slong len1,
+    arb_srcptr poly2, slong len2, slong lo, slong hi, slong prec);
+
+void arb_poly_mulmid_block(arb_poly_t res, const arb_poly_t poly1,
+    const arb_poly_t poly2, slong lo, slong hi, slong prec);
+
+/* helpers of the block algorithm, also used by acb_poly */
+
+void _mag_vec_get_fmpz_2exp_blocks(fmpz * coeffs,
+    double * dblcoeffs, fmpz * exps, slong * blocks, const fmpz_t scale,
+    arb_srcptr x, mag_srcptr xm, slong len);
+
+void _arb_poly_addmulmid_rad(arb_ptr z, fmpz * zz,
+    const fmpz * xz, const double * xdbl, const fmpz * xexps,
+    const slong * xblocks, slong xlen,
+    const fmpz * yz, const double * ydbl, const fmpz * yexps,
+    const slong * yblocks, slong ylen, slong lo, slong n);
+
+void _arb_poly_fmpz_mulmid(fmpz * zz, const fmpz * x, slong xl,
+    const fmpz * y, slong yl, slong lo, slong n);
+
+void _arb_poly_mulmid(arb_ptr res,
+    arb_srcptr poly1, slong len1,
+    arb_srcptr poly2, slong len2, slong lo, slong hi, slong prec);
+
+void arb_poly_mulmid(arb_poly_t res, const arb_poly_t poly1,
+    const arb_poly_t poly2, slong lo, slong hi, slong prec);
+
 void _arb_poly_mul(arb_ptr C,
     arb_srcptr A, slong lenA,
     arb_srcptr B, slong lenB, slong prec);
@@ -349,6 +448,25 @@ void _arb_poly_tree_free(arb_ptr * tree, slong len);
 
 void _arb_poly_tree_build(arb_ptr * tree, arb_srcptr roots, slong len, slong prec);
 
+/* Levels of the tree with at least this many points are processed
+   in parallel when threads are available. */
+#define ARB_POLY_TREE_THREAD_CUTOFF 64
+
+typedef struct
+{
+    arb_ptr * tree;
+    arb_ptr weights;
+    slong len;
+    slong prec;
+}
+arb_poly_tree_struct;
+
+typedef arb_poly_tree_struct arb_poly_tree_t[1];
+
+void arb_poly_tree_init(arb_poly_tree_t T, arb_srcptr xs, slong len, slong prec);
+
+void arb_poly_tree_clear(arb_poly_tree_t T);
+
 /* Composition */
 
 void _arb_poly_taylor_shift_horner(arb_ptr poly, const arb_t c, slong n, slong prec);
@@ -454,6 +572,9 @@ void _arb_poly_evaluate_vec_fast(arb_ptr ys, arb_srcptr poly, slong plen,
 void arb_poly_evaluate_vec_fast(arb_ptr ys,
         const arb_poly_t poly, arb_srcptr xs, slong n, slong prec);
 
+void arb_poly_evaluate_vec_tree(arb_ptr ys,
+        const arb_poly_t poly, const arb_poly_tree_t T, slong prec);
+
 void _arb_poly_interpolate_newton(arb_ptr poly, arb_srcptr xs,
     arb_srcptr ys, slong n, slong prec);
 
@@ -480,6 +601,9 @@ void _arb_poly_interpolate_fast(arb_ptr poly,
 void arb_poly_interpolate_fast(arb_poly_t poly,
         arb_srcptr xs, arb_srcptr ys, slong n, slong prec);
 
+void arb_poly_interpolate_tree(arb_poly_t poly,
+        arb_srcptr ys, arb_poly_tree_t T, slong prec);
+
 /* Derivative and integral */
 
 void _arb_poly_derivative(arb_ptr res, arb_srcptr poly, slong len, slong prec);
@@ -0,0 +1,20 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_poly.h"
+
+int
+arb_poly_get_d_accurate(double * res, const arb_poly_t poly,
+    arb_get_d_func_t func, void * param, slong prec, slong maxprec)
+{
+    return _arb_vec_get_d_rounded(res, poly->coeffs, poly->length,
+        func, param, prec, maxprec);
+}
@@ -9,6 +9,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "flint/thread_support.h"
 #include "arb_poly.h"
 
 void
@@ -43,13 +44,65 @@ _arb_poly_interpolation_weights(arb_ptr w,
     _arb_vec_clear(tmp, len + 1);
 }
 
+/* Combines the k-th pair of chunks of poly on level i, using the
+   corresponding parts of t and u as scratch space. */
+static void
+_arb_poly_interpolate_fast_chunk(arb_ptr poly, arb_ptr t, arb_ptr u,
+    arb_ptr * tree, slong len, slong i, slong k, slong prec)
+{
+    slong pow, left;
+    arb_ptr pa, pb;
+
+    pow = WORD(1) << i;
+    left = len - 2 * pow * k;
+    pa = tree[i] + (2 * pow + 2) * k;
+    pb = poly + 2 * pow * k;
+    t += 2 * pow * k;
+    u += 2 * pow * k;
+
+    if (left >= 2 * pow)
+    {
+        _arb_poly_mul(t, pa, pow + 1, pb + pow, pow, prec);
+        _arb_poly_mul(u, pa + pow + 1, pow + 1, pb, pow, prec);
+        _arb_vec_add(pb, t, u, 2 * pow, prec);
+    }
+    else if (left > pow)
+    {
+        _arb_poly_mul(t, pa, pow + 1, pb + pow, left - pow, prec);
+        _arb_poly_mul(u, pb, pow, pa + pow + 1, left - pow + 1, prec);
+        _arb_vec_add(pb, t, u, left, prec);
+    }
+}
+
+typedef struct
+{
+    arb_ptr poly;
+    arb_ptr t;
+    arb_ptr u;
+    arb_ptr * tree;
+    slong len;
+    slong level;
+    slong prec;
+}
+interp_work_t;
+
+static void
+interp_worker(slong k, void * _work)
+{
+    interp_work_t * work = (interp_work_t *) _work;
+
+    _arb_poly_interpolate_fast_chunk(work->poly, work->t, work->u,
+        work->tree, work->len, work->level, k, work->prec);
+}
+
 void
 _arb_poly_interpolate_fast_precomp(arb_ptr poly,
     arb_srcptr ys, arb_ptr * tree, arb_srcptr weights,
     slong len, slong prec)
 {
-    arb_ptr t, u, pa, pb;
-    slong i, pow, left;
+    arb_ptr t, u;
+    slong i, k, num, pow;
+    int threaded;
 
     if (len == 0)
         return;
@@ -57,32 +110,35 @@ _arb_poly_interpolate_fast_precomp(arb_ptr poly,
     t = _arb_vec_init(len);
     u = _arb_vec_init(len);
 
+    threaded = (len >= ARB_POLY_TREE_THREAD_CUTOFF &&
+        flint_get_num_threads() > 1);
+
     for (i = 0; i < len; i++)
         arb_mul(poly + i, weights + i, ys + i, prec);
 
     for (i = 0; i < FLINT_CLOG2(len); i++)
     {
         pow = (WORD(1) << i);
-        pa = tree[i];
-        pb = poly;
-        left = len;
+        num = (len + 2 * pow - 1) / (2 * pow);
 
-        while (left >= 2 * pow)
+        if (threaded && num >= 2)
         {
-            _arb_poly_mul(t, pa, pow + 1, pb + pow, pow, prec);
-            _arb_poly_mul(u, pa + pow + 1, pow + 1, pb, pow, prec);
-            _arb_vec_add(pb, t, u, 2 * pow, prec);
+            interp_work_t work;
 
-            left -= 2 * pow;
-            pa += 2 * pow + 2;
-            pb += 2 * pow;
-        }
+            work.poly = poly;
+            work.t = t;
+            work.u = u;
+            work.tree = tree;
+            work.len = len;
+            work.level = i;
+            work.prec = prec;
 
-        if (left > pow)
+            flint_parallel_do((do_func_t) interp_worker, &work, num, -1, FLINT_PARALLEL_STRIDED);
+        }
+        else
         {
-            _arb_poly_mul(t, pa, pow + 1, pb + pow, left - pow, prec);
-            _arb_poly_mul(u, pb, pow, pa + pow + 1, left - pow + 1, prec);
-            _arb_vec_add(pb, t, u, left, prec);
+            for (k = 0; k < num; k++)
+                _arb_poly_interpolate_fast_chunk(poly, t, u, tree, len, i, k, prec);
         }
     }
 
@@ -125,3 +181,29 @@ arb_poly_interpolate_fast(arb_poly_t poly,
         _arb_poly_normalise(poly);
     }
 }
+
+void
+arb_poly_interpolate_tree(arb_poly_t poly,
+        arb_srcptr ys, arb_poly_tree_t T, slong prec)
+{
+    slong n = T->len;
+
+    if (n == 0)
+    {
+        arb_poly_zero(poly);
+        return;
+    }
+
+    /* The weights are computed on first use and kept with the tree. */
+    if (T->weights == NULL)
+    {
+        T->weights = _arb_vec_init(n);
+        _arb_poly_interpolation_weights(T->weights, T->tree, n, T->prec);
+    }
+
+    arb_poly_fit_length(poly, n);
+    _arb_poly_set_length(poly, n);
+    _arb_poly_interpolate_fast_precomp(poly->coeffs, ys,
+        T->tree, T->weights, n, prec);
+    _arb_poly_normalise(poly);
+}
@@ -0,0 +1,49 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_poly.h"
+
+int
+_arb_poly_mul_algorithm(arb_srcptr poly1, slong len1,
+    arb_srcptr poly2, slong len2, slong n, slong prec)
+{
+    slong cutoff;
+    double p;
+
+    if (n <= 7 || len1 <= 7 || len2 <= 7)
+        return ARB_POLY_MUL_CLASSICAL;
+
+    if (prec <= 2 * FLINT_BITS)
+    {
+        cutoff = 110;
+    }
+    else
+    {
+        p = log(prec);
+
+        cutoff = 10000.0 / (p * p * p);
+        cutoff = FLINT_MIN(cutoff, 60);
+        if (poly1 == poly2 && prec >= 256)
+            cutoff *= 1.25;
+        if (poly1 == poly2 && prec >= 4096)
+            cutoff *= 1.25;
+        cutoff = FLINT_MAX(cutoff, 8);
+    }
+
+    if (2 * FLINT_MIN(len1, len2) <= cutoff || n <= cutoff)
+        return ARB_POLY_MUL_CLASSICAL;
+
+    if (prec <= arb_tune_get(ARB_TUNE_POLY_MULLOW_FFT_MAX_PREC) &&
+        FLINT_MIN(len1, len2) >= arb_tune_get(ARB_TUNE_POLY_MULLOW_FFT_MIN_LEN))
+        return ARB_POLY_MUL_FFT;
+
+    return ARB_POLY_MUL_BLOCK;
+}
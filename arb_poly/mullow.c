@@ -20,36 +20,19 @@ _arb_poly_mullow(arb_ptr res,
     {
         arb_mul(res, poly1, poly2, prec);
     }
-    else if (n <= 7 || len1 <= 7 || len2 <= 7)
-    {
-        _arb_poly_mullow_classical(res, poly1, len1, poly2, len2, n, prec);
-    }
     else
     {
-        slong cutoff;
-        double p;
-
-        if (prec <= 2 * FLINT_BITS)
+        switch (_arb_poly_mul_algorithm(poly1, len1, poly2, len2, n, prec))
         {
-            cutoff = 110;
+            case ARB_POLY_MUL_CLASSICAL:
+                _arb_poly_mullow_classical(res, poly1, len1, poly2, len2, n, prec);
+                break;
+            case ARB_POLY_MUL_FFT:
+                _arb_poly_mullow_fft(res, poly1, len1, poly2, len2, n, prec);
+                break;
+            default:
+                _arb_poly_mullow_block(res, poly1, len1, poly2, len2, n, prec);
         }
-        else
-        {
-            p = log(prec);
-
-            cutoff = 10000.0 / (p * p * p);
-            cutoff = FLINT_MIN(cutoff, 60);
-            if (poly1 == poly2 && prec >= 256)
-                cutoff *= 1.25;
-            if (poly1 == poly2 && prec >= 4096)
-                cutoff *= 1.25;
-            cutoff = FLINT_MAX(cutoff, 8);
-        }
-
-        if (2 * FLINT_MIN(len1, len2) <= cutoff || n <= cutoff)
-            _arb_poly_mullow_classical(res, poly1, len1, poly2, len2, n, prec);
-        else
-            _arb_poly_mullow_block(res, poly1, len1, poly2, len2, n, prec);
     }
 }
 
@@ -51,11 +51,11 @@ _arb_poly_get_scale(fmpz_t scale, arb_srcptr x, slong xlen,
 
 /* Break vector into same-exponent blocks where the largest block
    has a height of at most ALPHA*prec + BETA bits. These are just
-   tuning parameters. Note that ALPHA * MAG_BITS + BETA
+   tuning parameters (see arb_tune_get). Note that ALPHA * MAG_BITS + BETA
    should be smaller than DOUBLE_BLOCK_MAX_HEIGHT if we want to use
-   doubles for error bounding. */
-#define ALPHA 3.0
-#define BETA 512
+   doubles for error bounding; arb_tune_set enforces this. */
+#define ALPHA (arb_tune_get(ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA) * 0.01)
+#define BETA arb_tune_get(ARB_TUNE_POLY_MULLOW_BLOCK_BETA)
 
 
 /* Maximum length of block for which we use double multiplication
@@ -71,11 +71,8 @@ _arb_poly_get_scale(fmpz_t scale, arb_srcptr x, slong xlen,
    sufficient, but it would be nice to include a formal proof here. */
 #define DOUBLE_ROUNDING_FACTOR (1.0 + 1e-9)
 
-/* Maximum height for which we use double multiplication. Since the dynamic
-   exponent range of doubles is about +/- 1024, this must be less than about
-   1024 (to allow the product of two numbers). This must also
-   account for adding MAG_BITS bits. */
-#define DOUBLE_BLOCK_MAX_HEIGHT 800
+/* Maximum height for which we use double multiplication (see arb_poly.h). */
+#define DOUBLE_BLOCK_MAX_HEIGHT ARB_POLY_DOUBLE_BLOCK_MAX_HEIGHT
 
 /* We divide coefficients by 2^DOUBLE_BLOCK_SHIFT when converting them to
    doubles, in order to use the whole exponent range. Note that this means
@@ -83,7 +80,7 @@ _arb_poly_get_scale(fmpz_t scale, arb_srcptr x, slong xlen,
 #define DOUBLE_BLOCK_SHIFT (DOUBLE_BLOCK_MAX_HEIGHT / 2)
 
 
-static void
+void
 _mag_vec_get_fmpz_2exp_blocks(fmpz * coeffs,
     double * dblcoeffs, fmpz * exps, slong * blocks, const fmpz_t scale,
     arb_srcptr x, mag_srcptr xm, slong len)
@@ -323,14 +320,45 @@ _arb_vec_get_fmpz_2exp_blocks(fmpz * coeffs, fmpz * exps,
     fmpz_clear(block_bot);
 }
 
-static void
-_arb_poly_addmullow_rad(arb_ptr z, fmpz * zz,
+/* Minimum length of both factors for computing an integer middle
+   product using number-theoretic transforms; below this, or when only
+   few low coefficients are skipped, the product is truncated with
+   fmpz_poly multiplication. This is just a tuning parameter
+   (see arb_tune_get). */
+#define MULMID_NTT_MIN_LENGTH arb_tune_get(ARB_TUNE_POLY_MULMID_NTT_MIN_LEN)
+
+/* Sets zz[k] for lo <= k < n to the coefficients of the product of
+   {x, xl} and {y, yl}, where 0 < n <= xl + yl - 1. The entries of zz
+   below lo are undefined. */
+void
+_arb_poly_fmpz_mulmid(fmpz * zz, const fmpz * x, slong xl,
+    const fmpz * y, slong yl, slong lo, slong n)
+{
+    if (lo > 0 && 4 * lo >= xl + yl - 1 &&
+        FLINT_MIN(xl, yl) >= MULMID_NTT_MIN_LENGTH)
+    {
+        _arb_poly_fmpz_mulmid_ntt(zz + lo, x, xl, y, yl, lo, n);
+    }
+    else if (xl >= yl)
+    {
+        _fmpz_poly_mullow(zz, x, xl, y, yl, n);
+    }
+    else
+    {
+        _fmpz_poly_mullow(zz, y, yl, x, xl, n);
+    }
+}
+
+/* Adds the radius products to {z, n - lo}, where z[k - lo] holds
+   the coefficient of index k of the product. */
+void
+_arb_poly_addmulmid_rad(arb_ptr z, fmpz * zz,
     const fmpz * xz, const double * xdbl, const fmpz * xexps,
     const slong * xblocks, slong xlen,
     const fmpz * yz, const double * ydbl, const fmpz * yexps,
-    const slong * yblocks, slong ylen, slong n)
+    const slong * yblocks, slong ylen, slong lo, slong n)
 {
-    slong i, j, k, ii, xp, yp, xl, yl, bn;
+    slong i, j, k, ii, xp, yp, xl, yl, bn, klo;
     fmpz_t zexp;
     mag_t t;
 
@@ -350,6 +378,10 @@ _arb_poly_addmullow_rad(arb_ptr z, fmpz * zz,
             xl = FLINT_MIN(xl, bn);
             yl = FLINT_MIN(yl, bn);
 
+            klo = FLINT_MAX(0, lo - xp - yp);
+            if (klo >= bn)
+                continue;
+
             fmpz_add_inline(zexp, xexps + i, yexps + j);
 
             if (xl > 1 && yl > 1 &&
@@ -357,7 +389,7 @@ _arb_poly_addmullow_rad(arb_ptr z, fmpz * zz,
             {
                 fmpz_add_ui(zexp, zexp, 2 * DOUBLE_BLOCK_SHIFT);
 
-                for (k = 0; k < bn; k++)
+                for (k = klo; k < bn; k++)
                 {
                     /* Classical multiplication (may round down!) */
                     double ss = 0.0;
@@ -372,22 +404,19 @@ _arb_poly_addmullow_rad(arb_ptr z, fmpz * zz,
                     ss *= DOUBLE_ROUNDING_FACTOR;
 
                     mag_set_d_2exp_fmpz(t, ss, zexp);
-                    mag_add(arb_radref(z + xp + yp + k),
-                            arb_radref(z + xp + yp + k), t);
+                    mag_add(arb_radref(z + xp + yp + k - lo),
+                            arb_radref(z + xp + yp + k - lo), t);
                 }
             }
             else
             {
-                if (xl >= yl)
-                    _fmpz_poly_mullow(zz, xz + xp, xl, yz + yp, yl, bn);
-                else
-                    _fmpz_poly_mullow(zz, yz + yp, yl, xz + xp, xl, bn);
+                _arb_poly_fmpz_mulmid(zz, xz + xp, xl, yz + yp, yl, klo, bn);
 
-                for (k = 0; k < bn; k++)
+                for (k = klo; k < bn; k++)
                 {
                     mag_set_fmpz_2exp_fmpz(t, zz + k, zexp);
-                    mag_add(arb_radref(z + xp + yp + k),
-                            arb_radref(z + xp + yp + k), t);
+                    mag_add(arb_radref(z + xp + yp + k - lo),
+                            arb_radref(z + xp + yp + k - lo), t);
                 }
             }
         }
@@ -398,12 +427,12 @@ _arb_poly_addmullow_rad(arb_ptr z, fmpz * zz,
 }
 
 static void
-_arb_poly_addmullow_block(arb_ptr z, fmpz * zz,
+_arb_poly_addmulmid_block(arb_ptr z, fmpz * zz,
     const fmpz * xz, const fmpz * xexps, const slong * xblocks, slong xlen,
     const fmpz * yz, const fmpz * yexps, const slong * yblocks, slong ylen,
-    slong n, slong prec, int squaring)
+    slong lo, slong n, slong prec, int squaring)
 {
-    slong i, j, k, xp, yp, xl, yl, bn;
+    slong i, j, k, xp, yp, xl, yl, bn, klo;
     fmpz_t zexp;
 
     fmpz_init(zexp);
@@ -419,11 +448,15 @@ _arb_poly_addmullow_block(arb_ptr z, fmpz * zz,
             bn = FLINT_MIN(2 * xl - 1, n - 2 * xp);
             xl = FLINT_MIN(xl, bn);
 
+            klo = FLINT_MAX(0, lo - 2 * xp);
+            if (klo >= bn)
+                continue;
+
             _fmpz_poly_sqrlow(zz, xz + xp, xl, bn);
             _fmpz_add2_fast(zexp, xexps + i, xexps + i, 0);
 
-            for (k = 0; k < bn; k++)
-                arb_add_fmpz_2exp(z + 2 * xp + k, z + 2 * xp + k, zz + k, zexp, prec);
+            for (k = klo; k < bn; k++)
+                arb_add_fmpz_2exp(z + 2 * xp + k - lo, z + 2 * xp + k - lo, zz + k, zexp, prec);
         }
     }
 
@@ -440,15 +473,16 @@ _arb_poly_addmullow_block(arb_ptr z, fmpz * zz,
             xl = FLINT_MIN(xl, bn);
             yl = FLINT_MIN(yl, bn);
 
-            if (xl >= yl)
-                _fmpz_poly_mullow(zz, xz + xp, xl, yz + yp, yl, bn);
-            else
-                _fmpz_poly_mullow(zz, yz + yp, yl, xz + xp, xl, bn);
+            klo = FLINT_MAX(0, lo - xp - yp);
+            if (klo >= bn)
+                continue;
+
+            _arb_poly_fmpz_mulmid(zz, xz + xp, xl, yz + yp, yl, klo, bn);
 
            _fmpz_add2_fast(zexp, xexps + i, yexps + j, squaring);
 
-            for (k = 0; k < bn; k++)
-                arb_add_fmpz_2exp(z + xp + yp + k, z + xp + yp + k, zz + k, zexp, prec);
+            for (k = klo; k < bn; k++)
+                arb_add_fmpz_2exp(z + xp + yp + k - lo, z + xp + yp + k - lo, zz + k, zexp, prec);
         }
     }
 
@@ -456,8 +490,8 @@ _arb_poly_addmullow_block(arb_ptr z, fmpz * zz,
 }
 
 void
-_arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
-                                arb_srcptr y, slong ylen, slong n, slong prec)
+_arb_poly_mulmid_block(arb_ptr z, arb_srcptr x, slong xlen,
+    arb_srcptr y, slong ylen, slong lo, slong n, slong prec)
 {
     slong xmlen, xrlen, ymlen, yrlen, i;
     fmpz *xz, *yz, *zz;
@@ -492,7 +526,7 @@ _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
     if (!_arb_vec_is_finite(x, xlen) ||
         (!squaring && !_arb_vec_is_finite(y, ylen)))
     {
-        _arb_poly_mullow_classical(z, x, xlen, y, ylen, n, prec);
+        _arb_poly_mulmid_classical(z, x, xlen, y, ylen, lo, n, prec);
         return;
     }
 
@@ -500,10 +534,10 @@ _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
     ylen = FLINT_MAX(ymlen, yrlen);
 
     /* Start with the zero polynomial */
-    _arb_vec_zero(z, n);
+    _arb_vec_zero(z, n - lo);
 
     /* Nothing to do */
-    if (xlen == 0 || ylen == 0)
+    if (xlen == 0 || ylen == 0 || xlen + ylen - 1 <= lo)
         return;
 
     n = FLINT_MIN(n, xlen + ylen - 1);
@@ -546,7 +580,7 @@ _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
             }
 
             _mag_vec_get_fmpz_2exp_blocks(yz, ydbl, ye, yblocks, scale, NULL, tmp, xlen);
-            _arb_poly_addmullow_rad(z, zz, xz, xdbl, xe, xblocks, xrlen, yz, ydbl, ye, yblocks, xlen, n);
+            _arb_poly_addmulmid_rad(z, zz, xz, xdbl, xe, xblocks, xrlen, yz, ydbl, ye, yblocks, xlen, lo, n);
         }
         else if (yrlen == 0)
         {
@@ -557,7 +591,7 @@ _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
                 arf_get_mag(tmp + i, arb_midref(y + i));
 
             _mag_vec_get_fmpz_2exp_blocks(yz, ydbl, ye, yblocks, scale, NULL, tmp, ymlen);
-            _arb_poly_addmullow_rad(z, zz, xz, xdbl, xe, xblocks, xrlen, yz, ydbl, ye, yblocks, ymlen, n);
+            _arb_poly_addmulmid_rad(z, zz, xz, xdbl, xe, xblocks, xrlen, yz, ydbl, ye, yblocks, ymlen, lo, n);
         }
         else
         {
@@ -567,7 +601,7 @@ _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
 
             _mag_vec_get_fmpz_2exp_blocks(xz, xdbl, xe, xblocks, scale, NULL, tmp, xmlen);
             _mag_vec_get_fmpz_2exp_blocks(yz, ydbl, ye, yblocks, scale, y, NULL, yrlen);
-            _arb_poly_addmullow_rad(z, zz, xz, xdbl, xe, xblocks, xmlen, yz, ydbl, ye, yblocks, yrlen, n);
+            _arb_poly_addmulmid_rad(z, zz, xz, xdbl, xe, xblocks, xmlen, yz, ydbl, ye, yblocks, yrlen, lo, n);
 
             /* xr*(|ym| + yr) */
             if (xrlen != 0)
@@ -578,7 +612,7 @@ _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
                     arb_get_mag(tmp + i, y + i);
 
                 _mag_vec_get_fmpz_2exp_blocks(yz, ydbl, ye, yblocks, scale, NULL, tmp, ylen);
-                _arb_poly_addmullow_rad(z, zz, xz, xdbl, xe, xblocks, xrlen, yz, ydbl, ye, yblocks, ylen, n);
+                _arb_poly_addmulmid_rad(z, zz, xz, xdbl, xe, xblocks, xrlen, yz, ydbl, ye, yblocks, ylen, lo, n);
             }
         }
 
@@ -594,20 +628,20 @@ _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
 
         if (squaring)
         {
-            _arb_poly_addmullow_block(z, zz, xz, xe, xblocks, xmlen, xz, xe, xblocks, xmlen, n, prec, 1);
+            _arb_poly_addmulmid_block(z, zz, xz, xe, xblocks, xmlen, xz, xe, xblocks, xmlen, lo, n, prec, 1);
         }
         else
         {
             _arb_vec_get_fmpz_2exp_blocks(yz, ye, yblocks, scale, y, ymlen, prec);
-            _arb_poly_addmullow_block(z, zz, xz, xe, xblocks, xmlen, yz, ye, yblocks, ymlen, n, prec, 0);
+            _arb_poly_addmulmid_block(z, zz, xz, xe, xblocks, xmlen, yz, ye, yblocks, ymlen, lo, n, prec, 0);
         }
     }
 
     /* Unscale. */
     if (!fmpz_is_zero(scale))
     {
-        fmpz_zero(t);
-        for (i = 0; i < n; i++)
+        fmpz_mul_si(t, scale, lo);
+        for (i = 0; i < n - lo; i++)
         {
             arb_mul_2exp_fmpz(z + i, z + i, t);
             fmpz_add(t, t, scale);
@@ -625,6 +659,13 @@ _arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
     fmpz_clear(t);
 }
 
+void
+_arb_poly_mullow_block(arb_ptr z, arb_srcptr x, slong xlen,
+                                arb_srcptr y, slong ylen, slong n, slong prec)
+{
+    _arb_poly_mulmid_block(z, x, xlen, y, ylen, 0, n, prec);
+}
+
 void
 arb_poly_mullow_block(arb_poly_t res, const arb_poly_t poly1,
               const arb_poly_t poly2, slong n, slong prec)
@@ -664,3 +705,39 @@ arb_poly_mullow_block(arb_poly_t res, const arb_poly_t poly1,
     _arb_poly_normalise(res);
 }
 
+
+void
+arb_poly_mulmid_block(arb_poly_t res, const arb_poly_t poly1,
+    const arb_poly_t poly2, slong lo, slong hi, slong prec)
+{
+    slong len;
+
+    hi = FLINT_MIN(hi, poly1->length + poly2->length - 1);
+
+    if (poly1->length == 0 || poly2->length == 0 || hi <= lo)
+    {
+        arb_poly_zero(res);
+        return;
+    }
+
+    len = hi - lo;
+
+    if (res == poly1 || res == poly2)
+    {
+        arb_poly_t tmp;
+        arb_poly_init2(tmp, len);
+        _arb_poly_mulmid_block(tmp->coeffs, poly1->coeffs, poly1->length,
+            poly2->coeffs, poly2->length, lo, hi, prec);
+        arb_poly_swap(res, tmp);
+        arb_poly_clear(tmp);
+    }
+    else
+    {
+        arb_poly_fit_length(res, len);
+        _arb_poly_mulmid_block(res->coeffs, poly1->coeffs, poly1->length,
+            poly2->coeffs, poly2->length, lo, hi, prec);
+    }
+
+    _arb_poly_set_length(res, len);
+    _arb_poly_normalise(res);
+}
@@ -0,0 +1,850 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include "arb_poly.h"
+
+void _arb_poly_get_scale(fmpz_t scale, arb_srcptr x, slong xlen,
+                                  arb_srcptr y, slong ylen);
+
+/* Extra bits kept in the fixed-point midpoints beyond what is needed
+   for prec-bit accuracy relative to the smallest nonzero coefficient. */
+#define FFT_GUARD_BITS 16
+
+/* Give up (use the block algorithm) if the scaled midpoints of
+   both inputs together span more than this many bits. */
+#define FFT_MAX_RANGE(prec) (prec)
+
+/* Range for the number of bits per digit. Fewer bits per digit means
+   more transforms; below the minimum the block algorithm is faster. */
+#define FFT_MIN_DIGIT_BITS 8
+#define FFT_MAX_DIGIT_BITS 24
+
+/* Give up if the inputs need more digits than this in total. */
+#define FFT_MAX_DIGITS 64
+
+/* Give up if the transforms need more doubles than this. */
+#define FFT_MAX_ALLOC (WORD(1) << 27)
+
+/* Nonzero radii are represented as doubles relative to the largest entry;
+   tiny entries are rounded up to this value to avoid underflow. */
+#define FFT_MAG_FLOOR_EXP (-600)
+
+/* Bound for the absolute error of the computed roots of unity. The
+   argument 2 pi j / N is correct to within 2 pi eps, and cos and sin
+   are accurate to within an ulp; 2^-50 leaves a comfortable margin. */
+#define FFT_ROOT_ERROR_EXP (-50)
+
+/* Upper bound for the error factor in Percival's bound
+   ||z' - z||_oo < ||x|| ||y|| ((1+eps)^(3k) (1+eps sqrt(5))^(3k+1)
+   (1+beta)^(3k) - 1) for a cyclic convolution computed via transforms
+   of length 2^k, where we allow m extra roundings for packing, unpacking
+   and accumulating products. We use (1+t)^e <= exp(e t) and
+   exp(u) - 1 <= u (1 + u) for 0 <= u <= 1, and finally
+   include a factor 2 as safety margin. */
+static double
+_fft_error_factor(slong k, slong m)
+{
+    double eps, beta, u;
+
+    eps = ldexp(1.0, -53);
+    beta = ldexp(1.0, FFT_ROOT_ERROR_EXP);
+
+    u = (3 * k + m) * eps + (3 * k + 1) * 2.2361 * eps + 3 * k * beta;
+
+    return 2.0 * u * (1.0 + u);
+}
+
+static void
+_fft_roots(double * w, slong N)
+{
+    slong j;
+    double t;
+
+    for (j = 0; j < N / 2; j++)
+    {
+        t = (6.283185307179586 * j) / N;
+        w[2 * j] = cos(t);
+        w[2 * j + 1] = -sin(t);
+    }
+}
+
+/* In-place radix-2 transform of length N of the interleaved
+   complex vector z. The inverse transform uses the conjugate roots
+   and is not divided by N. */
+static void
+_fft(double * z, const double * w, slong N, int inverse)
+{
+    slong i, j, m, bit, len, half, step;
+    double ar, ai, br, bi, tr, ti, wr, wi;
+
+    for (i = 1, j = 0; i < N; i++)
+    {
+        for (bit = N >> 1; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+
+        if (i < j)
+        {
+            tr = z[2 * i]; z[2 * i] = z[2 * j]; z[2 * j] = tr;
+            ti = z[2 * i + 1]; z[2 * i + 1] = z[2 * j + 1]; z[2 * j + 1] = ti;
+        }
+    }
+
+    for (len = 2; len <= N; len *= 2)
+    {
+        half = len / 2;
+        step = N / len;
+
+        for (m = 0; m < half; m++)
+        {
+            wr = w[2 * m * step];
+            wi = inverse ? -w[2 * m * step + 1] : w[2 * m * step + 1];
+
+            for (i = m; i < N; i += len)
+            {
+                ar = z[2 * i];
+                ai = z[2 * i + 1];
+                br = z[2 * (i + half)];
+                bi = z[2 * (i + half) + 1];
+
+                tr = br * wr - bi * wi;
+                ti = br * wi + bi * wr;
+
+                z[2 * i] = ar + tr;
+                z[2 * i + 1] = ai + ti;
+                z[2 * (i + half)] = ar - tr;
+                z[2 * (i + half) + 1] = ai - ti;
+            }
+        }
+    }
+}
+
+/* Given the transform c of a + i b where a, b are real, writes the
+   first N/2 + 1 entries of the transforms of a and b. */
+static void
+_fft_unpack(double * a, double * b, const double * c, slong N)
+{
+    slong j, jj;
+    double p, q, r, s;
+
+    for (j = 0; j <= N / 2; j++)
+    {
+        jj = (j == 0) ? 0 : N - j;
+
+        p = c[2 * j];
+        q = c[2 * j + 1];
+        r = c[2 * jj];
+        s = c[2 * jj + 1];
+
+        a[2 * j] = 0.5 * (p + r);
+        a[2 * j + 1] = 0.5 * (q - s);
+
+        if (b != NULL)
+        {
+            b[2 * j] = 0.5 * (q + s);
+            b[2 * j + 1] = 0.5 * (r - p);
+        }
+    }
+}
+
+/* Given the first N/2 + 1 entries of the transforms of real vectors
+   u and v (v may be NULL), writes the full transform of u + i v. */
+static void
+_fft_pack(double * c, const double * u, const double * v, slong N)
+{
+    slong j;
+    double ur, ui, vr, vi;
+
+    for (j = 0; j <= N / 2; j++)
+    {
+        ur = u[2 * j];
+        ui = u[2 * j + 1];
+        vr = (v == NULL) ? 0.0 : v[2 * j];
+        vi = (v == NULL) ? 0.0 : v[2 * j + 1];
+
+        c[2 * j] = ur - vi;
+        c[2 * j + 1] = ui + vr;
+
+        if (j != 0 && j != N / 2)
+        {
+            c[2 * (N - j)] = ur + vi;
+            c[2 * (N - j) + 1] = vr - ui;
+        }
+    }
+}
+
+/* Returns nbits < FLINT_BITS bits of {d, dn} starting at bit pos
+   (which may be negative; bits outside the array are zero). */
+static ulong
+_mpn_get_bits(mp_srcptr d, slong dn, slong pos, int nbits)
+{
+    ulong r;
+    slong q;
+    int s;
+
+    if (pos < 0)
+    {
+        if (pos + nbits <= 0)
+            return 0;
+
+        return _mpn_get_bits(d, dn, 0, nbits + pos) << (-pos);
+    }
+
+    q = pos / FLINT_BITS;
+    s = pos % FLINT_BITS;
+
+    if (q >= dn)
+        return 0;
+
+    r = d[q] >> s;
+    if (s != 0 && s + nbits > FLINT_BITS && q + 1 < dn)
+        r |= d[q + 1] << (FLINT_BITS - s);
+
+    return r & ((UWORD(1) << nbits) - 1);
+}
+
+/* Checks if any of the lowest nbits bits of {d, dn} is nonzero. */
+static int
+_mpn_low_bits_nonzero(mp_srcptr d, slong dn, slong nbits)
+{
+    slong i, q;
+    int s;
+
+    q = nbits / FLINT_BITS;
+    s = nbits % FLINT_BITS;
+
+    for (i = 0; i < FLINT_MIN(q, dn); i++)
+        if (d[i] != 0)
+            return 1;
+
+    if (q < dn && s != 0 && (d[q] & ((UWORD(1) << s) - 1)) != 0)
+        return 1;
+
+    return 0;
+}
+
+/* Adds v * 2^pos to {d, dn}, assuming that no carries occur. */
+static void
+_mpn_or_bits(mp_ptr d, slong dn, slong pos, ulong v)
+{
+    slong q;
+    int s;
+
+    q = pos / FLINT_BITS;
+    s = pos % FLINT_BITS;
+
+    d[q] |= v << s;
+    if (s != 0 && q + 1 < dn)
+        d[q + 1] |= v >> (FLINT_BITS - s);
+}
+
+/* Writes upper bounds for the entries of x as doubles d_i <= 1
+   with d_i 2^e >= x_i, and returns the squared 2-norm of d
+   (rounded up). All entries must have small exponents. */
+static double
+_mag_vec_get_d_normalised(double * d, slong * e, mag_srcptr x, slong len)
+{
+    slong i, r, ei;
+    double s;
+    int nonzero;
+
+    r = 0;
+    nonzero = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        if (!mag_is_zero(x + i))
+        {
+            ei = MAG_EXP(x + i);
+            r = nonzero ? FLINT_MAX(r, ei) : ei;
+            nonzero = 1;
+        }
+    }
+
+    *e = r;
+    s = 0.0;
+
+    for (i = 0; i < len; i++)
+    {
+        if (mag_is_zero(x + i))
+        {
+            d[i] = 0.0;
+        }
+        else
+        {
+            ei = MAG_EXP(x + i) - r;
+
+            if (ei < FFT_MAG_FLOOR_EXP)
+                d[i] = ldexp(1.0, FFT_MAG_FLOOR_EXP);
+            else
+                d[i] = ldexp(MAG_MAN(x + i), ei - MAG_BITS);
+
+            s += d[i] * d[i];
+        }
+    }
+
+    /* at most len roundings, each with relative error 2^-53 */
+    return s * (1.0 + 1e-6);
+}
+
+static int
+_mag_vec_is_zero(mag_srcptr x, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        if (!mag_is_zero(x + i))
+            return 0;
+
+    return 1;
+}
+
+/* Scaled exponent and fixed-point analysis of the midpoints of x. */
+typedef struct
+{
+    slong top;      /* largest scaled exponent */
+    slong mintop;   /* smallest scaled exponent */
+    slong bot;      /* smallest scaled exponent of the lowest bit */
+    int nonzero;
+}
+fft_exp_info_t;
+
+static void
+_arb_vec_fft_exp_info(fft_exp_info_t * info, arb_srcptr x, slong len, slong scale)
+{
+    slong i, e;
+
+    info->nonzero = 0;
+    info->top = info->mintop = info->bot = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        if (arf_is_zero(arb_midref(x + i)))
+            continue;
+
+        e = ARF_EXP(arb_midref(x + i)) - scale * i;
+
+        if (!info->nonzero)
+        {
+            info->top = info->mintop = e;
+            info->bot = e - arf_bits(arb_midref(x + i));
+            info->nonzero = 1;
+        }
+        else
+        {
+            info->top = FLINT_MAX(info->top, e);
+            info->mintop = FLINT_MIN(info->mintop, e);
+            info->bot = FLINT_MIN(info->bot, e - arf_bits(arb_midref(x + i)));
+        }
+    }
+}
+
+/* Computes the radii {z, n} (overwriting them) given truncation error
+   flags for the fixed-point midpoints; xtrunc, ytrunc are the exponents
+   of the truncation errors. */
+static void
+_arb_poly_mullow_fft_rad(arb_ptr z, arb_srcptr x, const char * xinexact,
+    slong xtrunc, slong xlen, arb_srcptr y, const char * yinexact,
+    slong ytrunc, slong ylen, slong n, slong scale, slong N, slong k,
+    const double * w)
+{
+    mag_ptr A1, A2, B1, B2;
+    double *a1, *a2, *b1, *b2, *c;
+    double na, nb, err, t;
+    slong i, ea1, ea2, eb1, eb2;
+    int zero1, zero2;
+    mag_t u;
+
+    A1 = _mag_vec_init(xlen);
+    A2 = _mag_vec_init(xlen);
+    B1 = _mag_vec_init(ylen);
+    B2 = _mag_vec_init(ylen);
+
+    /* A1 = |xm|, A2 = xr, B1 = yr, B2 = |ym| + yr (all scaled) */
+    for (i = 0; i < xlen; i++)
+    {
+        arf_get_mag(A1 + i, arb_midref(x + i));
+        mag_mul_2exp_si(A1 + i, A1 + i, -scale * i);
+        mag_mul_2exp_si(A2 + i, arb_radref(x + i), -scale * i);
+        if (xinexact[i])
+            mag_add_ui_2exp_si(A2 + i, A2 + i, 1, xtrunc);
+    }
+
+    for (i = 0; i < ylen; i++)
+    {
+        mag_mul_2exp_si(B1 + i, arb_radref(y + i), -scale * i);
+        if (yinexact[i])
+            mag_add_ui_2exp_si(B1 + i, B1 + i, 1, ytrunc);
+        arf_get_mag(B2 + i, arb_midref(y + i));
+        mag_mul_2exp_si(B2 + i, B2 + i, -scale * i);
+        mag_add(B2 + i, B2 + i, B1 + i);
+    }
+
+    zero1 = _mag_vec_is_zero(A1, xlen) || _mag_vec_is_zero(B1, ylen);
+    zero2 = _mag_vec_is_zero(A2, xlen) || _mag_vec_is_zero(B2, ylen);
+
+    a1 = flint_calloc(N + 2, sizeof(double));
+    a2 = flint_calloc(N + 2, sizeof(double));
+    b1 = flint_calloc(N + 2, sizeof(double));
+    b2 = flint_calloc(N + 2, sizeof(double));
+    c = flint_calloc(2 * N, sizeof(double));
+
+    /* Transform A1 + i A2 (use b1, b2 as temporary space for the
+       real vectors). */
+    na = _mag_vec_get_d_normalised(b1, &ea1, A1, xlen);
+    na += _mag_vec_get_d_normalised(b2, &ea2, A2, xlen);
+    for (i = 0; i < xlen; i++)
+    {
+        c[2 * i] = b1[i];
+        c[2 * i + 1] = b2[i];
+    }
+    _fft(c, w, N, 0);
+    _fft_unpack(a1, a2, c, N);
+
+    for (i = 0; i < 2 * N; i++)
+        c[i] = 0.0;
+
+    nb = _mag_vec_get_d_normalised(b1, &eb1, B1, ylen);
+    for (i = 0; i < ylen; i++)
+        c[2 * i] = b1[i];
+    nb += _mag_vec_get_d_normalised(b1, &eb2, B2, ylen);
+    for (i = 0; i < ylen; i++)
+        c[2 * i + 1] = b1[i];
+    _fft(c, w, N, 0);
+    _fft_unpack(b1, b2, c, N);
+
+    /* pointwise products; we only need half the spectrum */
+    for (i = 0; i <= N / 2; i++)
+    {
+        double ar, ai, br, bi;
+
+        ar = a1[2 * i]; ai = a1[2 * i + 1];
+        br = b1[2 * i]; bi = b1[2 * i + 1];
+        a1[2 * i] = ar * br - ai * bi;
+        a1[2 * i + 1] = ar * bi + ai * br;
+
+        ar = a2[2 * i]; ai = a2[2 * i + 1];
+        br = b2[2 * i]; bi = b2[2 * i + 1];
+        a2[2 * i] = ar * br - ai * bi;
+        a2[2 * i + 1] = ar * bi + ai * br;
+    }
+
+    _fft_pack(c, a1, a2, N);
+    _fft(c, w, N, 1);
+
+    err = _fft_error_factor(k, 4) * sqrt(na) * sqrt(nb);
+
+    mag_init(u);
+
+    for (i = 0; i < n; i++)
+    {
+        mag_zero(arb_radref(z + i));
+
+        if (!zero1)
+        {
+            t = c[2 * i] / N;
+            t = (FLINT_MAX(t, 0.0) + err) * (1.0 + 1e-12);
+            mag_set_d(u, t);
+            mag_mul_2exp_si(u, u, ea1 + eb1 + scale * i);
+            mag_add(arb_radref(z + i), arb_radref(z + i), u);
+        }
+
+        if (!zero2)
+        {
+            t = c[2 * i + 1] / N;
+            t = (FLINT_MAX(t, 0.0) + err) * (1.0 + 1e-12);
+            mag_set_d(u, t);
+            mag_mul_2exp_si(u, u, ea2 + eb2 + scale * i);
+            mag_add(arb_radref(z + i), arb_radref(z + i), u);
+        }
+    }
+
+    mag_clear(u);
+
+    flint_free(a1);
+    flint_free(a2);
+    flint_free(b1);
+    flint_free(b2);
+    flint_free(c);
+
+    _mag_vec_clear(A1, xlen);
+    _mag_vec_clear(A2, xlen);
+    _mag_vec_clear(B1, ylen);
+    _mag_vec_clear(B2, ylen);
+}
+
+/* Transforms the b-bit digits of the fixed-point midpoints of x.
+   The midpoint x_i is truncated to an integer multiple of 2^(top-height)
+   (after scaling); xinexact[i] is set if this is inexact. */
+static void
+_arb_vec_fft_digits(double * spec, char * xinexact, arb_srcptr x, slong len,
+    slong scale, slong top, slong height, slong b, slong L,
+    double * c, const double * w, slong N)
+{
+    slong i, a, sh, xn;
+    mp_srcptr xp;
+    double d0, d1;
+    int neg;
+
+    for (i = 0; i < len; i++)
+    {
+        xinexact[i] = 0;
+
+        if (arf_is_zero(arb_midref(x + i)))
+            continue;
+
+        ARF_GET_MPN_READONLY(xp, xn, arb_midref(x + i));
+        sh = ARF_EXP(arb_midref(x + i)) - scale * i - xn * FLINT_BITS - top + height;
+
+        if (sh < 0)
+            xinexact[i] = _mpn_low_bits_nonzero(xp, xn, -sh);
+    }
+
+    for (a = 0; a < L; a += 2)
+    {
+        for (i = 0; i < 2 * N; i++)
+            c[i] = 0.0;
+
+        for (i = 0; i < len; i++)
+        {
+            if (arf_is_zero(arb_midref(x + i)))
+                continue;
+
+            ARF_GET_MPN_READONLY(xp, xn, arb_midref(x + i));
+            sh = ARF_EXP(arb_midref(x + i)) - scale * i - xn * FLINT_BITS - top + height;
+            neg = ARF_SGNBIT(arb_midref(x + i));
+
+            d0 = _mpn_get_bits(xp, xn, a * b - sh, b);
+            d1 = (a + 1 < L) ? _mpn_get_bits(xp, xn, (a + 1) * b - sh, b) : 0;
+
+            c[2 * i] = neg ? -d0 : d0;
+            c[2 * i + 1] = neg ? -d1 : d1;
+        }
+
+        _fft(c, w, N, 0);
+        _fft_unpack(spec + a * (N + 2),
+            (a + 1 < L) ? spec + (a + 1) * (N + 2) : NULL, c, N);
+    }
+}
+
+static int
+_arb_poly_mullow_fft_try(arb_ptr z, arb_srcptr x, slong xlen,
+    arb_srcptr y, slong ylen, slong n, slong prec)
+{
+    fft_exp_info_t xinfo, yinfo;
+    slong i, j, s, a, b, k, N, Lx, Ly, Lz, Lmin, hx, hy, m, range, scale;
+    slong zexp, alloc;
+    double bound, *w, *c, *xspec, *yspec, *u, *v;
+    char *xinexact, *yinexact;
+    slong * acc;
+    mp_ptr buf, tmp;
+    int squaring, midzero, ok;
+    fmpz_t t;
+
+    squaring = (x == y) && (xlen == ylen);
+
+    for (i = 0; i < xlen; i++)
+        if (!ARB_IS_LAGOM(x + i))
+            return 0;
+
+    if (!squaring)
+        for (i = 0; i < ylen; i++)
+            if (!ARB_IS_LAGOM(y + i))
+                return 0;
+
+    fmpz_init(t);
+    _arb_poly_get_scale(t, x, xlen, y, ylen);
+    if (fmpz_cmp_si(t, -ARF_MAX_LAGOM_EXP / (xlen + ylen)) <= 0 ||
+        fmpz_cmp_si(t, ARF_MAX_LAGOM_EXP / (xlen + ylen)) >= 0)
+    {
+        fmpz_clear(t);
+        return 0;
+    }
+    scale = fmpz_get_si(t);
+    fmpz_clear(t);
+
+    _arb_vec_fft_exp_info(&xinfo, x, xlen, scale);
+    if (squaring)
+        yinfo = xinfo;
+    else
+        _arb_vec_fft_exp_info(&yinfo, y, ylen, scale);
+
+    midzero = !xinfo.nonzero || !yinfo.nonzero;
+
+    for (k = 0; (WORD(1) << k) < xlen + ylen - 1; k++) ;
+    N = WORD(1) << k;
+
+    hx = hy = b = Lx = Ly = 0;
+
+    if (!midzero)
+    {
+        range = (xinfo.top - xinfo.mintop) + (yinfo.top - yinfo.mintop);
+
+        if (range > FFT_MAX_RANGE(prec))
+            return 0;
+
+        hx = prec + range + FLINT_BIT_COUNT(n) + FFT_GUARD_BITS;
+        hy = FLINT_MIN(hx, yinfo.top - yinfo.bot);
+        hx = FLINT_MIN(hx, xinfo.top - xinfo.bot);
+
+        /* Find the largest digit size for which exact rounding of the
+           convolutions is guaranteed. */
+        for (b = FFT_MAX_DIGIT_BITS; b >= FFT_MIN_DIGIT_BITS; b--)
+        {
+            Lx = (hx + b - 1) / b;
+            Ly = (hy + b - 1) / b;
+            Lmin = FLINT_MIN(Lx, Ly);
+
+            bound = _fft_error_factor(k, 2 * Lmin + 4) * 2 * Lmin;
+            bound *= sqrt(2.0 * xlen) * sqrt(2.0 * ylen) * ldexp(1.0, 2 * b);
+
+            if (bound < 0.25)
+                break;
+        }
+
+        if (b < FFT_MIN_DIGIT_BITS || Lx + Ly > FFT_MAX_DIGITS)
+            return 0;
+
+        alloc = (Lx + (squaring ? 0 : Ly)) * (N + 2) + 4 * N;
+        if (alloc > FFT_MAX_ALLOC)
+            return 0;
+    }
+
+    w = flint_malloc(sizeof(double) * N);
+    _fft_roots(w, N);
+
+    xinexact = flint_calloc(xlen, sizeof(char));
+    yinexact = squaring ? xinexact : flint_calloc(ylen, sizeof(char));
+
+    xspec = yspec = NULL;
+    c = flint_malloc(sizeof(double) * 2 * N);
+
+    if (!midzero)
+    {
+        xspec = flint_malloc(sizeof(double) * Lx * (N + 2));
+        _arb_vec_fft_digits(xspec, xinexact, x, xlen, scale,
+            xinfo.top, hx, b, Lx, c, w, N);
+
+        if (squaring)
+        {
+            yspec = xspec;
+        }
+        else
+        {
+            yspec = flint_malloc(sizeof(double) * Ly * (N + 2));
+            _arb_vec_fft_digits(yspec, yinexact, y, ylen, scale,
+                yinfo.top, hy, b, Ly, c, w, N);
+        }
+    }
+
+    /* Radii, including the truncation errors of the midpoints. */
+    _arb_poly_mullow_fft_rad(z, x, xinexact, xinfo.top - hx, xlen,
+        y, yinexact, yinfo.top - hy, ylen, n, scale, N, k, w);
+
+    ok = 1;
+
+    if (midzero)
+    {
+        for (i = 0; i < n; i++)
+            arf_zero(arb_midref(z + i));
+    }
+    else
+    {
+        Lz = Lx + Ly - 1;
+        m = (Lz * b) / FLINT_BITS + 2;
+
+        acc = flint_calloc(n, sizeof(slong));
+        buf = flint_calloc(n * m, sizeof(mp_limb_t));
+        tmp = flint_malloc(m * sizeof(mp_limb_t));
+        u = flint_malloc(sizeof(double) * (N + 2));
+        v = flint_malloc(sizeof(double) * (N + 2));
+
+        for (s = 0; s < Lz && ok; s += 2)
+        {
+            /* u = sum_a X_a Y_(s-a), v = sum_a X_a Y_(s+1-a) */
+            for (j = 0; j < N + 2; j++)
+                u[j] = v[j] = 0.0;
+
+            for (a = FLINT_MAX(0, s - Ly + 1); a <= FLINT_MIN(Lx - 1, s + 1); a++)
+            {
+                const double * xa = xspec + a * (N + 2);
+                const double * yb;
+
+                if (s - a >= 0 && s - a < Ly)
+                {
+                    yb = yspec + (s - a) * (N + 2);
+                    for (j = 0; j <= N / 2; j++)
+                    {
+                        u[2 * j] += xa[2 * j] * yb[2 * j] - xa[2 * j + 1] * yb[2 * j + 1];
+                        u[2 * j + 1] += xa[2 * j] * yb[2 * j + 1] + xa[2 * j + 1] * yb[2 * j];
+                    }
+                }
+
+                if (s + 1 < Lz && s + 1 - a < Ly)
+                {
+                    yb = yspec + (s + 1 - a) * (N + 2);
+                    for (j = 0; j <= N / 2; j++)
+                    {
+                        v[2 * j] += xa[2 * j] * yb[2 * j] - xa[2 * j + 1] * yb[2 * j + 1];
+                        v[2 * j + 1] += xa[2 * j] * yb[2 * j + 1] + xa[2 * j + 1] * yb[2 * j];
+                    }
+                }
+            }
+
+            _fft_pack(c, u, (s + 1 < Lz) ? v : NULL, N);
+            _fft(c, w, N, 1);
+
+            /* Round to integers and write b-bit digits, propagating
+               the (signed) carries. */
+            for (i = 0; i < n && ok; i++)
+            {
+                for (j = 0; j < 2 && s + j < Lz; j++)
+                {
+                    double r, q;
+                    ulong d;
+
+                    r = c[2 * i + j] / N;
+                    q = floor(r + 0.5);
+
+                    /* Cannot happen if the error bound is correct;
+                       if it does, let the caller use another algorithm. */
+                    if (fabs(r - q) > 0.375)
+                    {
+                        ok = 0;
+                        break;
+                    }
+
+                    acc[i] += (slong) q;
+                    d = ((ulong) acc[i]) & ((UWORD(1) << b) - 1);
+                    if (d != 0)
+                        _mpn_or_bits(buf + i * m, m, (s + j) * b, d);
+                    acc[i] = (acc[i] - (slong) d) / (WORD(1) << b);
+                }
+            }
+        }
+
+        zexp = (xinfo.top - hx) + (yinfo.top - hy);
+
+        for (i = 0; i < n && ok; i++)
+        {
+            mp_ptr zp = buf + i * m;
+            slong zn, fix;
+            int negative, inexact;
+
+            negative = (acc[i] < 0);
+
+            if (acc[i] > 0)
+            {
+                _mpn_or_bits(zp, m, Lz * b, acc[i]);
+            }
+            else if (negative)
+            {
+                flint_mpn_zero(tmp, m);
+                _mpn_or_bits(tmp, m, Lz * b, -(ulong) acc[i]);
+                mpn_sub_n(zp, tmp, zp, m);
+            }
+
+            zn = m;
+            while (zn > 0 && zp[zn - 1] == 0)
+                zn--;
+
+            if (zn == 0)
+            {
+                arf_zero(arb_midref(z + i));
+            }
+            else
+            {
+                inexact = _arf_set_round_mpn(arb_midref(z + i), &fix,
+                    zp, zn, negative, prec, ARB_RND);
+                fmpz_set_si(ARF_EXPREF(arb_midref(z + i)),
+                    zn * FLINT_BITS + fix + zexp + scale * i);
+
+                if (inexact)
+                    arf_mag_add_ulp(arb_radref(z + i),
+                        arb_radref(z + i), arb_midref(z + i), prec);
+            }
+        }
+
+        flint_free(acc);
+        flint_free(buf);
+        flint_free(tmp);
+        flint_free(u);
+        flint_free(v);
+        flint_free(xspec);
+        if (!squaring)
+            flint_free(yspec);
+    }
+
+    flint_free(w);
+    flint_free(c);
+    flint_free(xinexact);
+    if (!squaring)
+        flint_free(yinexact);
+
+    return ok;
+}
+
+void
+_arb_poly_mullow_fft(arb_ptr z, arb_srcptr x, slong xlen,
+                                arb_srcptr y, slong ylen, slong n, slong prec)
+{
+    xlen = FLINT_MIN(xlen, n);
+    ylen = FLINT_MIN(ylen, n);
+
+    if (n > xlen + ylen - 1)
+    {
+        _arb_vec_zero(z + xlen + ylen - 1, n - (xlen + ylen - 1));
+        n = xlen + ylen - 1;
+    }
+
+    if (!_arb_poly_mullow_fft_try(z, x, xlen, y, ylen, n, prec))
+        _arb_poly_mullow_block(z, x, xlen, y, ylen, n, prec);
+}
+
+void
+arb_poly_mullow_fft(arb_poly_t res, const arb_poly_t poly1,
+              const arb_poly_t poly2, slong n, slong prec)
+{
+    slong xlen, ylen, zlen;
+
+    xlen = poly1->length;
+    ylen = poly2->length;
+
+    if (xlen == 0 || ylen == 0 || n == 0)
+    {
+        arb_poly_zero(res);
+        return;
+    }
+
+    xlen = FLINT_MIN(xlen, n);
+    ylen = FLINT_MIN(ylen, n);
+    zlen = FLINT_MIN(xlen + ylen - 1, n);
+
+    if (res == poly1 || res == poly2)
+    {
+        arb_poly_t tmp;
+        arb_poly_init2(tmp, zlen);
+        _arb_poly_mullow_fft(tmp->coeffs, poly1->coeffs, xlen,
+            poly2->coeffs, ylen, zlen, prec);
+        arb_poly_swap(res, tmp);
+        arb_poly_clear(tmp);
+    }
+    else
+    {
+        arb_poly_fit_length(res, zlen);
+        _arb_poly_mullow_fft(res->coeffs, poly1->coeffs, xlen,
+            poly2->coeffs, ylen, zlen, prec);
+    }
+
+    _arb_poly_set_length(res, zlen);
+    _arb_poly_normalise(res);
+}
@@ -0,0 +1,92 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_poly.h"
+
+void
+_arb_poly_mulmid(arb_ptr res,
+    arb_srcptr poly1, slong len1,
+    arb_srcptr poly2, slong len2, slong lo, slong hi, slong prec)
+{
+    len1 = FLINT_MIN(len1, hi);
+    len2 = FLINT_MIN(len2, hi);
+
+    if (lo == 0)
+    {
+        if (len1 >= len2)
+            _arb_poly_mullow(res, poly1, len1, poly2, len2, hi, prec);
+        else
+            _arb_poly_mullow(res, poly2, len2, poly1, len1, hi, prec);
+    }
+    else
+    {
+        switch (_arb_poly_mul_algorithm(poly1, len1, poly2, len2, hi - lo, prec))
+        {
+            case ARB_POLY_MUL_CLASSICAL:
+                _arb_poly_mulmid_classical(res, poly1, len1, poly2, len2, lo, hi, prec);
+                break;
+            case ARB_POLY_MUL_FFT:
+            {
+                /* the floating-point FFT has no middle product */
+                arb_ptr t = _arb_vec_init(hi);
+
+                if (len1 >= len2)
+                    _arb_poly_mullow_fft(t, poly1, len1, poly2, len2, hi, prec);
+                else
+                    _arb_poly_mullow_fft(t, poly2, len2, poly1, len1, hi, prec);
+
+                _arb_vec_swap(res, t + lo, hi - lo);
+                _arb_vec_clear(t, hi);
+                break;
+            }
+            default:
+                _arb_poly_mulmid_block(res, poly1, len1, poly2, len2, lo, hi, prec);
+        }
+    }
+}
+
+void
+arb_poly_mulmid(arb_poly_t res, const arb_poly_t poly1,
+    const arb_poly_t poly2, slong lo, slong hi, slong prec)
+{
+    slong len1, len2, len;
+
+    len1 = poly1->length;
+    len2 = poly2->length;
+    hi = FLINT_MIN(hi, len1 + len2 - 1);
+
+    if (len1 == 0 || len2 == 0 || hi <= lo)
+    {
+        arb_poly_zero(res);
+        return;
+    }
+
+    len = hi - lo;
+
+    if (res == poly1 || res == poly2)
+    {
+        arb_poly_t t;
+        arb_poly_init2(t, len);
+        _arb_poly_mulmid(t->coeffs, poly1->coeffs, len1,
+            poly2->coeffs, len2, lo, hi, prec);
+        arb_poly_swap(res, t);
+        arb_poly_clear(t);
+    }
+    else
+    {
+        arb_poly_fit_length(res, len);
+        _arb_poly_mulmid(res->coeffs, poly1->coeffs, len1,
+            poly2->coeffs, len2, lo, hi, prec);
+    }
+
+    _arb_poly_set_length(res, len);
+    _arb_poly_normalise(res);
+}
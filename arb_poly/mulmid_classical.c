@@ -0,0 +1,68 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_poly.h"
+
+void
+_arb_poly_mulmid_classical(arb_ptr res,
+    arb_srcptr poly1, slong len1,
+    arb_srcptr poly2, slong len2, slong lo, slong hi, slong prec)
+{
+    slong k, start, stop;
+
+    for (k = lo; k < hi; k++)
+    {
+        start = FLINT_MAX(0, k - len2 + 1);
+        stop = FLINT_MIN(len1 - 1, k);
+
+        if (start > stop)
+            arb_zero(res + k - lo);
+        else
+            arb_dot(res + k - lo, NULL, 0, poly1 + start, 1,
+                poly2 + k - start, -1, stop - start + 1, prec);
+    }
+}
+
+void
+arb_poly_mulmid_classical(arb_poly_t res, const arb_poly_t poly1,
+    const arb_poly_t poly2, slong lo, slong hi, slong prec)
+{
+    slong len;
+
+    hi = FLINT_MIN(hi, poly1->length + poly2->length - 1);
+
+    if (poly1->length == 0 || poly2->length == 0 || hi <= lo)
+    {
+        arb_poly_zero(res);
+        return;
+    }
+
+    len = hi - lo;
+
+    if (res == poly1 || res == poly2)
+    {
+        arb_poly_t t;
+        arb_poly_init2(t, len);
+        _arb_poly_mulmid_classical(t->coeffs, poly1->coeffs, poly1->length,
+            poly2->coeffs, poly2->length, lo, hi, prec);
+        arb_poly_swap(res, t);
+        arb_poly_clear(t);
+    }
+    else
+    {
+        arb_poly_fit_length(res, len);
+        _arb_poly_mulmid_classical(res->coeffs, poly1->coeffs, poly1->length,
+            poly2->coeffs, poly2->length, lo, hi, prec);
+    }
+
+    _arb_poly_set_length(res, len);
+    _arb_poly_normalise(res);
+}
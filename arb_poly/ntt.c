@@ -0,0 +1,528 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/thread_support.h"
+#include "arb_poly.h"
+
+/* The primes p = c 2^ARB_POLY_NTT_MAX_DEPTH + 1 lie in
+   [2^(FLINT_BITS-3), 2^(FLINT_BITS-2)), so each prime contributes
+   at least NTT_PRIME_BITS bits to the CRT modulus. */
+#define NTT_PRIME_BITS (FLINT_BITS - 3)
+
+/* Number of coefficients per thread in the conversions to and from
+   multimodular representation. */
+#define NTT_CHUNK 256
+
+TLS_PREFIX mp_ptr _arb_poly_ntt_primes = NULL;
+TLS_PREFIX slong _arb_poly_ntt_num_primes = 0;
+
+static void
+_arb_poly_ntt_cleanup(void)
+{
+    flint_free(_arb_poly_ntt_primes);
+    _arb_poly_ntt_primes = NULL;
+    _arb_poly_ntt_num_primes = 0;
+}
+
+/* Returns the first num NTT primes (in decreasing order), or NULL if
+   there are not that many primes of the required form. */
+static mp_srcptr
+_arb_poly_ntt_get_primes(slong num)
+{
+    slong i;
+    mp_limb_t c, cmin;
+
+    if (num > _arb_poly_ntt_num_primes)
+    {
+        i = _arb_poly_ntt_num_primes;
+        cmin = UWORD(1) << (FLINT_BITS - 3 - ARB_POLY_NTT_MAX_DEPTH);
+
+        if (i == 0)
+        {
+            flint_register_cleanup_function(_arb_poly_ntt_cleanup);
+            c = (UWORD(1) << (FLINT_BITS - 2 - ARB_POLY_NTT_MAX_DEPTH)) - 1;
+        }
+        else
+        {
+            c = (_arb_poly_ntt_primes[i - 1] >> ARB_POLY_NTT_MAX_DEPTH) - 1;
+        }
+
+        _arb_poly_ntt_primes = flint_realloc(_arb_poly_ntt_primes,
+            sizeof(mp_limb_t) * num);
+
+        for ( ; i < num && c >= cmin; c--)
+        {
+            mp_limb_t p = (c << ARB_POLY_NTT_MAX_DEPTH) + 1;
+
+            if (n_is_prime(p))
+                _arb_poly_ntt_primes[i++] = p;
+        }
+
+        _arb_poly_ntt_num_primes = i;
+
+        if (i < num)
+            return NULL;
+    }
+
+    return _arb_poly_ntt_primes;
+}
+
+/* Primitive root of unity of order 2^depth modulo p. */
+static mp_limb_t
+_ntt_root(mp_limb_t p, mp_limb_t pinv, slong depth)
+{
+    mp_limb_t a, r, t;
+    slong i;
+
+    for (a = 2; ; a++)
+    {
+        r = n_powmod2_preinv(a, p >> ARB_POLY_NTT_MAX_DEPTH, p, pinv);
+
+        t = r;
+        for (i = 0; i < ARB_POLY_NTT_MAX_DEPTH - 1; i++)
+            t = n_mulmod2_preinv(t, t, p, pinv);
+
+        if (t == p - 1)
+            break;
+    }
+
+    for (i = depth; i < ARB_POLY_NTT_MAX_DEPTH; i++)
+        r = n_mulmod2_preinv(r, r, p, pinv);
+
+    return r;
+}
+
+/* w[k] = root^k for 0 <= k < N/2 */
+static void
+_ntt_twiddles(mp_ptr w, mp_limb_t root, slong N, mp_limb_t p, mp_limb_t pinv)
+{
+    slong k;
+
+    if (N >= 2)
+    {
+        w[0] = 1;
+        for (k = 1; k < N / 2; k++)
+            w[k] = n_mulmod2_preinv(w[k - 1], root, p, pinv);
+    }
+}
+
+/* Decimation in frequency: natural order in, bit-reversed order out. */
+static void
+_ntt_forward(mp_ptr a, mp_srcptr w, slong N, mp_limb_t p, mp_limb_t pinv)
+{
+    slong len, half, step, i, j;
+    mp_limb_t u, v;
+
+    for (len = N, step = 1; len >= 2; len /= 2, step *= 2)
+    {
+        half = len / 2;
+
+        for (i = 0; i < N; i += len)
+        {
+            for (j = 0; j < half; j++)
+            {
+                u = a[i + j];
+                v = a[i + j + half];
+                a[i + j] = n_addmod(u, v, p);
+                a[i + j + half] = n_mulmod2_preinv(n_submod(u, v, p),
+                    w[j * step], p, pinv);
+            }
+        }
+    }
+}
+
+/* Decimation in time with the inverse roots root^(-k) = -w[N/2 - k]:
+   bit-reversed order in, natural order out, not divided by N. */
+static void
+_ntt_inverse(mp_ptr a, mp_srcptr w, slong N, mp_limb_t p, mp_limb_t pinv)
+{
+    slong len, half, step, i, j;
+    mp_limb_t u, v;
+
+    for (len = 2, step = N / 2; len <= N; len *= 2, step /= 2)
+    {
+        half = len / 2;
+
+        for (i = 0; i < N; i += len)
+        {
+            u = a[i];
+            v = a[i + half];
+            a[i] = n_addmod(u, v, p);
+            a[i + half] = n_submod(u, v, p);
+
+            for (j = 1; j < half; j++)
+            {
+                u = a[i + j];
+                v = n_mulmod2_preinv(a[i + j + half],
+                    w[N / 2 - j * step], p, pinv);
+                a[i + j] = n_submod(u, v, p);
+                a[i + j + half] = n_addmod(u, v, p);
+            }
+        }
+    }
+}
+
+/* Residues of {poly, len} modulo all primes, in the layout
+   r[i * num_primes + j]. */
+typedef struct
+{
+    mp_ptr r;
+    const fmpz * poly;
+    slong len;
+    const fmpz_comb_struct * comb;
+    slong num_primes;
+}
+mod_work_t;
+
+static void
+mod_worker(slong i, mod_work_t * work)
+{
+    fmpz_comb_temp_t temp;
+    slong k, start, stop;
+
+    start = i * NTT_CHUNK;
+    stop = FLINT_MIN(start + NTT_CHUNK, work->len);
+
+    fmpz_comb_temp_init(temp, work->comb);
+
+    for (k = start; k < stop; k++)
+        fmpz_multi_mod_ui(work->r + k * work->num_primes,
+            work->poly + k, work->comb, temp);
+
+    fmpz_comb_temp_clear(temp);
+}
+
+static mp_ptr
+_ntt_residues(const fmpz * poly, slong len, const fmpz_comb_t comb,
+    slong num_primes)
+{
+    mod_work_t work;
+    slong i, num;
+
+    work.r = flint_malloc(sizeof(mp_limb_t) * len * num_primes);
+    work.poly = poly;
+    work.len = len;
+    work.comb = comb;
+    work.num_primes = num_primes;
+
+    num = (len + NTT_CHUNK - 1) / NTT_CHUNK;
+
+    if (num > 1 && arb_flint_get_num_available_threads() > 1)
+        flint_parallel_do((do_func_t) mod_worker, &work, num, -1, FLINT_PARALLEL_UNIFORM);
+    else
+        for (i = 0; i < num; i++)
+            mod_worker(i, &work);
+
+    return work.r;
+}
+
+/* Transforms modulo prime j: a = DFT of {r, len} folded modulo x^N - 1,
+   optionally multiplied pointwise by b (if b is not NULL) and
+   transformed back. */
+typedef struct
+{
+    mp_ptr a;
+    mp_srcptr b;
+    mp_srcptr r;
+    slong len;
+    slong N;
+    mp_srcptr primes;
+    mp_srcptr roots;
+    slong num_primes;
+    mp_limb_t scale;  /* multiply by N^(-1) (only when preparing) */
+}
+ntt_work_t;
+
+static void
+ntt_worker(slong j, ntt_work_t * work)
+{
+    mp_ptr a, w;
+    mp_limb_t p, pinv;
+    slong i, N;
+
+    N = work->N;
+    a = work->a + j * N;
+    p = work->primes[j];
+    pinv = n_preinvert_limb(p);
+
+    for (i = 0; i < N; i++)
+        a[i] = 0;
+
+    for (i = 0; i < work->len; i++)
+        a[i & (N - 1)] = n_addmod(a[i & (N - 1)],
+            work->r[i * work->num_primes + j], p);
+
+    w = flint_malloc(sizeof(mp_limb_t) * FLINT_MAX(N / 2, 1));
+    _ntt_twiddles(w, work->roots[j], N, p, pinv);
+
+    _ntt_forward(a, w, N, p, pinv);
+
+    if (work->b == NULL)
+    {
+        if (work->scale)
+        {
+            mp_limb_t Ninv = n_invmod(N % p, p);
+
+            for (i = 0; i < N; i++)
+                a[i] = n_mulmod2_preinv(a[i], Ninv, p, pinv);
+        }
+    }
+    else
+    {
+        mp_srcptr b = work->b + j * N;
+
+        for (i = 0; i < N; i++)
+            a[i] = n_mulmod2_preinv(a[i], b[i], p, pinv);
+
+        _ntt_inverse(a, w, N, p, pinv);
+    }
+
+    flint_free(w);
+}
+
+static void
+_ntt_transforms(mp_ptr a, mp_srcptr b, mp_srcptr r, slong len,
+    const arb_poly_ntt_t T, int scale)
+{
+    ntt_work_t work;
+    slong j;
+
+    work.a = a;
+    work.b = b;
+    work.r = r;
+    work.len = len;
+    work.N = WORD(1) << T->depth;
+    work.primes = T->primes;
+    work.roots = T->roots;
+    work.num_primes = T->num_primes;
+    work.scale = scale;
+
+    if (T->num_primes > 1 && arb_flint_get_num_available_threads() > 1)
+        flint_parallel_do((do_func_t) ntt_worker, &work, T->num_primes, -1, FLINT_PARALLEL_STRIDED);
+    else
+        for (j = 0; j < T->num_primes; j++)
+            ntt_worker(j, &work);
+}
+
+/* Reconstruction of coefficients lo <= k < hi from residues a[j * N + k]. */
+typedef struct
+{
+    fmpz * res;
+    mp_srcptr a;
+    slong lo;
+    slong hi;
+    slong N;
+    const fmpz_comb_struct * comb;
+    slong num_primes;
+}
+crt_work_t;
+
+static void
+crt_worker(slong i, crt_work_t * work)
+{
+    fmpz_comb_temp_t temp;
+    mp_ptr r;
+    slong j, k, start, stop;
+
+    start = work->lo + i * NTT_CHUNK;
+    stop = FLINT_MIN(start + NTT_CHUNK, work->hi);
+
+    fmpz_comb_temp_init(temp, work->comb);
+    r = flint_malloc(sizeof(mp_limb_t) * work->num_primes);
+
+    for (k = start; k < stop; k++)
+    {
+        for (j = 0; j < work->num_primes; j++)
+            r[j] = work->a[j * work->N + k];
+
+        fmpz_multi_CRT_ui(work->res + k - work->lo, r, work->comb, temp, 1);
+    }
+
+    flint_free(r);
+    fmpz_comb_temp_clear(temp);
+}
+
+void
+arb_poly_ntt_init(arb_poly_ntt_t T, const fmpz * poly, slong len,
+    slong bits, slong n)
+{
+    mp_srcptr primes;
+    mp_ptr r;
+    slong abits, depth, num_primes, j;
+
+    abits = FLINT_ABS(_fmpz_vec_max_bits(poly, len));
+    depth = FLINT_CLOG2(FLINT_MAX(n, 1));
+
+    T->len = len;
+    T->bits = bits;
+    T->depth = depth;
+    T->num_primes = 0;
+    T->primes = NULL;
+    T->roots = NULL;
+    T->data = NULL;
+    T->poly = _fmpz_vec_init(len);
+    _fmpz_vec_set(T->poly, poly, len);
+
+    if (len == 0 || depth > ARB_POLY_NTT_MAX_DEPTH)
+        return;
+
+    /* the product coefficients are bounded by len 2^(abits + bits),
+       and the modulus must exceed twice this bound */
+    num_primes = (abits + bits + FLINT_CLOG2(len) + 2 + NTT_PRIME_BITS - 1) / NTT_PRIME_BITS;
+    num_primes = FLINT_MAX(num_primes, 2);
+
+    primes = _arb_poly_ntt_get_primes(num_primes);
+
+    if (primes == NULL)
+        return;
+
+    T->num_primes = num_primes;
+    T->primes = flint_malloc(sizeof(mp_limb_t) * num_primes);
+    T->roots = flint_malloc(sizeof(mp_limb_t) * num_primes);
+
+    for (j = 0; j < num_primes; j++)
+    {
+        T->primes[j] = primes[j];
+        T->roots[j] = _ntt_root(primes[j], n_preinvert_limb(primes[j]), depth);
+    }
+
+    fmpz_comb_init(T->comb, T->primes, num_primes);
+
+    T->data = flint_malloc(sizeof(mp_limb_t) * (num_primes << depth));
+
+    r = _ntt_residues(poly, len, T->comb, num_primes);
+    _ntt_transforms(T->data, NULL, r, len, T, 1);
+    flint_free(r);
+}
+
+void
+arb_poly_ntt_clear(arb_poly_ntt_t T)
+{
+    if (T->num_primes != 0)
+    {
+        fmpz_comb_clear(T->comb);
+        flint_free(T->primes);
+        flint_free(T->roots);
+        flint_free(T->data);
+    }
+
+    _fmpz_vec_clear(T->poly, T->len);
+}
+
+static void
+_arb_poly_ntt_mulmid_fallback(fmpz * res, const fmpz * poly, slong len,
+    slong lo, slong hi, const arb_poly_ntt_t T)
+{
+    slong L, n;
+    fmpz * t;
+
+    L = T->len + len - 1;
+    n = FLINT_MIN(hi, L);
+
+    if (lo < n)
+    {
+        t = _fmpz_vec_init(n);
+
+        if (T->len >= len)
+            _fmpz_poly_mullow(t, T->poly, T->len, poly, len, n);
+        else
+            _fmpz_poly_mullow(t, poly, len, T->poly, T->len, n);
+
+        _fmpz_vec_swap(res, t + lo, n - lo);
+        _fmpz_vec_clear(t, n);
+    }
+
+    _fmpz_vec_zero(res + FLINT_MAX(n - lo, 0), hi - FLINT_MAX(n, lo));
+}
+
+void
+_arb_poly_ntt_mulmid(fmpz * res, const fmpz * poly, slong len,
+    slong lo, slong hi, const arb_poly_ntt_t T)
+{
+    crt_work_t work;
+    mp_ptr r, a;
+    slong i, N, L, num;
+
+    if (hi <= lo)
+        return;
+
+    if (T->len == 0 || len == 0)
+    {
+        _fmpz_vec_zero(res, hi - lo);
+        return;
+    }
+
+    N = WORD(1) << T->depth;
+    L = T->len + len - 1;
+
+    if (T->num_primes == 0 || hi > N || L - lo > N ||
+        FLINT_ABS(_fmpz_vec_max_bits(poly, len)) > T->bits)
+    {
+        _arb_poly_ntt_mulmid_fallback(res, poly, len, lo, hi, T);
+        return;
+    }
+
+    /* coefficients beyond the product are zero */
+    if (hi > L)
+    {
+        _fmpz_vec_zero(res + FLINT_MAX(L - lo, 0), hi - FLINT_MAX(L, lo));
+        hi = L;
+
+        if (hi <= lo)
+            return;
+    }
+
+    a = flint_malloc(sizeof(mp_limb_t) * (T->num_primes << T->depth));
+
+    r = _ntt_residues(poly, len, T->comb, T->num_primes);
+    _ntt_transforms(a, T->data, r, len, T, 0);
+    flint_free(r);
+
+    work.res = res;
+    work.a = a;
+    work.lo = lo;
+    work.hi = hi;
+    work.N = N;
+    work.comb = T->comb;
+    work.num_primes = T->num_primes;
+
+    num = (hi - lo + NTT_CHUNK - 1) / NTT_CHUNK;
+
+    if (num > 1 && arb_flint_get_num_available_threads() > 1)
+        flint_parallel_do((do_func_t) crt_worker, &work, num, -1, FLINT_PARALLEL_UNIFORM);
+    else
+        for (i = 0; i < num; i++)
+            crt_worker(i, &work);
+
+    flint_free(a);
+}
+
+void
+_arb_poly_ntt_mullow(fmpz * res, const fmpz * poly, slong len,
+    slong n, const arb_poly_ntt_t T)
+{
+    _arb_poly_ntt_mulmid(res, poly, len, 0, n, T);
+}
+
+void
+_arb_poly_fmpz_mulmid_ntt(fmpz * res, const fmpz * poly1, slong len1,
+    const fmpz * poly2, slong len2, slong lo, slong hi)
+{
+    arb_poly_ntt_t T;
+    slong bits;
+
+    bits = FLINT_ABS(_fmpz_vec_max_bits(poly2, len2));
+
+    arb_poly_ntt_init(T, poly1, len1, bits,
+        FLINT_MAX(hi, len1 + len2 - 1 - lo));
+    _arb_poly_ntt_mulmid(res, poly2, len2, lo, hi, T);
+    arb_poly_ntt_clear(T);
+}
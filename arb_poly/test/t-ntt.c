@@ -0,0 +1,127 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_poly.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("ntt....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 1000 * arb_test_multiplier(); iter++)
+    {
+        arb_poly_ntt_t T;
+        fmpz_poly_t A, B, C;
+        fmpz * res;
+        slong i, k, lo, hi, bits, n;
+
+        fmpz_poly_init(A);
+        fmpz_poly_init(B);
+        fmpz_poly_init(C);
+
+        flint_set_num_threads(1 + n_randint(state, 3));
+
+        fmpz_poly_randtest(A, state, 1 + n_randint(state, 200), 1 + n_randint(state, 300));
+        bits = 1 + n_randint(state, 300);
+
+        /* transform length for middle products of A with operands of
+           length at most A->length */
+        lo = n_randint(state, A->length + 1);
+        hi = lo + n_randint(state, A->length + 1);
+        n = FLINT_MAX(hi, 2 * A->length - 1 - lo);
+
+        arb_poly_ntt_init(T, A->coeffs, A->length, bits, n);
+
+        /* several products with the same prepared operand */
+        for (k = 0; k < 3; k++)
+        {
+            fmpz_poly_randtest(B, state, 1 + n_randint(state, A->length + 1),
+                1 + n_randint(state, n_randint(state, 4) == 0 ? 400 : bits));
+
+            if (k == 2)
+            {
+                lo = n_randint(state, 50);
+                hi = lo + n_randint(state, 50);
+            }
+
+            fmpz_poly_mul(C, A, B);
+
+            res = _fmpz_vec_init(FLINT_MAX(hi - lo, 0));
+            _arb_poly_ntt_mulmid(res, B->coeffs, B->length, lo, hi, T);
+
+            for (i = lo; i < hi; i++)
+            {
+                fmpz_t c;
+                fmpz_init(c);
+                fmpz_poly_get_coeff_fmpz(c, C, i);
+
+                if (!fmpz_equal(c, res + i - lo))
+                {
+                    flint_printf("FAIL (prepared)\n\n");
+                    flint_printf("lenA = %wd, lenB = %wd, lo = %wd, hi = %wd, i = %wd\n\n",
+                        A->length, B->length, lo, hi, i);
+                    flint_printf("A = "); fmpz_poly_print(A); flint_printf("\n\n");
+                    flint_printf("B = "); fmpz_poly_print(B); flint_printf("\n\n");
+                    flint_abort();
+                }
+
+                fmpz_clear(c);
+            }
+
+            _fmpz_vec_clear(res, FLINT_MAX(hi - lo, 0));
+        }
+
+        arb_poly_ntt_clear(T);
+
+        /* unprepared middle product */
+        fmpz_poly_randtest(B, state, 1 + n_randint(state, 200), 1 + n_randint(state, 300));
+        fmpz_poly_mul(C, A, B);
+
+        lo = n_randint(state, A->length + B->length);
+        hi = lo + n_randint(state, A->length + B->length);
+
+        res = _fmpz_vec_init(hi - lo);
+        _arb_poly_fmpz_mulmid_ntt(res, A->coeffs, A->length, B->coeffs, B->length, lo, hi);
+
+        for (i = lo; i < hi; i++)
+        {
+            fmpz_t c;
+            fmpz_init(c);
+            fmpz_poly_get_coeff_fmpz(c, C, i);
+
+            if (!fmpz_equal(c, res + i - lo))
+            {
+                flint_printf("FAIL (mulmid)\n\n");
+                flint_printf("lenA = %wd, lenB = %wd, lo = %wd, hi = %wd, i = %wd\n\n",
+                    A->length, B->length, lo, hi, i);
+                flint_abort();
+            }
+
+            fmpz_clear(c);
+        }
+
+        _fmpz_vec_clear(res, hi - lo);
+
+        fmpz_poly_clear(A);
+        fmpz_poly_clear(B);
+        fmpz_poly_clear(C);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
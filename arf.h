@@ -829,6 +829,76 @@ void arf_urandom(arf_t x, flint_rand_t state, slong bits, arf_rnd_t rnd);
         r3 += r2 < t1;                                      \
     } while (0)
 
+/* Fixed-size multiplication of operands with at most ARF_MUL_FIXED_LIMBS
+   limbs. Each kernel multiplies an n-limb operand by an m-limb operand
+   (m <= n) by schoolbook with loops of constant length, so that the
+   compiler can unroll them. */
+#define ARF_MUL_FIXED_LIMBS 4
+
+#define ARF_DEF_MPN_MUL_FIXED(n)                                         \
+ARF_INLINE void                                                          \
+_arf_mpn_mul_fixed_ ## n(mp_ptr z, mp_srcptr x, mp_srcptr y, mp_size_t m) \
+{                                                                        \
+    mp_limb_t __hi, __lo, __cy, __c;                                     \
+    mp_size_t __i, __j;                                                  \
+    __cy = 0;                                                            \
+    __c = y[0];                                                          \
+    for (__i = 0; __i < n; __i++)                                        \
+    {                                                                    \
+        umul_ppmm(__hi, __lo, x[__i], __c);                              \
+        add_ssaaaa(__hi, __lo, __hi, __lo, 0, __cy);                     \
+        z[__i] = __lo;                                                   \
+        __cy = __hi;                                                     \
+    }                                                                    \
+    z[n] = __cy;                                                         \
+    for (__j = 1; __j < m; __j++)                                        \
+    {                                                                    \
+        __cy = 0;                                                        \
+        __c = y[__j];                                                    \
+        for (__i = 0; __i < n; __i++)                                    \
+        {                                                                \
+            umul_ppmm(__hi, __lo, x[__i], __c);                          \
+            add_ssaaaa(__hi, __lo, __hi, __lo, 0, __cy);                 \
+            add_ssaaaa(__hi, __lo, __hi, __lo, 0, z[__i + __j]);         \
+            z[__i + __j] = __lo;                                         \
+            __cy = __hi;                                                 \
+        }                                                                \
+        z[n + __j] = __cy;                                               \
+    }                                                                    \
+}
+
+ARF_DEF_MPN_MUL_FIXED(3)
+ARF_DEF_MPN_MUL_FIXED(4)
+
+/* Sets {z, xn + yn} to the product of {x, xn} and {y, yn}, where
+   1 <= xn, yn <= ARF_MUL_FIXED_LIMBS. */
+ARF_INLINE void
+_arf_mpn_mul_fixed(mp_ptr z, mp_srcptr x, mp_size_t xn, mp_srcptr y, mp_size_t yn)
+{
+    if (xn < yn)
+    {
+        mp_srcptr __t; mp_size_t __u;
+        __t = x; x = y; y = __t;
+        __u = xn; xn = yn; yn = __u;
+    }
+
+    if (xn == 1)
+    {
+        umul_ppmm(z[1], z[0], x[0], y[0]);
+    }
+    else if (xn == 2)
+    {
+        if (yn == 1)
+            nn_mul_2x1(z[2], z[1], z[0], x[1], x[0], y[0]);
+        else
+            nn_mul_2x2(z[3], z[2], z[1], z[0], x[1], x[0], y[1], y[0]);
+    }
+    else if (xn == 3)
+        _arf_mpn_mul_fixed_3(z, x, y, yn);
+    else
+        _arf_mpn_mul_fixed_4(z, x, y, yn);
+}
+
 /* todo: use mpn_extras.h when available */
 #define ARF_USE_FFT_MUL(_xn) ((_xn) > 32000)
 
@@ -836,22 +906,13 @@ void arf_urandom(arf_t x, flint_rand_t state, slong bits, arf_rnd_t rnd);
 void flint_mpn_mul_fft_main(mp_ptr r1, mp_srcptr i1, mp_size_t n1, mp_srcptr i2, mp_size_t n2);
 
 #define ARF_MPN_MUL(_z, _x, _xn, _y, _yn) \
-    if ((_xn) == (_yn)) \
+    if ((_xn) <= ARF_MUL_FIXED_LIMBS && (_yn) <= ARF_MUL_FIXED_LIMBS) \
     { \
-        if ((_xn) == 1) \
-        { \
-            umul_ppmm((_z)[1], (_z)[0], (_x)[0], (_y)[0]); \
-        } \
-        else if ((_xn) == 2) \
-        { \
-            mp_limb_t __arb_x1, __arb_x0, __arb_y1, __arb_y0; \
-            __arb_x0 = (_x)[0]; \
-            __arb_x1 = (_x)[1]; \
-            __arb_y0 = (_y)[0]; \
-            __arb_y1 = (_y)[1]; \
-            nn_mul_2x2((_z)[3], (_z)[2], (_z)[1], (_z)[0], __arb_x1, __arb_x0, __arb_y1, __arb_y0); \
-        } \
-        else if (ARF_USE_FFT_MUL(_xn)) \
+        _arf_mpn_mul_fixed((_z), (_x), (_xn), (_y), (_yn)); \
+    } \
+    else if ((_xn) == (_yn)) \
+    { \
+        if (ARF_USE_FFT_MUL(_xn)) \
             flint_mpn_mul_fft_main((_z), (_x), (_xn), (_y), (_yn)); \
         else if ((_x) == (_y)) \
             mpn_sqr((_z), (_x), (_xn)); \
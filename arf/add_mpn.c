@@ -21,6 +21,99 @@ void _arf_add_tmp_cleanup(void)
     __arf_add_alloc = 0;
 }
 
+/* Fixed-size addition for operands of at most n limbs with shift at most
+   n * FLINT_BITS: both operands are placed in a buffer of 2n limbs, where
+   the sum is exact, and the result is then rounded once. */
+#define ARF_ADD_FIXED_LIMBS 4
+
+#define ARF_DEF_ADD_MPN_FIXED(n)                                            \
+static int                                                                  \
+_arf_add_mpn_fixed_ ## n(arf_t z, mp_srcptr xp, mp_size_t xn, int xsgnbit, \
+    const fmpz_t xexp, mp_srcptr yp, mp_size_t yn, int ysgnbit,            \
+    flint_bitcnt_t shift, slong prec, arf_rnd_t rnd)                        \
+{                                                                           \
+    mp_limb_t t[2 * n + 1], xtmp[2 * n], ytmp[2 * n];                      \
+    mp_size_t i, zn, shift_limbs, base;                                     \
+    flint_bitcnt_t shift_bits;                                              \
+    mp_limb_t cy;                                                           \
+    slong fix, fix2;                                                        \
+    int inexact;                                                            \
+                                                                            \
+    for (i = 0; i < 2 * n; i++)                                             \
+    {                                                                       \
+        xtmp[i] = 0;                                                        \
+        ytmp[i] = 0;                                                        \
+    }                                                                       \
+                                                                            \
+    for (i = 0; i < xn; i++)                                                \
+        xtmp[2 * n - xn + i] = xp[i];                                       \
+                                                                            \
+    shift_limbs = shift / FLINT_BITS;                                       \
+    shift_bits = shift % FLINT_BITS;                                        \
+                                                                            \
+    if (shift_bits == 0)                                                    \
+    {                                                                       \
+        base = 2 * n - shift_limbs - yn;                                    \
+        for (i = 0; i < yn; i++)                                            \
+            ytmp[base + i] = yp[i];                                         \
+    }                                                                       \
+    else                                                                    \
+    {                                                                       \
+        base = 2 * n - shift_limbs - yn - 1;                                \
+        ytmp[base] = yp[0] << (FLINT_BITS - shift_bits);                    \
+        for (i = 1; i < yn; i++)                                            \
+            ytmp[base + i] = (yp[i] << (FLINT_BITS - shift_bits))           \
+                           | (yp[i - 1] >> shift_bits);                     \
+        ytmp[base + yn] = yp[yn - 1] >> shift_bits;                         \
+    }                                                                       \
+                                                                            \
+    if (xsgnbit == ysgnbit)                                                 \
+    {                                                                       \
+        t[2 * n] = cy = mpn_add_n(t, xtmp, ytmp, 2 * n);                    \
+        fix2 = cy * FLINT_BITS;                                             \
+        zn = 2 * n + cy;                                                    \
+                                                                            \
+        while (t[zn - 1] == 0)                                              \
+        {                                                                   \
+            zn--;                                                           \
+            fix2 -= FLINT_BITS;                                             \
+        }                                                                   \
+    }                                                                       \
+    else                                                                    \
+    {                                                                       \
+        cy = mpn_sub_n(t, xtmp, ytmp, 2 * n);                               \
+                                                                            \
+        if (cy)                                                             \
+        {                                                                   \
+            mpn_neg_n(t, t, 2 * n);                                         \
+            xsgnbit = ysgnbit;                                              \
+        }                                                                   \
+                                                                            \
+        zn = 2 * n;                                                         \
+        fix2 = 0;                                                           \
+                                                                            \
+        while (t[zn - 1] == 0)                                              \
+        {                                                                   \
+            zn--;                                                           \
+            fix2 -= FLINT_BITS;                                             \
+                                                                            \
+            if (zn == 0)                                                    \
+            {                                                               \
+                arf_zero(z);                                                \
+                return 0;                                                   \
+            }                                                               \
+        }                                                                   \
+    }                                                                       \
+                                                                            \
+    inexact = _arf_set_round_mpn(z, &fix, t, zn, xsgnbit, prec, rnd);       \
+    _fmpz_add_fast(ARF_EXPREF(z), xexp, fix + fix2);                        \
+    return inexact;                                                         \
+}
+
+ARF_DEF_ADD_MPN_FIXED(2)
+ARF_DEF_ADD_MPN_FIXED(3)
+ARF_DEF_ADD_MPN_FIXED(4)
+
 /* Assumptions: top limbs of x and y nonzero. */
 int
 _arf_add_mpn(arf_t z, mp_srcptr xp, mp_size_t xn, int xsgnbit, const fmpz_t xexp,
@@ -89,129 +182,25 @@ _arf_add_mpn(arf_t z, mp_srcptr xp, mp_size_t xn, int xsgnbit, const fmpz_t xexp
         return inexact;
     }
 
-    /* somewhat fast case */
-    if (xn <= 2 && yn <= 2 && shift <= 2 * FLINT_BITS)
+    /* fixed-size cases */
+    if (xn <= ARF_ADD_FIXED_LIMBS && yn <= ARF_ADD_FIXED_LIMBS)
     {
-        mp_limb_t t[5], xtmp[4], ytmp[4], yhi, ylo;
-        slong fix2;
-
-        xtmp[0] = 0;
-        xtmp[1] = 0;
-
-        if (xn == 1)
-        {
-            xtmp[2] = 0;
-            xtmp[3] = xp[0];
-        }
-        else
-        {
-            xtmp[2] = xp[0];
-            xtmp[3] = xp[1];
-        }
+        mp_size_t n = FLINT_MAX(xn, yn);
 
-        ytmp[0] = 0;
-        ytmp[1] = 0;
-        ytmp[2] = 0;
-        ytmp[3] = 0;
-
-        if (yn == 1)
-        {
-            yhi = yp[0];
-            ylo = 0;
-        }
-        else
-        {
-            yhi = yp[1];
-            ylo = yp[0];
-        }
+        n = FLINT_MAX(n, 2);
 
-        shift_limbs = shift / FLINT_BITS;
-        shift_bits = shift % FLINT_BITS;
-
-        if (shift_bits == 0)
-        {
-            ytmp[3 - shift_limbs] = yhi;
-            ytmp[2 - shift_limbs] = ylo;
-        }
-        else
-        {
-            ytmp[3 - shift_limbs] = yhi >> shift_bits;
-            ytmp[2 - shift_limbs] = (yhi << (FLINT_BITS - shift_bits)) | (ylo >> (shift_bits));
-            ytmp[1 - shift_limbs] = ylo << (FLINT_BITS - shift_bits);
-        }
-
-        if (xsgnbit == ysgnbit)
-        {
-            t[4] = cy = mpn_add_n(t, xtmp, ytmp, 4);
-            fix2 = cy * FLINT_BITS;
-            zn = 4 + cy;
-
-            while (t[zn - 1] == 0)
-            {
-                zn--;
-                fix2 -= FLINT_BITS;
-            }
-        }
-        else
+        if (shift <= n * FLINT_BITS)
         {
-#if 1
-            cy = mpn_sub_n(t, xtmp, ytmp, 4);
-
-            if (cy)
-            {
-                mpn_neg_n(t, t, 4);
-                xsgnbit = ysgnbit;
-            }
-
-            zn = 4;
-            fix2 = 0;
-
-            while (t[zn - 1] == 0)
-            {
-                zn--;
-                fix2 -= FLINT_BITS;
-
-                if (zn == 0)
-                {
-                    arf_zero(z);
-                    return 0;
-                }
-            }
-
-#else
-            int cmp;
-
-            cmp = mpn_cmp(xtmp, ytmp, 4);
-
-            if (cmp > 0)
-            {
-                mpn_sub_n(t, xtmp, ytmp, 4);
-            }
-            else if (cmp < 0)
-            {
-                mpn_sub_n(t, ytmp, xtmp, 4);
-                xsgnbit = ysgnbit;
-            }
+            if (n == 2)
+                return _arf_add_mpn_fixed_2(z, xp, xn, xsgnbit, xexp,
+                    yp, yn, ysgnbit, shift, prec, rnd);
+            else if (n == 3)
+                return _arf_add_mpn_fixed_3(z, xp, xn, xsgnbit, xexp,
+                    yp, yn, ysgnbit, shift, prec, rnd);
             else
-            {
-                arf_zero(z);
-                return 0;
-            }
-
-            fix2 = 0;
-            zn = 4;
-
-            while (t[zn - 1] == 0)
-            {
-                zn--;
-                fix2 -= FLINT_BITS;
-            }
-#endif
+                return _arf_add_mpn_fixed_4(z, xp, xn, xsgnbit, xexp,
+                    yp, yn, ysgnbit, shift, prec, rnd);
         }
-
-        inexact = _arf_set_round_mpn(z, &fix, t, zn, xsgnbit, prec, rnd);
-        _fmpz_add_fast(ARF_EXPREF(z), xexp, fix + fix2);
-        return inexact;
     }
 
     /* x +/- eps */
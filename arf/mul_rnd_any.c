@@ -38,6 +38,21 @@ arf_mul_rnd_any(arf_ptr z, arf_srcptr x, arf_srcptr y,
         arf_mul_special(z, x, y);
         return 0;
     }
+    else if (xn <= ARF_MUL_FIXED_LIMBS)
+    {
+        mp_limb_t zz[2 * ARF_MUL_FIXED_LIMBS];
+        mp_srcptr xptr, yptr;
+
+        ARF_GET_MPN_READONLY(xptr, xn, x);
+        ARF_GET_MPN_READONLY(yptr, yn, y);
+
+        _arf_mpn_mul_fixed(zz, xptr, xn, yptr, yn);
+
+        inexact = _arf_set_round_mpn(z, &fix, zz, xn + yn, sgnbit, prec, rnd);
+        _fmpz_add2_fast(ARF_EXPREF(z), ARF_EXPREF(x), ARF_EXPREF(y), fix);
+
+        return inexact;
+    }
     else
     {
         mp_size_t zn, alloc;
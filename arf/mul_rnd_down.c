@@ -175,6 +175,21 @@ arf_mul_rnd_down(arf_ptr z, arf_srcptr x, arf_srcptr y, slong prec)
         _fmpz_add2_fast(ARF_EXPREF(z), ARF_EXPREF(x), ARF_EXPREF(y), expfix);
         return ret;
     }
+    else if (xn <= ARF_MUL_FIXED_LIMBS)
+    {
+        mp_limb_t zz[2 * ARF_MUL_FIXED_LIMBS];
+        mp_srcptr xptr, yptr;
+
+        ARF_GET_MPN_READONLY(xptr, xn, x);
+        ARF_GET_MPN_READONLY(yptr, yn, y);
+
+        _arf_mpn_mul_fixed(zz, xptr, xn, yptr, yn);
+
+        zn = xn + yn;
+        ret = _arf_set_round_mpn(z, &expfix, zz, zn, sgnbit, prec, ARF_RND_DOWN);
+        _fmpz_add2_fast(ARF_EXPREF(z), ARF_EXPREF(x), ARF_EXPREF(y), expfix);
+        return ret;
+    }
     else if (yn > MUL_MPFR_MIN_LIMBS && prec != ARF_PREC_EXACT
                 && xn + yn > 1.25 * prec / FLINT_BITS
                 && xn < MUL_MPFR_MAX_LIMBS)  /* FIXME: proper cutoffs */
@@ -0,0 +1,142 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arf.h"
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("mpn_mul_fixed....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* compare the kernels with mpn_mul */
+    for (iter = 0; iter < 100000 * arb_test_multiplier(); iter++)
+    {
+        mp_limb_t x[ARF_MUL_FIXED_LIMBS], y[ARF_MUL_FIXED_LIMBS];
+        mp_limb_t z[2 * ARF_MUL_FIXED_LIMBS], w[2 * ARF_MUL_FIXED_LIMBS];
+        mp_size_t i, xn, yn;
+
+        xn = 1 + n_randint(state, ARF_MUL_FIXED_LIMBS);
+        yn = 1 + n_randint(state, ARF_MUL_FIXED_LIMBS);
+
+        for (i = 0; i < ARF_MUL_FIXED_LIMBS; i++)
+        {
+            x[i] = n_randtest(state);
+            y[i] = n_randtest(state);
+        }
+
+        _arf_mpn_mul_fixed(z, x, xn, y, yn);
+
+        if (xn >= yn)
+            mpn_mul(w, x, xn, y, yn);
+        else
+            mpn_mul(w, y, yn, x, xn);
+
+        if (mpn_cmp(z, w, xn + yn) != 0)
+        {
+            flint_printf("FAIL (mpn_mul)\n");
+            flint_printf("xn = %wd, yn = %wd\n", xn, yn);
+            flint_abort();
+        }
+    }
+
+    /* small operands in arf arithmetic, compared with fmpr */
+    for (iter = 0; iter < 100000 * arb_test_multiplier(); iter++)
+    {
+        arf_t x, y, z, v;
+        fmpr_t a, b, c;
+        slong prec, r1, r2;
+        arf_rnd_t rnd;
+        int op;
+
+        arf_init(x);
+        arf_init(y);
+        arf_init(z);
+        arf_init(v);
+        fmpr_init(a);
+        fmpr_init(b);
+        fmpr_init(c);
+
+        arf_randtest(x, state, 1 + n_randint(state, ARF_MUL_FIXED_LIMBS * FLINT_BITS), 1 + n_randint(state, 10));
+        arf_randtest(y, state, 1 + n_randint(state, ARF_MUL_FIXED_LIMBS * FLINT_BITS), 1 + n_randint(state, 10));
+        arf_randtest(z, state, 1 + n_randint(state, ARF_MUL_FIXED_LIMBS * FLINT_BITS), 1 + n_randint(state, 10));
+        prec = 2 + n_randint(state, 2 * ARF_MUL_FIXED_LIMBS * FLINT_BITS);
+
+        switch (n_randint(state, 4))
+        {
+            case 0:  rnd = ARF_RND_DOWN; break;
+            case 1:  rnd = ARF_RND_UP; break;
+            case 2:  rnd = ARF_RND_FLOOR; break;
+            default: rnd = ARF_RND_CEIL; break;
+        }
+
+        arf_get_fmpr(a, x);
+        arf_get_fmpr(b, y);
+        arf_get_fmpr(c, z);
+
+        op = n_randint(state, 4);
+
+        if (op == 0)
+        {
+            r1 = arf_add(v, x, y, prec, rnd);
+            r2 = fmpr_add(a, a, b, prec, rnd);
+        }
+        else if (op == 1)
+        {
+            r1 = arf_sub(v, x, y, prec, rnd);
+            r2 = fmpr_sub(a, a, b, prec, rnd);
+        }
+        else if (op == 2)
+        {
+            r1 = arf_mul(v, x, y, prec, rnd);
+            r2 = fmpr_mul(a, a, b, prec, rnd);
+        }
+        else
+        {
+            arf_set(v, z);
+            r1 = arf_addmul(v, x, y, prec, rnd);
+            fmpr_mul(a, a, b, FMPR_PREC_EXACT, FMPR_RND_DOWN);
+            r2 = fmpr_add(a, c, a, prec, rnd);
+        }
+
+        r2 = (r2 != FMPR_RESULT_EXACT);
+        arf_set_fmpr(z, a);
+
+        if (!arf_equal(v, z) || r1 != r2)
+        {
+            flint_printf("FAIL (op = %d)\n", op);
+            flint_printf("prec = %wd, rnd = %d\n\n", prec, rnd);
+            flint_printf("x = "); arf_print(x); flint_printf("\n\n");
+            flint_printf("y = "); arf_print(y); flint_printf("\n\n");
+            flint_printf("v = "); arf_print(v); flint_printf("\n\n");
+            flint_printf("z = "); arf_print(z); flint_printf("\n\n");
+            flint_printf("r1 = %wd, r2 = %wd\n", r1, r2);
+            flint_abort();
+        }
+
+        arf_clear(x);
+        arf_clear(y);
+        arf_clear(z);
+        arf_clear(v);
+        fmpr_clear(a);
+        fmpr_clear(b);
+        fmpr_clear(c);
+    }
+
+    flint_randclear(state);
+    flint_cleanup();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
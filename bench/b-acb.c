@@ -0,0 +1,75 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb.h"
+#include "bench.h"
+
+typedef struct
+{
+    acb_t z;
+    acb_t w;
+}
+acb_bench_t;
+
+/* z = (sqrt(2) - 1) + (sqrt(3) - 1) i */
+static void *
+acb_init_z(slong prec, slong size)
+{
+    acb_bench_t * s = flint_malloc(sizeof(acb_bench_t));
+
+    acb_init(s->z);
+    acb_init(s->w);
+
+    arb_sqrt_ui(acb_realref(s->z), 2, prec);
+    arb_sub_ui(acb_realref(s->z), acb_realref(s->z), 1, prec);
+    arb_sqrt_ui(acb_imagref(s->z), 3, prec);
+    arb_sub_ui(acb_imagref(s->z), acb_imagref(s->z), 1, prec);
+
+    return s;
+}
+
+static void
+acb_clear_z(void * state, slong size)
+{
+    acb_bench_t * s = state;
+
+    acb_clear(s->z);
+    acb_clear(s->w);
+    flint_free(s);
+}
+
+static void
+run_exp(void * state, slong prec, slong size)
+{
+    acb_bench_t * s = state;
+    acb_exp(s->w, s->z, prec);
+}
+
+static void
+run_log(void * state, slong prec, slong size)
+{
+    acb_bench_t * s = state;
+    acb_log(s->w, s->z, prec);
+}
+
+static void
+run_gamma(void * state, slong prec, slong size)
+{
+    acb_bench_t * s = state;
+    acb_gamma(s->w, s->z, prec);
+}
+
+const bench_case_struct bench_cases_acb[] = {
+    { "exp", "exp(z)", 0, WORD_MAX, 0, acb_init_z, run_exp, acb_clear_z },
+    { "log", "log(z)", 0, WORD_MAX, 0, acb_init_z, run_log, acb_clear_z },
+    { "gamma", "gamma(z)", 0, 1000000, 0, acb_init_z, run_gamma, acb_clear_z },
+    BENCH_CASES_END
+};
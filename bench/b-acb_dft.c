@@ -0,0 +1,63 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dft.h"
+#include "bench.h"
+
+typedef struct
+{
+    acb_ptr v;
+    acb_ptr w;
+}
+acb_dft_bench_t;
+
+/* v_k = 1/(k+1) + i/(k+2) */
+static void *
+acb_dft_init_v(slong prec, slong size)
+{
+    acb_dft_bench_t * s = flint_malloc(sizeof(acb_dft_bench_t));
+    slong k;
+
+    s->v = _acb_vec_init(size);
+    s->w = _acb_vec_init(size);
+
+    for (k = 0; k < size; k++)
+    {
+        arb_set_ui(acb_realref(s->v + k), k + 1);
+        arb_inv(acb_realref(s->v + k), acb_realref(s->v + k), prec);
+        arb_set_ui(acb_imagref(s->v + k), k + 2);
+        arb_inv(acb_imagref(s->v + k), acb_imagref(s->v + k), prec);
+    }
+
+    return s;
+}
+
+static void
+acb_dft_clear_v(void * state, slong size)
+{
+    acb_dft_bench_t * s = state;
+
+    _acb_vec_clear(s->v, size);
+    _acb_vec_clear(s->w, size);
+    flint_free(s);
+}
+
+static void
+run_dft(void * state, slong prec, slong size)
+{
+    acb_dft_bench_t * s = state;
+    acb_dft(s->w, s->v, size, prec);
+}
+
+const bench_case_struct bench_cases_acb_dft[] = {
+    { "dft", "DFT of length size", BENCH_SIZE, WORD_MAX, WORD_MAX, acb_dft_init_v, run_dft, acb_dft_clear_v },
+    BENCH_CASES_END
+};
@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_dirichlet.h"
+#include "bench.h"
+
+typedef struct
+{
+    acb_t s;
+    acb_t a;
+    acb_t w;
+    acb_ptr ws;
+    fmpz_t n;
+}
+acb_dirichlet_bench_t;
+
+/* s = 1/2 + 1000 i, a = sqrt(2) - 1 */
+static void *
+acb_dirichlet_init_s(slong prec, slong size)
+{
+    acb_dirichlet_bench_t * s = flint_malloc(sizeof(acb_dirichlet_bench_t));
+
+    acb_init(s->s);
+    acb_init(s->a);
+    acb_init(s->w);
+    s->ws = _acb_vec_init(size);
+    fmpz_init(s->n);
+
+    arb_set_d(acb_realref(s->s), 0.5);
+    arb_set_ui(acb_imagref(s->s), 1000);
+    arb_sqrt_ui(acb_realref(s->a), 2, prec);
+    arb_sub_ui(acb_realref(s->a), acb_realref(s->a), 1, prec);
+    fmpz_set_ui(s->n, 1000);
+
+    return s;
+}
+
+static void
+acb_dirichlet_clear_s(void * state, slong size)
+{
+    acb_dirichlet_bench_t * s = state;
+
+    acb_clear(s->s);
+    acb_clear(s->a);
+    acb_clear(s->w);
+    _acb_vec_clear(s->ws, size);
+    fmpz_clear(s->n);
+    flint_free(s);
+}
+
+static void
+run_zeta(void * state, slong prec, slong size)
+{
+    acb_dirichlet_bench_t * s = state;
+    acb_dirichlet_zeta(s->w, s->s, prec);
+}
+
+static void
+run_hurwitz(void * state, slong prec, slong size)
+{
+    acb_dirichlet_bench_t * s = state;
+    acb_dirichlet_hurwitz(s->w, s->s, s->a, prec);
+}
+
+static void
+run_stieltjes(void * state, slong prec, slong size)
+{
+    acb_dirichlet_bench_t * s = state;
+    acb_dirichlet_stieltjes(s->w, s->n, s->a, prec);
+}
+
+static void
+run_stieltjes_vec(void * state, slong prec, slong size)
+{
+    acb_dirichlet_bench_t * s = state;
+    acb_dirichlet_stieltjes_vec(s->ws, s->n, s->a, size, prec);
+}
+
+const bench_case_struct bench_cases_acb_dirichlet[] = {
+    { "zeta", "zeta(1/2 + 1000i)", 0, 100000, 0, acb_dirichlet_init_s, run_zeta, acb_dirichlet_clear_s },
+    { "hurwitz", "zeta(1/2 + 1000i, a)", 0, 100000, 0, acb_dirichlet_init_s, run_hurwitz, acb_dirichlet_clear_s },
+    { "stieltjes", "gamma_1000(a)", 0, 10000, 0, acb_dirichlet_init_s, run_stieltjes, acb_dirichlet_clear_s },
+    { "stieltjes_vec", "gamma_1000(a), ..., gamma_{999+size}(a)", BENCH_SIZE, 10000, 1000, acb_dirichlet_init_s, run_stieltjes_vec, acb_dirichlet_clear_s },
+    BENCH_CASES_END
+};
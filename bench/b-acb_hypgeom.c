@@ -0,0 +1,130 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "acb_hypgeom.h"
+#include "bench.h"
+
+typedef struct
+{
+    acb_t a;
+    acb_t b;
+    acb_t c;
+    acb_t z;
+    acb_t w;
+    acb_t w2;
+    acb_ptr zs;
+    acb_ptr ws;
+    acb_ptr ws2;
+    acb_hypgeom_2f1_precomp_t pre;
+}
+acb_hypgeom_bench_t;
+
+/* a = 1/3, b = 1/2, c = 3/2, z = (sqrt(2) - 1) + (sqrt(3) - 1) i / 2,
+   and size points z_k = z (k + 1) / (size + 1) */
+static void *
+acb_hypgeom_init_z(slong prec, slong size)
+{
+    acb_hypgeom_bench_t * s = flint_malloc(sizeof(acb_hypgeom_bench_t));
+    slong k;
+
+    acb_init(s->a);
+    acb_init(s->b);
+    acb_init(s->c);
+    acb_init(s->z);
+    acb_init(s->w);
+    acb_init(s->w2);
+    s->zs = _acb_vec_init(size);
+    s->ws = _acb_vec_init(size);
+    s->ws2 = _acb_vec_init(size);
+
+    acb_set_ui(s->a, 3);
+    acb_inv(s->a, s->a, prec);
+    acb_set_d(s->b, 0.5);
+    acb_set_d(s->c, 1.5);
+
+    arb_sqrt_ui(acb_realref(s->z), 2, prec);
+    arb_sub_ui(acb_realref(s->z), acb_realref(s->z), 1, prec);
+    arb_sqrt_ui(acb_imagref(s->z), 3, prec);
+    arb_sub_ui(acb_imagref(s->z), acb_imagref(s->z), 1, prec);
+    arb_mul_2exp_si(acb_imagref(s->z), acb_imagref(s->z), -1);
+
+    for (k = 0; k < size; k++)
+    {
+        acb_mul_ui(s->zs + k, s->z, k + 1, prec);
+        acb_div_ui(s->zs + k, s->zs + k, size + 1, prec);
+    }
+
+    acb_hypgeom_2f1_precomp_init(s->pre, s->a, s->b, s->c, 0, prec);
+
+    return s;
+}
+
+static void
+acb_hypgeom_clear_z(void * state, slong size)
+{
+    acb_hypgeom_bench_t * s = state;
+
+    acb_clear(s->a);
+    acb_clear(s->b);
+    acb_clear(s->c);
+    acb_clear(s->z);
+    acb_clear(s->w);
+    acb_clear(s->w2);
+    _acb_vec_clear(s->zs, size);
+    _acb_vec_clear(s->ws, size);
+    _acb_vec_clear(s->ws2, size);
+    acb_hypgeom_2f1_precomp_clear(s->pre);
+    flint_free(s);
+}
+
+static void
+run_2f1(void * state, slong prec, slong size)
+{
+    acb_hypgeom_bench_t * s = state;
+    acb_hypgeom_2f1(s->w, s->a, s->b, s->c, s->z, 0, prec);
+}
+
+static void
+run_2f1_precomp_vec(void * state, slong prec, slong size)
+{
+    acb_hypgeom_bench_t * s = state;
+    acb_hypgeom_2f1_precomp_eval_vec(s->ws, s->pre, s->zs, size, prec);
+}
+
+static void
+run_bessel_j(void * state, slong prec, slong size)
+{
+    acb_hypgeom_bench_t * s = state;
+    acb_hypgeom_bessel_j(s->w, s->a, s->z, prec);
+}
+
+static void
+run_airy(void * state, slong prec, slong size)
+{
+    acb_hypgeom_bench_t * s = state;
+    acb_hypgeom_airy(s->w, NULL, s->w2, NULL, s->z, prec);
+}
+
+static void
+run_airy_vec(void * state, slong prec, slong size)
+{
+    acb_hypgeom_bench_t * s = state;
+    acb_hypgeom_airy_vec(s->ws, NULL, s->ws2, NULL, s->zs, size, prec);
+}
+
+const bench_case_struct bench_cases_acb_hypgeom[] = {
+    { "2f1", "2F1(1/3, 1/2, 3/2, z)", 0, 100000, 0, acb_hypgeom_init_z, run_2f1, acb_hypgeom_clear_z },
+    { "2f1_precomp_vec", "2F1(1/3, 1/2, 3/2, z) at size points", BENCH_SIZE, 100000, 100000, acb_hypgeom_init_z, run_2f1_precomp_vec, acb_hypgeom_clear_z },
+    { "bessel_j", "J_{1/3}(z)", 0, 100000, 0, acb_hypgeom_init_z, run_bessel_j, acb_hypgeom_clear_z },
+    { "airy", "Ai(z), Bi(z)", 0, 100000, 0, acb_hypgeom_init_z, run_airy, acb_hypgeom_clear_z },
+    { "airy_vec", "Ai(z), Bi(z) at size points", BENCH_SIZE, 100000, 100000, acb_hypgeom_init_z, run_airy_vec, acb_hypgeom_clear_z },
+    BENCH_CASES_END
+};
@@ -0,0 +1,110 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb.h"
+#include "bench.h"
+
+typedef struct
+{
+    arb_t x;
+    arb_t y;
+    arb_t z;
+    arb_ptr v;
+}
+arb_bench_t;
+
+/* x = sqrt(2) - 1 as in examples/functions_benchmark.c */
+static void *
+arb_init_x(slong prec, slong size)
+{
+    arb_bench_t * s = flint_malloc(sizeof(arb_bench_t));
+
+    arb_init(s->x);
+    arb_init(s->y);
+    arb_init(s->z);
+    s->v = _arb_vec_init(size);
+
+    arb_sqrt_ui(s->x, 2, prec);
+    arb_sub_ui(s->x, s->x, 1, prec);
+
+    return s;
+}
+
+static void
+arb_clear_x(void * state, slong size)
+{
+    arb_bench_t * s = state;
+
+    arb_clear(s->x);
+    arb_clear(s->y);
+    arb_clear(s->z);
+    _arb_vec_clear(s->v, size);
+    flint_free(s);
+}
+
+static void
+run_const_pi(void * state, slong prec, slong size)
+{
+    arb_const_pi(((arb_bench_t *) state)->y, prec);
+}
+
+static void
+run_exp(void * state, slong prec, slong size)
+{
+    arb_bench_t * s = state;
+    arb_exp(s->y, s->x, prec);
+}
+
+static void
+run_log(void * state, slong prec, slong size)
+{
+    arb_bench_t * s = state;
+    arb_log(s->y, s->x, prec);
+}
+
+static void
+run_sin_cos(void * state, slong prec, slong size)
+{
+    arb_bench_t * s = state;
+    arb_sin_cos(s->y, s->z, s->x, prec);
+}
+
+static void
+run_atan(void * state, slong prec, slong size)
+{
+    arb_bench_t * s = state;
+    arb_atan(s->y, s->x, prec);
+}
+
+static void
+run_gamma(void * state, slong prec, slong size)
+{
+    arb_bench_t * s = state;
+    arb_gamma(s->y, s->x, prec);
+}
+
+static void
+run_zeta_ui_vec(void * state, slong prec, slong size)
+{
+    arb_bench_t * s = state;
+    arb_zeta_ui_vec(s->v, 2, size, prec);
+}
+
+const bench_case_struct bench_cases_arb[] = {
+    { "const_pi", "pi", 0, WORD_MAX, 0, arb_init_x, run_const_pi, arb_clear_x },
+    { "exp", "exp(x)", 0, WORD_MAX, 0, arb_init_x, run_exp, arb_clear_x },
+    { "log", "log(x)", 0, WORD_MAX, 0, arb_init_x, run_log, arb_clear_x },
+    { "sin_cos", "sin(x), cos(x)", 0, WORD_MAX, 0, arb_init_x, run_sin_cos, arb_clear_x },
+    { "atan", "atan(x)", 0, WORD_MAX, 0, arb_init_x, run_atan, arb_clear_x },
+    { "gamma", "gamma(x)", 0, 1000000, 0, arb_init_x, run_gamma, arb_clear_x },
+    { "zeta_ui_vec", "zeta(2), ..., zeta(size + 1)", BENCH_SIZE, 100000, 10000, arb_init_x, run_zeta_ui_vec, arb_clear_x },
+    BENCH_CASES_END
+};
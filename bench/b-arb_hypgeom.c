@@ -0,0 +1,78 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_hypgeom.h"
+#include "bench.h"
+
+typedef struct
+{
+    arb_t x;
+    arb_t nu;
+    arb_t y;
+}
+arb_hypgeom_bench_t;
+
+/* x = sqrt(2) - 1, nu = 1/3 */
+static void *
+arb_hypgeom_init_x(slong prec, slong size)
+{
+    arb_hypgeom_bench_t * s = flint_malloc(sizeof(arb_hypgeom_bench_t));
+
+    arb_init(s->x);
+    arb_init(s->nu);
+    arb_init(s->y);
+
+    arb_sqrt_ui(s->x, 2, prec);
+    arb_sub_ui(s->x, s->x, 1, prec);
+    arb_set_ui(s->nu, 3);
+    arb_inv(s->nu, s->nu, prec);
+
+    return s;
+}
+
+static void
+arb_hypgeom_clear_x(void * state, slong size)
+{
+    arb_hypgeom_bench_t * s = state;
+
+    arb_clear(s->x);
+    arb_clear(s->nu);
+    arb_clear(s->y);
+    flint_free(s);
+}
+
+static void
+run_erf(void * state, slong prec, slong size)
+{
+    arb_hypgeom_bench_t * s = state;
+    arb_hypgeom_erf(s->y, s->x, prec);
+}
+
+static void
+run_gamma(void * state, slong prec, slong size)
+{
+    arb_hypgeom_bench_t * s = state;
+    arb_hypgeom_gamma(s->y, s->x, prec);
+}
+
+static void
+run_bessel_j(void * state, slong prec, slong size)
+{
+    arb_hypgeom_bench_t * s = state;
+    arb_hypgeom_bessel_j(s->y, s->nu, s->x, prec);
+}
+
+const bench_case_struct bench_cases_arb_hypgeom[] = {
+    { "erf", "erf(x)", 0, WORD_MAX, 0, arb_hypgeom_init_x, run_erf, arb_hypgeom_clear_x },
+    { "gamma", "gamma(x)", 0, 1000000, 0, arb_hypgeom_init_x, run_gamma, arb_hypgeom_clear_x },
+    { "bessel_j", "J_{1/3}(x)", 0, 1000000, 0, arb_hypgeom_init_x, run_bessel_j, arb_hypgeom_clear_x },
+    BENCH_CASES_END
+};
@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_mat.h"
+#include "bench.h"
+
+typedef struct
+{
+    arb_mat_t A;
+    arb_mat_t B;
+    arb_mat_t C;
+    arb_t d;
+}
+arb_mat_bench_t;
+
+/* A = Hilbert-like matrix 1/(i+j+1) + [i = j], B = 1/(i+j+2) */
+static void *
+arb_mat_init_ab(slong prec, slong size)
+{
+    arb_mat_bench_t * s = flint_malloc(sizeof(arb_mat_bench_t));
+    slong i, j;
+
+    arb_mat_init(s->A, size, size);
+    arb_mat_init(s->B, size, size);
+    arb_mat_init(s->C, size, size);
+    arb_init(s->d);
+
+    for (i = 0; i < size; i++)
+    {
+        for (j = 0; j < size; j++)
+        {
+            arb_set_ui(arb_mat_entry(s->A, i, j), i + j + 1);
+            arb_inv(arb_mat_entry(s->A, i, j), arb_mat_entry(s->A, i, j), prec);
+            if (i == j)
+                arb_add_ui(arb_mat_entry(s->A, i, j), arb_mat_entry(s->A, i, j), 1, prec);
+            arb_set_ui(arb_mat_entry(s->B, i, j), i + j + 2);
+            arb_inv(arb_mat_entry(s->B, i, j), arb_mat_entry(s->B, i, j), prec);
+        }
+    }
+
+    return s;
+}
+
+static void
+arb_mat_clear_ab(void * state, slong size)
+{
+    arb_mat_bench_t * s = state;
+
+    arb_mat_clear(s->A);
+    arb_mat_clear(s->B);
+    arb_mat_clear(s->C);
+    arb_clear(s->d);
+    flint_free(s);
+}
+
+static void
+run_mul(void * state, slong prec, slong size)
+{
+    arb_mat_bench_t * s = state;
+    arb_mat_mul(s->C, s->A, s->B, prec);
+}
+
+static void
+run_solve(void * state, slong prec, slong size)
+{
+    arb_mat_bench_t * s = state;
+    arb_mat_solve(s->C, s->A, s->B, prec);
+}
+
+static void
+run_det(void * state, slong prec, slong size)
+{
+    arb_mat_bench_t * s = state;
+    arb_mat_det(s->d, s->A, prec);
+}
+
+const bench_case_struct bench_cases_arb_mat[] = {
+    { "mul", "product of size x size matrices", BENCH_SIZE, WORD_MAX, 1000, arb_mat_init_ab, run_mul, arb_mat_clear_ab },
+    { "solve", "size x size linear system", BENCH_SIZE, WORD_MAX, 1000, arb_mat_init_ab, run_solve, arb_mat_clear_ab },
+    { "det", "size x size determinant", BENCH_SIZE, WORD_MAX, 1000, arb_mat_init_ab, run_det, arb_mat_clear_ab },
+    BENCH_CASES_END
+};
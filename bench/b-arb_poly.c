@@ -0,0 +1,98 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "arb_poly.h"
+#include "bench.h"
+
+typedef struct
+{
+    arb_poly_t a;
+    arb_poly_t b;
+    arb_poly_t c;
+    arb_ptr xs;
+    arb_ptr ys;
+}
+arb_poly_bench_t;
+
+/* polynomials with coefficients 1/(k+1) and points 1/(k+2) */
+static void *
+arb_poly_init_ab(slong prec, slong size)
+{
+    arb_poly_bench_t * s = flint_malloc(sizeof(arb_poly_bench_t));
+    slong k;
+
+    arb_poly_init(s->a);
+    arb_poly_init(s->b);
+    arb_poly_init(s->c);
+    s->xs = _arb_vec_init(size);
+    s->ys = _arb_vec_init(size);
+
+    arb_poly_fit_length(s->a, size);
+    arb_poly_fit_length(s->b, size);
+
+    for (k = 0; k < size; k++)
+    {
+        arb_set_ui(s->a->coeffs + k, k + 1);
+        arb_inv(s->a->coeffs + k, s->a->coeffs + k, prec);
+        arb_set_ui(s->b->coeffs + k, 2 * k + 3);
+        arb_inv(s->b->coeffs + k, s->b->coeffs + k, prec);
+        arb_set_ui(s->xs + k, k + 2);
+        arb_inv(s->xs + k, s->xs + k, prec);
+    }
+
+    _arb_poly_set_length(s->a, size);
+    _arb_poly_set_length(s->b, size);
+    _arb_poly_normalise(s->a);
+    _arb_poly_normalise(s->b);
+
+    return s;
+}
+
+static void
+arb_poly_clear_ab(void * state, slong size)
+{
+    arb_poly_bench_t * s = state;
+
+    arb_poly_clear(s->a);
+    arb_poly_clear(s->b);
+    arb_poly_clear(s->c);
+    _arb_vec_clear(s->xs, size);
+    _arb_vec_clear(s->ys, size);
+    flint_free(s);
+}
+
+static void
+run_mullow(void * state, slong prec, slong size)
+{
+    arb_poly_bench_t * s = state;
+    arb_poly_mullow(s->c, s->a, s->b, size, prec);
+}
+
+static void
+run_evaluate_vec_fast(void * state, slong prec, slong size)
+{
+    arb_poly_bench_t * s = state;
+    arb_poly_evaluate_vec_fast(s->ys, s->a, s->xs, size, prec);
+}
+
+static void
+run_exp_series(void * state, slong prec, slong size)
+{
+    arb_poly_bench_t * s = state;
+    arb_poly_exp_series(s->c, s->a, size, prec);
+}
+
+const bench_case_struct bench_cases_arb_poly[] = {
+    { "mullow", "product of two length-size polynomials", BENCH_SIZE, WORD_MAX, WORD_MAX, arb_poly_init_ab, run_mullow, arb_poly_clear_ab },
+    { "evaluate_vec_fast", "length-size polynomial at size points", BENCH_SIZE, 100000, 100000, arb_poly_init_ab, run_evaluate_vec_fast, arb_poly_clear_ab },
+    { "exp_series", "exp of a length-size power series", BENCH_SIZE, 100000, 100000, arb_poly_init_ab, run_exp_series, arb_poly_clear_ab },
+    BENCH_CASES_END
+};
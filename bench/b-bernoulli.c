@@ -0,0 +1,70 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/fmpq_vec.h"
+#include "bernoulli.h"
+#include "bench.h"
+
+typedef struct
+{
+    fmpq_t b;
+    fmpq * v;
+}
+bernoulli_bench_t;
+
+static void *
+bernoulli_init_v(slong prec, slong size)
+{
+    bernoulli_bench_t * s = flint_malloc(sizeof(bernoulli_bench_t));
+
+    fmpq_init(s->b);
+    s->v = _fmpq_vec_init(size);
+
+    return s;
+}
+
+static void
+bernoulli_clear_v(void * state, slong size)
+{
+    bernoulli_bench_t * s = state;
+
+    fmpq_clear(s->b);
+    _fmpq_vec_clear(s->v, size);
+    flint_free(s);
+}
+
+static void
+run_fmpq_ui(void * state, slong prec, slong size)
+{
+    bernoulli_bench_t * s = state;
+    bernoulli_fmpq_ui(s->b, size);
+}
+
+static void
+run_fmpq_vec_no_cache(void * state, slong prec, slong size)
+{
+    bernoulli_bench_t * s = state;
+    bernoulli_fmpq_vec_no_cache(s->v, 0, size);
+}
+
+static void
+run_fmpq_vec_multi_mod(void * state, slong prec, slong size)
+{
+    bernoulli_bench_t * s = state;
+    bernoulli_fmpq_vec_multi_mod(s->v, 0, size);
+}
+
+const bench_case_struct bench_cases_bernoulli[] = {
+    { "fmpq_ui", "B_size", BENCH_SIZE | BENCH_EXACT, 0, 10000000, bernoulli_init_v, run_fmpq_ui, bernoulli_clear_v },
+    { "fmpq_vec_no_cache", "B_0, ..., B_{size-1}", BENCH_SIZE | BENCH_EXACT, 0, 1000000, bernoulli_init_v, run_fmpq_vec_no_cache, bernoulli_clear_v },
+    { "fmpq_vec_multi_mod", "B_0, ..., B_{size-1}", BENCH_SIZE | BENCH_EXACT, 0, 1000000, bernoulli_init_v, run_fmpq_vec_multi_mod, bernoulli_clear_v },
+    BENCH_CASES_END
+};
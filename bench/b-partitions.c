@@ -0,0 +1,39 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "partitions.h"
+#include "bench.h"
+
+static void *
+partitions_init_p(slong prec, slong size)
+{
+    fmpz * p = flint_malloc(sizeof(fmpz));
+    fmpz_init(p);
+    return p;
+}
+
+static void
+partitions_clear_p(void * state, slong size)
+{
+    fmpz_clear((fmpz *) state);
+    flint_free(state);
+}
+
+static void
+run_fmpz_ui(void * state, slong prec, slong size)
+{
+    partitions_fmpz_ui((fmpz *) state, size);
+}
+
+const bench_case_struct bench_cases_partitions[] = {
+    { "fmpz_ui", "p(size)", BENCH_SIZE | BENCH_EXACT, 0, WORD_MAX, partitions_init_p, run_fmpz_ui, partitions_clear_p },
+    BENCH_CASES_END
+};
@@ -0,0 +1,442 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(_MSC_VER)
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+#include "arb.h"
+#include "bench.h"
+
+#define BENCH_MAX_LIST 64
+#define BENCH_MAX_REPS (WORD(1) << 30)
+#define BENCH_MAX_COLD_REPS 100
+
+#define BENCH_TEXT 0
+#define BENCH_JSON 1
+#define BENCH_CSV 2
+
+static const bench_module_struct bench_modules[] = {
+    { "arb", bench_cases_arb },
+    { "arb_poly", bench_cases_arb_poly },
+    { "arb_mat", bench_cases_arb_mat },
+    { "arb_hypgeom", bench_cases_arb_hypgeom },
+    { "acb", bench_cases_acb },
+    { "acb_hypgeom", bench_cases_acb_hypgeom },
+    { "acb_dirichlet", bench_cases_acb_dirichlet },
+    { "acb_dft", bench_cases_acb_dft },
+    { "bernoulli", bench_cases_bernoulli },
+    { "partitions", bench_cases_partitions },
+    { NULL, NULL }
+};
+
+typedef struct
+{
+    slong prec[BENCH_MAX_LIST];
+    slong num_prec;
+    slong size[BENCH_MAX_LIST];
+    slong num_size;
+    slong threads[BENCH_MAX_LIST];
+    slong num_threads;
+    const char * modules;
+    const char * cases;
+    int warm;
+    int cold;
+    double min_time;
+    int format;
+    FILE * out;
+    slong num_results;
+}
+bench_options_t;
+
+static double
+bench_wall(void)
+{
+#if defined(_MSC_VER)
+    LARGE_INTEGER f, c;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&c);
+    return (double) c.QuadPart / (double) f.QuadPart;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + 1e-6 * tv.tv_usec;
+#endif
+}
+
+static double
+bench_cpu(void)
+{
+    return (double) clock() / CLOCKS_PER_SEC;
+}
+
+/* Parses a comma-separated list of positive integers. */
+static int
+bench_parse_list(slong * list, slong * len, const char * str)
+{
+    char * end;
+    slong v;
+
+    *len = 0;
+
+    while (*str != '\0')
+    {
+        v = strtol(str, &end, 10);
+
+        if (end == str || v <= 0 || *len >= BENCH_MAX_LIST)
+            return 0;
+
+        list[(*len)++] = v;
+        str = end;
+
+        if (*str == ',')
+            str++;
+        else if (*str != '\0')
+            return 0;
+    }
+
+    return *len != 0;
+}
+
+/* Checks whether name occurs in the comma-separated list (NULL matches
+   everything). */
+static int
+bench_match(const char * list, const char * name)
+{
+    size_t len = strlen(name);
+
+    if (list == NULL)
+        return 1;
+
+    while (*list != '\0')
+    {
+        if (strncmp(list, name, len) == 0 && (list[len] == ',' || list[len] == '\0'))
+            return 1;
+
+        list = strchr(list, ',');
+
+        if (list == NULL)
+            return 0;
+
+        list++;
+    }
+
+    return 0;
+}
+
+/* Measures the average time per call. Warm runs reuse the operands
+   and caches of a previous untimed call, doubling the number of calls
+   until at least min_time seconds have elapsed. Cold runs clear all
+   caches and recreate the operands before every (single) timed call. */
+static void
+bench_measure(double * wall, double * cpu, slong * reps,
+    const bench_case_struct * c, slong prec, slong size, int cold, double min_time)
+{
+    void * state;
+    double w, u, w0, u0;
+    slong r, i;
+
+    if (cold)
+    {
+        w = u = 0.0;
+
+        for (r = 0; r < BENCH_MAX_COLD_REPS && (r == 0 || w < min_time); r++)
+        {
+            state = c->init(prec, size);
+            flint_cleanup();
+
+            w0 = bench_wall();
+            u0 = bench_cpu();
+            c->run(state, prec, size);
+            w += bench_wall() - w0;
+            u += bench_cpu() - u0;
+
+            c->clear(state, size);
+        }
+    }
+    else
+    {
+        state = c->init(prec, size);
+        c->run(state, prec, size);
+
+        for (r = 1; ; r *= 2)
+        {
+            w0 = bench_wall();
+            u0 = bench_cpu();
+            for (i = 0; i < r; i++)
+                c->run(state, prec, size);
+            w = bench_wall() - w0;
+            u = bench_cpu() - u0;
+
+            if (w >= min_time || r >= BENCH_MAX_REPS)
+                break;
+        }
+
+        c->clear(state, size);
+    }
+
+    *wall = w / r;
+    *cpu = u / r;
+    *reps = r;
+}
+
+static void
+bench_header(bench_options_t * opt)
+{
+    if (opt->format == BENCH_JSON)
+    {
+        fprintf(opt->out, "{\n");
+        fprintf(opt->out, "  \"arb_version\": \"%s\",\n", arb_version);
+        fprintf(opt->out, "  \"flint_version\": \"%s\",\n", FLINT_VERSION);
+        fprintf(opt->out, "  \"bits\": %d,\n", FLINT_BITS);
+        fprintf(opt->out, "  \"results\": [");
+    }
+    else if (opt->format == BENCH_CSV)
+    {
+        fprintf(opt->out, "module,case,prec,size,threads,cache,reps,wall,cpu\n");
+    }
+    else
+    {
+        fprintf(opt->out, "%-14s %-22s %8s %8s %7s %5s %10s %12s %12s\n",
+            "module", "case", "prec", "size", "threads", "cache", "reps", "wall", "cpu");
+    }
+}
+
+static void
+bench_footer(bench_options_t * opt)
+{
+    if (opt->format == BENCH_JSON)
+        fprintf(opt->out, "\n  ]\n}\n");
+}
+
+static void
+bench_record(bench_options_t * opt, const char * module, const char * name,
+    slong prec, slong size, slong threads, int cold, slong reps, double wall, double cpu)
+{
+    const char * cache = cold ? "cold" : "warm";
+
+    if (opt->format == BENCH_JSON)
+    {
+        fprintf(opt->out, "%s\n    {\"module\": \"%s\", \"case\": \"%s\", "
+            "\"prec\": %ld, \"size\": %ld, \"threads\": %ld, \"cache\": \"%s\", "
+            "\"reps\": %ld, \"wall\": %.6e, \"cpu\": %.6e}",
+            opt->num_results == 0 ? "" : ",", module, name,
+            (long) prec, (long) size, (long) threads, cache, (long) reps, wall, cpu);
+    }
+    else if (opt->format == BENCH_CSV)
+    {
+        fprintf(opt->out, "%s,%s,%ld,%ld,%ld,%s,%ld,%.6e,%.6e\n",
+            module, name, (long) prec, (long) size, (long) threads, cache,
+            (long) reps, wall, cpu);
+    }
+    else
+    {
+        fprintf(opt->out, "%-14s %-22s %8ld %8ld %7ld %5s %10ld %12.4g %12.4g\n",
+            module, name, (long) prec, (long) size, (long) threads, cache,
+            (long) reps, wall, cpu);
+    }
+
+    fflush(opt->out);
+    opt->num_results++;
+}
+
+static void
+bench_run_case(bench_options_t * opt, const char * module, const bench_case_struct * c)
+{
+    slong i, j, k, num_prec, num_size, prec, size, reps;
+    double wall, cpu;
+    int cold;
+
+    num_prec = (c->flags & BENCH_EXACT) ? 1 : opt->num_prec;
+    num_size = (c->flags & BENCH_SIZE) ? opt->num_size : 1;
+
+    for (k = 0; k < opt->num_threads; k++)
+    {
+        flint_set_num_threads(opt->threads[k]);
+
+        for (i = 0; i < num_prec; i++)
+        {
+            prec = (c->flags & BENCH_EXACT) ? 0 : opt->prec[i];
+
+            if (prec > c->max_prec)
+                continue;
+
+            for (j = 0; j < num_size; j++)
+            {
+                size = (c->flags & BENCH_SIZE) ? opt->size[j] : 0;
+
+                if (size > c->max_size)
+                    continue;
+
+                for (cold = 0; cold <= 1; cold++)
+                {
+                    if ((cold && !opt->cold) || (!cold && !opt->warm))
+                        continue;
+
+                    bench_measure(&wall, &cpu, &reps, c, prec, size, cold, opt->min_time);
+                    bench_record(opt, module, c->name, prec, size,
+                        opt->threads[k], cold, reps, wall, cpu);
+                }
+            }
+        }
+    }
+
+    flint_set_num_threads(1);
+}
+
+static void
+bench_usage(const char * prog)
+{
+    fprintf(stderr,
+        "usage: %s [options]\n"
+        "  --list                  list the benchmark cases and exit\n"
+        "  --module M1,M2,...      only run cases from these modules\n"
+        "  --case C1,C2,...        only run these cases\n"
+        "  --prec P1,P2,...        precisions to sweep (default 64,256,1024,4096)\n"
+        "  --size N1,N2,...        sizes to sweep (default 10,100,1000)\n"
+        "  --threads T1,T2,...     thread counts to sweep (default 1)\n"
+        "  --cache warm|cold|both  cache state (default warm)\n"
+        "  --min-time SECONDS      minimum time per measurement (default 0.1)\n"
+        "  --format text|json|csv  output format (default text)\n"
+        "  --output FILE           write the results to FILE\n", prog);
+}
+
+int
+main(int argc, char * argv[])
+{
+    bench_options_t opt;
+    const bench_module_struct * m;
+    const bench_case_struct * c;
+    int i, list;
+
+    opt.num_prec = 4;
+    opt.prec[0] = 64;
+    opt.prec[1] = 256;
+    opt.prec[2] = 1024;
+    opt.prec[3] = 4096;
+    opt.num_size = 3;
+    opt.size[0] = 10;
+    opt.size[1] = 100;
+    opt.size[2] = 1000;
+    opt.num_threads = 1;
+    opt.threads[0] = 1;
+    opt.modules = NULL;
+    opt.cases = NULL;
+    opt.warm = 1;
+    opt.cold = 0;
+    opt.min_time = 0.1;
+    opt.format = BENCH_TEXT;
+    opt.out = stdout;
+    opt.num_results = 0;
+    list = 0;
+
+    for (i = 1; i < argc; i++)
+    {
+        const char * arg = argv[i];
+        const char * val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        int ok = 1;
+
+        if (strcmp(arg, "--list") == 0)
+        {
+            list = 1;
+            continue;
+        }
+
+        if (val == NULL)
+            ok = 0;
+        else if (strcmp(arg, "--module") == 0)
+            opt.modules = val;
+        else if (strcmp(arg, "--case") == 0)
+            opt.cases = val;
+        else if (strcmp(arg, "--prec") == 0)
+            ok = bench_parse_list(opt.prec, &opt.num_prec, val);
+        else if (strcmp(arg, "--size") == 0)
+            ok = bench_parse_list(opt.size, &opt.num_size, val);
+        else if (strcmp(arg, "--threads") == 0)
+            ok = bench_parse_list(opt.threads, &opt.num_threads, val);
+        else if (strcmp(arg, "--cache") == 0)
+        {
+            opt.warm = (strcmp(val, "warm") == 0 || strcmp(val, "both") == 0);
+            opt.cold = (strcmp(val, "cold") == 0 || strcmp(val, "both") == 0);
+            ok = opt.warm || opt.cold;
+        }
+        else if (strcmp(arg, "--min-time") == 0)
+        {
+            opt.min_time = atof(val);
+            ok = (opt.min_time >= 0.0);
+        }
+        else if (strcmp(arg, "--format") == 0)
+        {
+            if (strcmp(val, "text") == 0)
+                opt.format = BENCH_TEXT;
+            else if (strcmp(val, "json") == 0)
+                opt.format = BENCH_JSON;
+            else if (strcmp(val, "csv") == 0)
+                opt.format = BENCH_CSV;
+            else
+                ok = 0;
+        }
+        else if (strcmp(arg, "--output") == 0)
+        {
+            opt.out = fopen(val, "w");
+
+            if (opt.out == NULL)
+            {
+                fprintf(stderr, "arb_bench: unable to open %s\n", val);
+                return EXIT_FAILURE;
+            }
+        }
+        else
+            ok = 0;
+
+        if (!ok)
+        {
+            bench_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        i++;
+    }
+
+    if (list)
+    {
+        for (m = bench_modules; m->module != NULL; m++)
+            for (c = m->cases; c->name != NULL; c++)
+                printf("%-14s %-22s %s\n", m->module, c->name, c->description);
+
+        return EXIT_SUCCESS;
+    }
+
+    bench_header(&opt);
+
+    for (m = bench_modules; m->module != NULL; m++)
+    {
+        if (!bench_match(opt.modules, m->module))
+            continue;
+
+        for (c = m->cases; c->name != NULL; c++)
+            if (bench_match(opt.cases, c->name))
+                bench_run_case(&opt, m->module, c);
+    }
+
+    bench_footer(&opt);
+
+    if (opt.out != stdout)
+        fclose(opt.out);
+
+    flint_cleanup_master();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,69 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ARB_BENCH_H
+#define ARB_BENCH_H
+
+#include "flint/flint.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* the case depends on the size parameter */
+#define BENCH_SIZE 1
+
+/* the case does not depend on the precision (it is run with prec = 0) */
+#define BENCH_EXACT 2
+
+/* A benchmark case. The function *init* creates the operands for a
+   given precision and size (this is not timed), *run* performs the
+   operation being measured, and *clear* frees the operands. Sweeps
+   skip precisions and sizes exceeding *max_prec* and *max_size*. */
+typedef struct
+{
+    const char * name;
+    const char * description;
+    int flags;
+    slong max_prec;
+    slong max_size;
+    void * (*init)(slong prec, slong size);
+    void (*run)(void * state, slong prec, slong size);
+    void (*clear)(void * state, slong size);
+}
+bench_case_struct;
+
+#define BENCH_CASES_END { NULL, NULL, 0, 0, 0, NULL, NULL, NULL }
+
+typedef struct
+{
+    const char * module;
+    const bench_case_struct * cases;
+}
+bench_module_struct;
+
+/* one table per module, terminated by BENCH_CASES_END */
+extern const bench_case_struct bench_cases_arb[];
+extern const bench_case_struct bench_cases_arb_poly[];
+extern const bench_case_struct bench_cases_arb_mat[];
+extern const bench_case_struct bench_cases_arb_hypgeom[];
+extern const bench_case_struct bench_cases_acb[];
+extern const bench_case_struct bench_cases_acb_hypgeom[];
+extern const bench_case_struct bench_cases_acb_dirichlet[];
+extern const bench_case_struct bench_cases_acb_dft[];
+extern const bench_case_struct bench_cases_bernoulli[];
+extern const bench_case_struct bench_cases_partitions[];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
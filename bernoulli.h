@@ -95,6 +95,13 @@ void bernoulli_rev_clear(bernoulli_rev_t iter);
 
 void bernoulli_fmpq_vec_no_cache(fmpq * res, ulong a, slong num);
 
+typedef void (*bernoulli_vec_callback_t)(ulong n, const fmpq_t b, void * param);
+
+void bernoulli_fmpq_vec_multi_mod_stream(ulong a, slong num,
+    bernoulli_vec_callback_t callback, void * param);
+
+void bernoulli_fmpq_vec_multi_mod(fmpq * res, ulong a, slong num);
+
 #define BERNOULLI_ENSURE_CACHED(n) \
   do { \
     slong __n = (n); \
@@ -0,0 +1,377 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint/thread_support.h"
+#include "flint/nmod_poly.h"
+#include "bernoulli.h"
+
+/* minimum number of primes per block */
+#define MULTI_MOD_MIN_BLOCK 16
+
+/* maximum number of residues stored per block */
+#define MULTI_MOD_MAX_WORDS (WORD(1) << 24)
+
+/* number of indices per CRT task */
+#define MULTI_MOD_CRT_CHUNK 16
+
+/* Residues of the numerators of B_{2k}, klo <= k <= khi, modulo the
+   primes p_j, written to res[j * (khi - klo + 1) + k - klo].
+   All primes are odd and exceed 2 khi + 1, so they divide neither the
+   denominators nor the factorials below, and 4 is invertible. */
+typedef struct
+{
+    mp_ptr res;
+    mp_srcptr primes;
+    const fmpz * den;
+    slong kmin;
+    slong klo;
+    slong khi;
+}
+mod_p_work_t;
+
+static void
+mod_p_worker(slong j, mod_p_work_t * work)
+{
+    nmod_poly_t C, S, Q;
+    nmod_t mod;
+    mp_ptr res;
+    mp_limb_t p, t, u, inv4;
+    slong k, m, len;
+
+    p = work->primes[j];
+    nmod_init(&mod, p);
+    len = work->khi + 1;
+    res = work->res + j * (work->khi - work->klo + 1);
+
+    nmod_poly_init2(C, p, len);
+    nmod_poly_init2(S, p, len);
+    nmod_poly_init(Q, p);
+
+    /* C = sum x^k / (2k)!, S = sum x^k / (2k+1)! */
+    t = 1;
+    for (m = 2; m <= 2 * len - 1; m++)
+        t = nmod_mul(t, m, mod);
+    t = n_invmod(t, p);
+
+    for (m = 2 * len - 1; m >= 0; m--)
+    {
+        if (m % 2 == 1)
+            S->coeffs[m / 2] = t;
+        else
+            C->coeffs[m / 2] = t;
+
+        if (m != 0)
+            t = nmod_mul(t, m, mod);
+    }
+
+    _nmod_poly_set_length(C, len);
+    _nmod_poly_set_length(S, len);
+
+    /* C / S = sqrt(x) coth(sqrt(x)) = sum B_{2k} 4^k x^k / (2k)! */
+    nmod_poly_div_series(Q, C, S, len);
+
+    /* multiply by (2k)! / 4^k, the denominator, and the sign */
+    inv4 = n_invmod(4, p);
+    t = 1;
+    for (k = 0; k <= work->khi; k++)
+    {
+        if (k != 0)
+        {
+            t = nmod_mul(t, nmod_mul(2 * k - 1, 2 * k, mod), mod);
+            t = nmod_mul(t, inv4, mod);
+        }
+
+        if (k >= work->klo)
+        {
+            u = nmod_mul(nmod_poly_get_coeff_ui(Q, k), t, mod);
+            u = nmod_mul(u, fmpz_fdiv_ui(work->den + k - work->kmin, p), mod);
+
+            if (k % 2 == 0 && k != 0)
+                u = nmod_neg(u, mod);
+
+            res[k - work->klo] = u;
+        }
+    }
+
+    nmod_poly_clear(C);
+    nmod_poly_clear(S);
+    nmod_poly_clear(Q);
+}
+
+/* Folds the residues of one block of primes (with product Mb) into
+   the accumulated residues r modulo M, given Minv = M^(-1) mod Mb. */
+typedef struct
+{
+    fmpz * r;
+    const char * done;
+    mp_srcptr res;
+    const fmpz_comb_struct * comb;
+    const fmpz * M;
+    const fmpz * Mb;
+    const fmpz * Minv;
+    slong num_primes;
+    slong kmin;
+    slong klo;
+    slong khi;
+}
+crt_work_t;
+
+static void
+crt_worker(slong i, crt_work_t * work)
+{
+    fmpz_comb_temp_t temp;
+    fmpz_t t, u;
+    mp_ptr col;
+    slong j, k, start, stop, rowlen;
+
+    rowlen = work->khi - work->klo + 1;
+    start = work->klo + i * MULTI_MOD_CRT_CHUNK;
+    stop = FLINT_MIN(start + MULTI_MOD_CRT_CHUNK, work->khi + 1);
+
+    fmpz_comb_temp_init(temp, work->comb);
+    col = flint_malloc(sizeof(mp_limb_t) * work->num_primes);
+    fmpz_init(t);
+    fmpz_init(u);
+
+    for (k = start; k < stop; k++)
+    {
+        fmpz * r = work->r + k - work->kmin;
+
+        if (work->done[k - work->kmin])
+            continue;
+
+        for (j = 0; j < work->num_primes; j++)
+            col[j] = work->res[j * rowlen + k - work->klo];
+
+        fmpz_multi_CRT_ui(t, col, work->comb, temp, 0);
+
+        /* r += M ((t - r) M^(-1) mod Mb) */
+        fmpz_mod(u, r, work->Mb);
+        fmpz_sub(t, t, u);
+        fmpz_mul(t, t, work->Minv);
+        fmpz_mod(t, t, work->Mb);
+        fmpz_addmul(r, t, work->M);
+    }
+
+    fmpz_clear(t);
+    fmpz_clear(u);
+    flint_free(col);
+    fmpz_comb_temp_clear(temp);
+}
+
+void
+bernoulli_fmpq_vec_multi_mod_stream(ulong a, slong num,
+    bernoulli_vec_callback_t callback, void * param)
+{
+    n_primes_t prime_iter;
+    fmpz * r;
+    fmpz * den;
+    slong * bits;
+    char * done;
+    mp_ptr primes, res;
+    fmpz_t M, Mb, Minv;
+    fmpq_t b;
+    ulong next, nmax;
+    slong i, k, kmin, kmax, klo, len, block, total_primes;
+
+    if (num <= 0)
+        return;
+
+    if (a > (UWORD(1) << 31) || num > 1000000000)
+    {
+        flint_printf("bernoulli_fmpq_vec_multi_mod_stream: excessive input\n");
+        flint_abort();
+    }
+
+    nmax = a + num - 1;
+    kmin = (a + 1) / 2;
+    kmax = nmax / 2;
+    len = kmax - kmin + 1;
+
+    fmpq_init(b);
+    fmpz_init(M);
+    fmpz_init(Mb);
+    fmpz_init(Minv);
+
+    r = _fmpz_vec_init(FLINT_MAX(len, 0));
+    den = _fmpz_vec_init(FLINT_MAX(len, 0));
+    bits = flint_malloc(sizeof(slong) * FLINT_MAX(len, 1));
+    done = flint_calloc(FLINT_MAX(len, 1), sizeof(char));
+
+    for (k = kmin; k <= kmax; k++)
+    {
+        arith_bernoulli_number_denom(den + k - kmin, 2 * k);
+        bits[k - kmin] = arith_bernoulli_number_size(2 * k)
+            + fmpz_bits(den + k - kmin) + 2;
+    }
+
+    n_primes_init(prime_iter);
+    /* nmax = 0 would otherwise start at p = 2 */
+    n_primes_jump_after(prime_iter, FLINT_MAX(nmax + 1, 2));
+
+    fmpz_one(M);
+    next = a;
+    klo = kmin;
+    total_primes = 0;
+
+    while (1)
+    {
+        /* emit everything that is complete, in order */
+        for ( ; next <= nmax; next++)
+        {
+            if (next % 2 == 1)
+            {
+                if (next == 1)
+                    fmpq_set_si(b, -1, 2);
+                else
+                    fmpq_zero(b);
+            }
+            else
+            {
+                k = next / 2;
+
+                if (!done[k - kmin])
+                    break;
+
+                if (k % 2 == 0 && k != 0)
+                    fmpz_neg(fmpq_numref(b), r + k - kmin);
+                else
+                    fmpz_set(fmpq_numref(b), r + k - kmin);
+
+                fmpz_set(fmpq_denref(b), den + k - kmin);
+
+                fmpz_clear(r + k - kmin);
+                fmpz_clear(den + k - kmin);
+                fmpz_init(r + k - kmin);
+                fmpz_init(den + k - kmin);
+            }
+
+            callback(next, b, param);
+        }
+
+        while (klo <= kmax && done[klo - kmin])
+            klo++;
+
+        if (klo > kmax)
+            break;
+
+        /* grow the blocks geometrically, bounding the residue storage */
+        block = FLINT_MAX(MULTI_MOD_MIN_BLOCK, total_primes / 4);
+        block = FLINT_MIN(block, FLINT_MAX(1, MULTI_MOD_MAX_WORDS / (kmax - klo + 1)));
+
+        primes = flint_malloc(sizeof(mp_limb_t) * block);
+        res = flint_malloc(sizeof(mp_limb_t) * block * (kmax - klo + 1));
+
+        fmpz_one(Mb);
+        for (i = 0; i < block; i++)
+        {
+            primes[i] = n_primes_next(prime_iter);
+            fmpz_mul_ui(Mb, Mb, primes[i]);
+        }
+
+        total_primes += block;
+
+        {
+            mod_p_work_t work;
+
+            work.res = res;
+            work.primes = primes;
+            work.den = den;
+            work.kmin = kmin;
+            work.klo = klo;
+            work.khi = kmax;
+
+            if (block > 1 && arb_flint_get_num_available_threads() > 1)
+                flint_parallel_do((do_func_t) mod_p_worker, &work, block, -1, FLINT_PARALLEL_STRIDED);
+            else
+                for (i = 0; i < block; i++)
+                    mod_p_worker(i, &work);
+        }
+
+        {
+            crt_work_t work;
+            fmpz_comb_t comb;
+            slong num_chunks;
+
+            fmpz_comb_init(comb, primes, block);
+            fmpz_invmod(Minv, M, Mb);
+
+            work.r = r;
+            work.done = done;
+            work.res = res;
+            work.comb = comb;
+            work.M = M;
+            work.Mb = Mb;
+            work.Minv = Minv;
+            work.num_primes = block;
+            work.kmin = kmin;
+            work.klo = klo;
+            work.khi = kmax;
+
+            num_chunks = (kmax - klo + MULTI_MOD_CRT_CHUNK) / MULTI_MOD_CRT_CHUNK;
+
+            if (num_chunks > 1 && arb_flint_get_num_available_threads() > 1)
+                flint_parallel_do((do_func_t) crt_worker, &work, num_chunks, -1, FLINT_PARALLEL_STRIDED);
+            else
+                for (i = 0; i < num_chunks; i++)
+                    crt_worker(i, &work);
+
+            fmpz_comb_clear(comb);
+        }
+
+        fmpz_mul(M, M, Mb);
+
+        for (k = klo; k <= kmax; k++)
+            if (fmpz_bits(M) > bits[k - kmin])
+                done[k - kmin] = 1;
+
+        flint_free(primes);
+        flint_free(res);
+    }
+
+    n_primes_clear(prime_iter);
+
+    _fmpz_vec_clear(r, FLINT_MAX(len, 0));
+    _fmpz_vec_clear(den, FLINT_MAX(len, 0));
+    flint_free(bits);
+    flint_free(done);
+
+    fmpq_clear(b);
+    fmpz_clear(M);
+    fmpz_clear(Mb);
+    fmpz_clear(Minv);
+}
+
+typedef struct
+{
+    fmpq * res;
+    ulong a;
+}
+store_param_t;
+
+static void
+store_callback(ulong n, const fmpq_t b, void * param)
+{
+    store_param_t * store = (store_param_t *) param;
+
+    fmpq_set(store->res + n - store->a, b);
+}
+
+void
+bernoulli_fmpq_vec_multi_mod(fmpq * res, ulong a, slong num)
+{
+    store_param_t store;
+
+    store.res = res;
+    store.a = a;
+
+    bernoulli_fmpq_vec_multi_mod_stream(a, num, store_callback, &store);
+}
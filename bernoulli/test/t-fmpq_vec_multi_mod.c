@@ -0,0 +1,139 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "bernoulli.h"
+
+typedef struct
+{
+    fmpq * res;
+    ulong a;
+    ulong next;
+}
+check_param_t;
+
+static void
+check_callback(ulong n, const fmpq_t b, void * param)
+{
+    check_param_t * check = (check_param_t *) param;
+
+    if (n != check->next)
+    {
+        flint_printf("FAIL (order): n = %wu, expected %wu\n", n, check->next);
+        flint_abort();
+    }
+
+    if (!fmpq_equal(b, check->res + n - check->a))
+    {
+        flint_printf("FAIL (stream): n = %wu\n", n);
+        fmpq_print(b); flint_printf("\n\n");
+        fmpq_print(check->res + n - check->a); flint_printf("\n\n");
+        flint_abort();
+    }
+
+    check->next++;
+}
+
+int main()
+{
+    slong iter;
+    flint_rand_t state;
+
+    flint_printf("fmpq_vec_multi_mod....");
+    fflush(stdout);
+    flint_randinit(state);
+
+    /* small fixed cases, including B_0 alone */
+    {
+        slong a, num, i;
+        fmpq * res1;
+        fmpq * res2;
+
+        for (a = 0; a <= 3; a++)
+        {
+            for (num = 0; num <= 3; num++)
+            {
+                res1 = _fmpq_vec_init(num);
+                res2 = _fmpq_vec_init(num);
+
+                bernoulli_fmpq_vec_no_cache(res1, a, num);
+                bernoulli_fmpq_vec_multi_mod(res2, a, num);
+
+                for (i = 0; i < num; i++)
+                {
+                    if (!fmpq_equal(res1 + i, res2 + i))
+                    {
+                        flint_printf("FAIL (small):\n");
+                        flint_printf("a = %wd, num = %wd, n = %wd\n\n", a, num, a + i);
+                        flint_abort();
+                    }
+                }
+
+                _fmpq_vec_clear(res1, num);
+                _fmpq_vec_clear(res2, num);
+            }
+        }
+    }
+
+    for (iter = 0; iter < 200 * arb_test_multiplier(); iter++)
+    {
+        slong a, b, num, i;
+        fmpq * res1;
+        fmpq * res2;
+        check_param_t check;
+
+        b = n_randint(state, 600);
+        a = n_randint(state, b + 1);
+        num = b - a;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        res1 = _fmpq_vec_init(num);
+        res2 = _fmpq_vec_init(num);
+
+        for (i = 0; i < num; i++)
+            fmpq_randtest(res2 + i, state, 100);
+
+        bernoulli_fmpq_vec_no_cache(res1, a, num);
+        bernoulli_fmpq_vec_multi_mod(res2, a, num);
+
+        for (i = 0; i < num; i++)
+        {
+            if (!fmpq_equal(res1 + i, res2 + i))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("a = %wd, num = %wd, n = %wd\n\n", a, num, a + i);
+                fmpq_print(res1 + i); flint_printf("\n\n");
+                fmpq_print(res2 + i); flint_printf("\n\n");
+                flint_abort();
+            }
+        }
+
+        check.res = res1;
+        check.a = a;
+        check.next = a;
+
+        bernoulli_fmpq_vec_multi_mod_stream(a, num, check_callback, &check);
+
+        if (check.next != a + num)
+        {
+            flint_printf("FAIL (count): a = %wd, num = %wd, next = %wu\n", a, num, check.next);
+            flint_abort();
+        }
+
+        _fmpq_vec_clear(res1, num);
+        _fmpq_vec_clear(res2, num);
+    }
+
+    flint_randclear(state);
+    flint_cleanup_master();
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,747 @@
+/*
+    Copyright (C) 2026 Arb authors
+
+    This file is part of Arb.
+
+    Arb is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+/* Measures the algorithm crossovers in arb_tune_tab on this machine
+   and writes them to a tuning file which can be loaded with
+   arb_tune_load or via the ARB_TUNE_FILE environment variable. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(_MSC_VER)
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+#include "arb.h"
+#include "arb_poly.h"
+#include "arb_mat.h"
+#include "acb_dft.h"
+
+#define TUNE_TRIALS 3
+#define TUNE_MAX_REPS (WORD(1) << 30)
+#define TUNE_MAX_POINTS 64
+#define TUNE_MAX_PREC (WORD(1) << 20)
+
+typedef void (*tune_func_t)(int variant, slong n);
+
+static double tune_min_time = 0.01;
+static int tune_verbose = 1;
+
+/* operands shared by the measured functions */
+static arb_t tune_x, tune_y;
+static slong tune_prec, tune_k;
+static slong tune_mat_n = -1;
+static arb_mat_t tune_A, tune_B, tune_C;
+static slong tune_dft_len = -1;
+static acb_ptr tune_v, tune_w;
+static slong tune_poly_len = -1;
+static arb_ptr tune_a, tune_b, tune_c;
+static slong tune_fmpz_len = -1;
+static fmpz * tune_fa, * tune_fb, * tune_fc;
+static flint_rand_t tune_state;
+
+static double
+tune_wall(void)
+{
+#if defined(_MSC_VER)
+    LARGE_INTEGER f, c;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&c);
+    return (double) c.QuadPart / (double) f.QuadPart;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + 1e-6 * tv.tv_usec;
+#endif
+}
+
+/* Best time per call over TUNE_TRIALS runs, each doubling the number
+   of calls until at least tune_min_time seconds have elapsed. */
+static double
+tune_time(tune_func_t func, int variant, slong n)
+{
+    double t, t0, best;
+    slong r, i, trial;
+
+    func(variant, n);
+    best = 0.0;
+
+    for (trial = 0; trial < TUNE_TRIALS; trial++)
+    {
+        for (r = 1; ; r *= 2)
+        {
+            t0 = tune_wall();
+            for (i = 0; i < r; i++)
+                func(variant, n);
+            t = tune_wall() - t0;
+
+            if (t >= tune_min_time || r >= TUNE_MAX_REPS)
+                break;
+        }
+
+        t /= r;
+        if (trial == 0 || t < best)
+            best = t;
+    }
+
+    return best;
+}
+
+/* Returns the first point of the sweep from which variant 1 is faster
+   than variant 0 at two consecutive points (or at the last point),
+   or -1 if variant 0 is always faster. The measured functions select
+   their variant by changing parameters, so all parameters are restored
+   to their values from before the sweep. */
+static slong
+tune_crossover(const char * name, tune_func_t func, const slong * points, slong num)
+{
+    slong saved[ARB_TUNE_NUM];
+    double t0, t1;
+    slong i, result;
+    int prev;
+
+    for (i = 0; i < ARB_TUNE_NUM; i++)
+        saved[i] = arb_tune_get(i);
+
+    prev = 0;
+    result = -1;
+
+    for (i = 0; i < num; i++)
+    {
+        t0 = tune_time(func, 0, points[i]);
+        t1 = tune_time(func, 1, points[i]);
+
+        if (tune_verbose)
+            printf("  %-28s %8ld %12.4g %12.4g\n", name, (long) points[i], t0, t1);
+
+        if (t1 < t0)
+        {
+            if (prev)
+            {
+                result = points[i - 1];
+                break;
+            }
+            prev = 1;
+        }
+        else
+        {
+            prev = 0;
+        }
+    }
+
+    if (i == num && prev)
+        result = points[num - 1];
+
+    for (i = 0; i < ARB_TUNE_NUM; i++)
+        arb_tune_set(i, saved[i]);
+
+    return result;
+}
+
+static slong
+tune_geometric_points(slong * points, slong start, slong stop, slong step)
+{
+    slong n, num;
+
+    for (n = start, num = 0; n <= stop && num < TUNE_MAX_POINTS; num++)
+    {
+        points[num] = n;
+        n = ((n + n / 5 + step - 1) / step) * step;
+    }
+
+    return num;
+}
+
+static void
+tune_result(slong i, slong value)
+{
+    if (value < 0)
+    {
+        if (tune_verbose)
+            printf("%s: no crossover found, keeping %ld\n",
+                arb_tune_name(i), (long) arb_tune_get(i));
+    }
+    else if (!arb_tune_set(i, value))
+    {
+        if (tune_verbose)
+            printf("%s: %ld out of range, keeping %ld\n",
+                arb_tune_name(i), (long) value, (long) arb_tune_get(i));
+    }
+    else if (tune_verbose)
+    {
+        printf("%s = %ld\n", arb_tune_name(i), (long) value);
+    }
+}
+
+/* elementary functions: variant 1 switches to the asymptotically
+   faster algorithm at precision n */
+
+static void
+tune_exp(int variant, slong prec)
+{
+    arb_t y;
+    arb_init(y);
+    arb_tune_set(ARB_TUNE_EXP_LOG_REDUCTION_PREC, variant ? prec : WORD_MAX);
+    arb_exp(y, tune_x, prec);
+    arb_clear(y);
+}
+
+static void
+tune_log(int variant, slong prec)
+{
+    arb_t y;
+    arb_init(y);
+    arb_tune_set(ARB_TUNE_LOG_NEWTON_PREC, variant ? prec : ARB_LOG_TAB2_PREC);
+    arb_log(y, tune_y, prec);
+    arb_clear(y);
+}
+
+static void
+tune_atan(int variant, slong prec)
+{
+    arb_t y;
+    arb_init(y);
+    arb_tune_set(ARB_TUNE_ATAN_NEWTON_PREC, variant ? prec : WORD_MAX);
+    arb_atan(y, tune_x, prec);
+    arb_clear(y);
+}
+
+static void
+tune_sin_cos(int variant, slong prec)
+{
+    arb_t s, c;
+    arb_init(s);
+    arb_init(c);
+    arb_tune_set(ARB_TUNE_SIN_COS_ATAN_REDUCTION_PREC, variant ? prec : WORD_MAX);
+    arb_sin_cos(s, c, tune_x, prec);
+    arb_clear(s);
+    arb_clear(c);
+}
+
+/* binary splitting threads: variant 0 allows tune_k / 2 threads,
+   variant 1 allows tune_k threads */
+static void
+tune_exp_set_threads(slong k)
+{
+    arb_tune_set(ARB_TUNE_EXP_SUM_BS_THREADS_2, k >= 2 ? 0 : WORD_MAX);
+    arb_tune_set(ARB_TUNE_EXP_SUM_BS_THREADS_4, k >= 4 ? 0 : WORD_MAX);
+    arb_tune_set(ARB_TUNE_EXP_SUM_BS_THREADS_8, k >= 8 ? 0 : WORD_MAX);
+}
+
+static void
+tune_exp_threads(int variant, slong prec)
+{
+    arb_t y;
+    arb_init(y);
+    tune_exp_set_threads(variant ? tune_k : tune_k / 2);
+    arb_exp(y, tune_x, prec);
+    arb_clear(y);
+}
+
+/* matrix multiplication at precision tune_prec */
+
+static void
+tune_mat_resize(slong n)
+{
+    if (n == tune_mat_n)
+        return;
+
+    if (tune_mat_n >= 0)
+    {
+        arb_mat_clear(tune_A);
+        arb_mat_clear(tune_B);
+        arb_mat_clear(tune_C);
+    }
+
+    arb_mat_init(tune_A, n, n);
+    arb_mat_init(tune_B, n, n);
+    arb_mat_init(tune_C, n, n);
+    arb_mat_randtest(tune_A, tune_state, tune_prec, 10);
+    arb_mat_randtest(tune_B, tune_state, tune_prec, 10);
+    tune_mat_n = n;
+}
+
+static void
+tune_mat_mul_block(int variant, slong n)
+{
+    tune_mat_resize(n);
+
+    if (variant)
+        arb_mat_mul_block(tune_C, tune_A, tune_B, tune_prec);
+    else
+        arb_mat_mul_classical(tune_C, tune_A, tune_B, tune_prec);
+}
+
+static void
+tune_mat_mul_threaded(int variant, slong n)
+{
+    tune_mat_resize(n);
+
+    if (variant)
+        arb_mat_mul_threaded(tune_C, tune_A, tune_B, tune_prec);
+    else
+        arb_mat_mul_classical(tune_C, tune_A, tune_B, tune_prec);
+}
+
+/* DFT of prime length */
+static void
+tune_dft(int variant, slong len)
+{
+    slong i;
+
+    if (len != tune_dft_len)
+    {
+        if (tune_dft_len >= 0)
+        {
+            _acb_vec_clear(tune_v, tune_dft_len);
+            _acb_vec_clear(tune_w, tune_dft_len);
+        }
+
+        tune_v = _acb_vec_init(len);
+        tune_w = _acb_vec_init(len);
+        for (i = 0; i < len; i++)
+            acb_randtest(tune_v + i, tune_state, tune_prec, 4);
+        tune_dft_len = len;
+    }
+
+    if (variant)
+        acb_dft_bluestein(tune_w, tune_v, len, tune_prec);
+    else
+        acb_dft_naive(tune_w, tune_v, len, tune_prec);
+}
+
+/* Bluestein chirp factors: variant 1 uses the addition sequence */
+static void
+tune_bluestein_addseq(int variant, slong len)
+{
+    arb_tune_set(ARB_TUNE_DFT_BLUESTEIN_ADDSEQ_MIN_LEN, variant ? 8 : WORD_MAX);
+    tune_dft(1, len);
+}
+
+/* convolution of length 16 n, where n is the value compared with the
+   cutoff: variant 1 uses radix 2, variant 0 a DFT of the same length */
+static void
+tune_convol(int variant, slong n)
+{
+    slong i, len = 16 * n;
+
+    if (len != tune_dft_len)
+    {
+        if (tune_dft_len >= 0)
+        {
+            _acb_vec_clear(tune_v, tune_dft_len);
+            _acb_vec_clear(tune_w, tune_dft_len);
+        }
+
+        tune_v = _acb_vec_init(len);
+        tune_w = _acb_vec_init(len);
+        for (i = 0; i < len; i++)
+            acb_randtest(tune_v + i, tune_state, tune_prec, 4);
+        tune_dft_len = len;
+    }
+
+    if (variant)
+        acb_dft_convol_rad2(tune_w, tune_v, tune_v, len, tune_prec);
+    else
+        acb_dft_convol_dft(tune_w, tune_v, tune_v, len, tune_prec);
+}
+
+/* block polynomial multiplication over a few precisions, with
+   coefficients of widely varying magnitude */
+static double
+tune_mullow_block_time(void)
+{
+    arb_poly_t a, b, c;
+    slong k, len, prec;
+    double t, t0, total;
+    slong r, i;
+
+    len = 256;
+    total = 0.0;
+
+    arb_poly_init(a);
+    arb_poly_init(b);
+    arb_poly_init(c);
+
+    for (prec = 64; prec <= 1024; prec *= 4)
+    {
+        arb_poly_fit_length(a, len);
+        arb_poly_fit_length(b, len);
+        _arb_poly_set_length(a, len);
+        _arb_poly_set_length(b, len);
+
+        arb_one(a->coeffs);
+        for (k = 1; k < len; k++)
+            arb_div_ui(a->coeffs + k, a->coeffs + k - 1, k, prec);
+        for (k = 0; k < len; k++)
+        {
+            arb_ui_pow_ui(b->coeffs + k, 3, k, prec);
+            arb_div_ui(b->coeffs + k, b->coeffs + k, k + 1, prec);
+        }
+
+        arb_poly_mullow_block(c, a, b, len, prec);
+
+        for (r = 1; ; r *= 2)
+        {
+            t0 = tune_wall();
+            for (i = 0; i < r; i++)
+                arb_poly_mullow_block(c, a, b, len, prec);
+            t = tune_wall() - t0;
+
+            if (t >= tune_min_time || r >= TUNE_MAX_REPS)
+                break;
+        }
+
+        total += t / r;
+    }
+
+    arb_poly_clear(a);
+    arb_poly_clear(b);
+    arb_poly_clear(c);
+
+    return total;
+}
+
+/* long polynomial multiplication: variant 1 uses the FFT */
+
+static void
+tune_poly_resize(slong len)
+{
+    slong i;
+
+    if (len == tune_poly_len)
+        return;
+
+    if (tune_poly_len >= 0)
+    {
+        _arb_vec_clear(tune_a, tune_poly_len);
+        _arb_vec_clear(tune_b, tune_poly_len);
+        _arb_vec_clear(tune_c, tune_poly_len);
+    }
+
+    tune_a = _arb_vec_init(len);
+    tune_b = _arb_vec_init(len);
+    tune_c = _arb_vec_init(len);
+    for (i = 0; i < len; i++)
+    {
+        arb_urandom(tune_a + i, tune_state, 1024);
+        arb_urandom(tune_b + i, tune_state, 1024);
+    }
+    tune_poly_len = len;
+}
+
+static void
+tune_mullow_fft_mul(int variant, slong len, slong prec)
+{
+    tune_poly_resize(len);
+
+    if (variant)
+        _arb_poly_mullow_fft(tune_c, tune_a, len, tune_b, len, len, prec);
+    else
+        _arb_poly_mullow_block(tune_c, tune_a, len, tune_b, len, len, prec);
+}
+
+/* sweep over the length at precision tune_prec */
+static void
+tune_mullow_fft_len(int variant, slong len)
+{
+    tune_mullow_fft_mul(variant, len, tune_prec);
+}
+
+/* sweep over the precision at length tune_k: variant 1 uses the
+   block algorithm */
+static void
+tune_mullow_fft_prec(int variant, slong prec)
+{
+    tune_mullow_fft_mul(!variant, tune_k, prec);
+}
+
+/* integer middle product of the coefficients 3 len / 4 <= k < 5 len / 4
+   of a product of two polynomials of length len with tune_prec-bit
+   coefficients: variant 1 uses number-theoretic transforms */
+static void
+tune_fmpz_mulmid(int variant, slong len)
+{
+    slong i;
+
+    if (len != tune_fmpz_len)
+    {
+        if (tune_fmpz_len >= 0)
+        {
+            _fmpz_vec_clear(tune_fa, tune_fmpz_len);
+            _fmpz_vec_clear(tune_fb, tune_fmpz_len);
+            _fmpz_vec_clear(tune_fc, 2 * tune_fmpz_len);
+        }
+
+        tune_fa = _fmpz_vec_init(len);
+        tune_fb = _fmpz_vec_init(len);
+        tune_fc = _fmpz_vec_init(2 * len);
+        for (i = 0; i < len; i++)
+        {
+            fmpz_randbits(tune_fa + i, tune_state, tune_prec);
+            fmpz_randbits(tune_fb + i, tune_state, tune_prec);
+        }
+        tune_fmpz_len = len;
+    }
+
+    arb_tune_set(ARB_TUNE_POLY_MULMID_NTT_MIN_LEN, variant ? 0 : WORD_MAX);
+    _arb_poly_fmpz_mulmid(tune_fc, tune_fa, len, tune_fb, len,
+        3 * len / 4, 5 * len / 4);
+}
+
+static void
+tune_mullow_block(void)
+{
+    static const slong alphas[] = { 150, 200, 300, 400, 600 };
+    static const slong betas[] = { 128, 256, 384, 512, 600 };
+    slong num_alpha, num_beta, i, j, best_alpha, best_beta;
+    double t, best;
+
+    num_alpha = sizeof(alphas) / sizeof(slong);
+    num_beta = sizeof(betas) / sizeof(slong);
+
+    best_alpha = arb_tune_get(ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA);
+    best_beta = arb_tune_get(ARB_TUNE_POLY_MULLOW_BLOCK_BETA);
+    best = -1.0;
+
+    for (i = 0; i < num_alpha; i++)
+    {
+        for (j = 0; j < num_beta; j++)
+        {
+            /* set alpha last so that the combined constraint holds */
+            arb_tune_set(ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA, 100);
+            if (!arb_tune_set(ARB_TUNE_POLY_MULLOW_BLOCK_BETA, betas[j]) ||
+                !arb_tune_set(ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA, alphas[i]))
+                continue;
+
+            t = tune_mullow_block_time();
+
+            if (tune_verbose)
+                printf("  %-28s %4ld %4ld %12.4g\n", "poly_mullow_block",
+                    (long) alphas[i], (long) betas[j], t);
+
+            if (best < 0.0 || t < best)
+            {
+                best = t;
+                best_alpha = alphas[i];
+                best_beta = betas[j];
+            }
+        }
+    }
+
+    arb_tune_set(ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA, 100);
+    tune_result(ARB_TUNE_POLY_MULLOW_BLOCK_BETA, best_beta);
+    tune_result(ARB_TUNE_POLY_MULLOW_BLOCK_ALPHA, best_alpha);
+}
+
+static void
+tune_usage(const char * prog)
+{
+    fprintf(stderr,
+        "usage: %s [options]\n"
+        "  --output FILE           write the tuning file to FILE (default arb_tune.txt)\n"
+        "  --threads N             also tune thread cutoffs for up to N threads (default 1)\n"
+        "  --min-time SECONDS      minimum time per measurement (default 0.01)\n"
+        "  --quiet                 do not print the measurements\n", prog);
+}
+
+int
+main(int argc, char * argv[])
+{
+    const char * filename;
+    slong points[TUNE_MAX_POINTS];
+    slong found[3];
+    slong num, threads, value, best, i, n;
+    int j;
+
+    filename = "arb_tune.txt";
+    threads = 1;
+
+    for (j = 1; j < argc; j++)
+    {
+        if (!strcmp(argv[j], "--output") && j + 1 < argc)
+            filename = argv[++j];
+        else if (!strcmp(argv[j], "--threads") && j + 1 < argc)
+            threads = FLINT_MAX(1, atol(argv[++j]));
+        else if (!strcmp(argv[j], "--min-time") && j + 1 < argc)
+            tune_min_time = atof(argv[++j]);
+        else if (!strcmp(argv[j], "--quiet"))
+            tune_verbose = 0;
+        else
+        {
+            tune_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    /* start from the built-in defaults, not from ARB_TUNE_FILE */
+    arb_tune_reset();
+    flint_set_num_threads(1);
+    flint_randinit(tune_state);
+
+    arb_init(tune_x);
+    arb_init(tune_y);
+    arb_sqrt_ui(tune_y, 2, TUNE_MAX_PREC + 64);
+    arb_sub_ui(tune_x, tune_y, 1, TUNE_MAX_PREC + 64);
+
+    /* elementary functions */
+    num = tune_geometric_points(points, 512, 16384, 64);
+    tune_result(ARB_TUNE_EXP_LOG_REDUCTION_PREC,
+        tune_crossover("exp_log_reduction_prec", tune_exp, points, num));
+    tune_result(ARB_TUNE_ATAN_NEWTON_PREC,
+        tune_crossover("atan_newton_prec", tune_atan, points, num));
+    tune_result(ARB_TUNE_SIN_COS_ATAN_REDUCTION_PREC,
+        tune_crossover("sin_cos_atan_reduction_prec", tune_sin_cos, points, num));
+
+    /* above ARB_LOG_TAB2_PREC, Newton iteration is the only choice */
+    num = tune_geometric_points(points, 512, ARB_LOG_TAB2_PREC - 64, 64);
+    tune_result(ARB_TUNE_LOG_NEWTON_PREC,
+        tune_crossover("log_newton_prec", tune_log, points, num));
+
+    /* polynomial multiplication */
+    tune_mullow_block();
+
+    /* the FFT must win at every precision up to the cutoff, so the
+       length cutoff is measured at the largest such precision */
+    tune_prec = arb_tune_get(ARB_TUNE_POLY_MULLOW_FFT_MAX_PREC);
+    num = tune_geometric_points(points, 100, 20000, 50);
+    tune_result(ARB_TUNE_POLY_MULLOW_FFT_MIN_LEN,
+        tune_crossover("poly_mullow_fft_min_len", tune_mullow_fft_len, points, num));
+
+    tune_k = FLINT_MIN(4 * arb_tune_get(ARB_TUNE_POLY_MULLOW_FFT_MIN_LEN), 20000);
+    num = tune_geometric_points(points, FLINT_BITS, 16 * FLINT_BITS, FLINT_BITS);
+    value = tune_crossover("poly_mullow_fft_max_prec", tune_mullow_fft_prec, points, num);
+    tune_result(ARB_TUNE_POLY_MULLOW_FFT_MAX_PREC, value < 0 ? -1 : value - 1);
+
+    _arb_vec_clear(tune_a, tune_poly_len);
+    _arb_vec_clear(tune_b, tune_poly_len);
+    _arb_vec_clear(tune_c, tune_poly_len);
+
+    /* integer middle products, at a typical block height */
+    tune_prec = 256;
+    num = tune_geometric_points(points, 50, 5000, 10);
+    tune_result(ARB_TUNE_POLY_MULMID_NTT_MIN_LEN,
+        tune_crossover("poly_mulmid_ntt_min_len", tune_fmpz_mulmid, points, num));
+    _fmpz_vec_clear(tune_fa, tune_fmpz_len);
+    _fmpz_vec_clear(tune_fb, tune_fmpz_len);
+    _fmpz_vec_clear(tune_fc, 2 * tune_fmpz_len);
+
+    /* matrix multiplication, one precision per cutoff */
+    num = tune_geometric_points(points, 8, 160, 4);
+    for (i = 0; i < 3; i++)
+    {
+        tune_prec = (i == 0) ? 2 * FLINT_BITS : (i == 1) ? 8 * FLINT_BITS : 32 * FLINT_BITS;
+        tune_mat_n = -1;
+        value = tune_crossover(arb_tune_name(ARB_TUNE_MAT_MUL_BLOCK_CUTOFF_1 + i),
+            tune_mat_mul_block, points, num);
+        tune_result(ARB_TUNE_MAT_MUL_BLOCK_CUTOFF_1 + i, value < 0 ? -1 : value - 1);
+        arb_mat_clear(tune_A);
+        arb_mat_clear(tune_B);
+        arb_mat_clear(tune_C);
+    }
+
+    /* DFT of prime length */
+    for (n = 7, num = 0; n <= 1000 && num < TUNE_MAX_POINTS; num++)
+    {
+        points[num] = n;
+        n = n_nextprime(n + n / 5, 1);
+    }
+    tune_prec = 128;
+    tune_result(ARB_TUNE_DFT_BLUESTEIN_MIN_LEN,
+        tune_crossover("dft_bluestein_min_len", tune_dft, points, num));
+
+    num = tune_geometric_points(points, 8, 500, 1);
+    tune_result(ARB_TUNE_DFT_BLUESTEIN_ADDSEQ_MIN_LEN,
+        tune_crossover("dft_bluestein_addseq_min_len", tune_bluestein_addseq, points, num));
+
+    /* only 7-smooth leading parts are affected by the cutoff */
+    num = 0;
+    points[num++] = 9;
+    points[num++] = 10;
+    points[num++] = 12;
+    points[num++] = 14;
+    points[num++] = 15;
+    tune_result(ARB_TUNE_DFT_CONVOL_DFT_CUTOFF,
+        tune_crossover("dft_convol_dft_cutoff", tune_convol, points, num));
+
+    _acb_vec_clear(tune_v, tune_dft_len);
+    _acb_vec_clear(tune_w, tune_dft_len);
+
+    if (threads > 1)
+    {
+        flint_set_num_threads(threads);
+
+        /* the size measure is rows * inner * columns * prec */
+        num = tune_geometric_points(points, 2, 64, 1);
+        best = -1;
+        for (tune_prec = 128; tune_prec <= 1024; tune_prec *= 8)
+        {
+            tune_mat_n = -1;
+            n = tune_crossover("mat_mul_thread_min", tune_mat_mul_threaded, points, num);
+            if (n >= 0)
+            {
+                value = n * n * n * tune_prec;
+                best = (best < 0) ? value : FLINT_MIN(best, value);
+            }
+            arb_mat_clear(tune_A);
+            arb_mat_clear(tune_B);
+            arb_mat_clear(tune_C);
+        }
+        tune_result(ARB_TUNE_MAT_MUL_THREAD_MIN, best);
+
+        /* the size measure is 2 N r, which for the largest binary
+           splitting in arb_exp is about twice the precision */
+        for (n = 8192, num = 0; n <= TUNE_MAX_PREC; n *= 2)
+            points[num++] = n;
+
+        for (i = 0; i < 3; i++)
+            found[i] = -1;
+
+        for (i = 0, tune_k = 2; i < 3 && tune_k <= threads; i++, tune_k *= 2)
+        {
+            n = tune_crossover(arb_tune_name(ARB_TUNE_EXP_SUM_BS_THREADS_2 + i),
+                tune_exp_threads, points, num);
+            if (n >= 0)
+                found[i] = 2 * n;
+        }
+
+        /* the thresholds must be increasing */
+        for (i = 0; i < 3; i++)
+        {
+            value = found[i];
+            if (value < 0)
+                value = arb_tune_default(ARB_TUNE_EXP_SUM_BS_THREADS_2 + i);
+            if (i > 0)
+                value = FLINT_MAX(value, arb_tune_get(ARB_TUNE_EXP_SUM_BS_THREADS_2 + i - 1));
+            tune_result(ARB_TUNE_EXP_SUM_BS_THREADS_2 + i, value);
+        }
+
+        flint_set_num_threads(1);
+    }
+
+    arb_clear(tune_x);
+    arb_clear(tune_y);
+    flint_randclear(tune_state);
+
+    if (!arb_tune_save(filename))
+    {
+        fprintf(stderr, "unable to write %s\n", filename);
+        flint_cleanup();
+        return EXIT_FAILURE;
+    }
+
+    if (tune_verbose)
+        printf("wrote %s\n", filename);
+
+    flint_cleanup();
+    return EXIT_SUCCESS;
+}